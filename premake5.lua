@@ -75,6 +75,9 @@ workspace "project-gable"
         files {
             "./projects/gable/src/**.c"
         }
+        filter { "system:linux" }
+            links { "pthread", "rt" }
+        filter {}
 
     -- GABUILD (Gable Asset BUILDer) Tool
     project "gabuild"
@@ -145,4 +148,22 @@ workspace "project-gable"
         prebuildcommands {
             "cd ../.. && ./scripts/assets.sh unbricked %{cfg.buildcfg}"
         }
-        
\ No newline at end of file
+
+    -- Benchmarks
+    project "bench"
+        kind "ConsoleApp"
+        location "./generated/bench"
+        targetdir "./build/bin/bench/%{cfg.buildcfg}"
+        objdir "./build/obj/bench/%{cfg.buildcfg}"
+        includedirs {
+            "./projects/gable/include"
+        }
+        files {
+            "./projects/bench/src/**.c"
+        }
+        libdirs {
+            "./build/bin/gable/%{cfg.buildcfg}"
+        }
+        links {
+            "gable", "m"
+        }
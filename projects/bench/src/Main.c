@@ -0,0 +1,685 @@
+#include <GABLE/GABLE.h>
+
+// Constants ///////////////////////////////////////////////////////////////////////////////////////
+
+#define B_DEFAULT_FRAME_COUNT 2000
+#define B_APU_COST_RUNS 5
+#define B_PPU_CHECK_FRAMES 40
+#define B_RATE_CONTROL_FRAMES 2000
+#define B_SEQ_MUSIC_OFFSET 0
+#define B_SEQ_LONG_EFFECT_OFFSET 91
+#define B_SEQ_SHORT_EFFECT_OFFSET 116
+
+// Static Constants ////////////////////////////////////////////////////////////////////////////////
+
+// A small song and two sound effects for the music sequencer check. The song plays a note on every
+// channel every four rows, and sets marker `$42` on its first row. Both sound effects tick once per
+// frame: the long one holds `PC2` for 32 rows, and the short one plays on `PC2` and `NC` for 4.
+static const Uint8 B_SEQ_SONG_DATA[] = {
+
+    // Song - Tempo 30, speed 2, 16 rows, 1 order, looping, 2 instruments, 1 wave, 4 patterns.
+    0x1E, 0x02, 0x10, 0x01, 0x00, 0x02, 0x01, 0x04,
+    0xF0, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF, 0xFE, 0xDC, 0xBA, 0x98, 0x76, 0x54, 0x32, 0x10,
+    0x34, 0x00, 0x3F, 0x00, 0x48, 0x00, 0x52, 0x00,
+    0x00, 0x01, 0x02, 0x03,
+    0xE4, 0x42, 0x18, 0x82, 0x1C, 0x82, 0x1F, 0x82, 0x24, 0x82, 0xFF,
+    0x0C, 0x82, 0x10, 0x82, 0x13, 0x82, 0x18, 0x82, 0xFF,
+    0xC1, 0x18, 0x82, 0x1C, 0x82, 0x1F, 0x82, 0x24, 0x82, 0xFF,
+    0x20, 0x82, 0x24, 0x82, 0x28, 0x82, 0x2C, 0x82, 0xFF,
+
+    // Long Sound Effect - Tempo 30, speed 1, 32 rows, 1 order, no loop, 1 instrument, 1 pattern.
+    0x1E, 0x01, 0x20, 0x01, 0xFF, 0x01, 0x00, 0x01,
+    0xF0, 0x40, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x16, 0x00,
+    0xFF, 0x00, 0xFF, 0xFF,
+    0x30, 0x9E, 0xFF,
+
+    // Short Sound Effect - Tempo 30, speed 1, 4 rows, 1 order, no loop, 1 instrument, 1 pattern.
+    0x1E, 0x01, 0x04, 0x01, 0xFF, 0x01, 0x00, 0x01,
+    0xF0, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x16, 0x00,
+    0xFF, 0x00, 0xFF, 0x00,
+    0x3C, 0x3E, 0x7F, 0xFF
+
+};
+
+// Static Members //////////////////////////////////////////////////////////////////////////////////
+
+static          Uint32*             s_SourceFrame = NULL;
+static          Uint32*             s_DestinationFrame = NULL;
+static          Count               s_FrameCount = B_DEFAULT_FRAME_COUNT;
+
+// Static Members - Latency Benchmark //////////////////////////////////////////////////////////////
+
+static          Uint32              s_PresentedFrame[GABLE_PPU_SCREEN_BUFFER_SIZE];
+static          Uint64              s_LineCycles[GABLE_PPU_SCREEN_HEIGHT];
+static          Float64             s_LineSeconds[GABLE_PPU_SCREEN_HEIGHT];
+static          Bool                s_PresentPerLine = false;
+static          Float64             s_LatencyCycleSum = 0.0;
+static          Float64             s_LatencySecondSum = 0.0;
+static          Uint64              s_LatencyCycleMax = 0;
+static          Count               s_LatencySamples = 0;
+
+// Static Functions - Timing ///////////////////////////////////////////////////////////////////////
+
+static Float64 B_GetSeconds ()
+{
+    struct timespec l_Time;
+    clock_gettime(CLOCK_MONOTONIC, &l_Time);
+    return (Float64) l_Time.tv_sec + (Float64) l_Time.tv_nsec / 1000000000.0;
+}
+
+// Static Functions - Benchmarks ///////////////////////////////////////////////////////////////////
+
+static void B_BenchmarkUpscaler (Count p_WorkerCount, GABLE_UpscaleFilter p_Filter, Uint8 p_Scale)
+{
+    GABLE_Upscaler* l_Upscaler = GABLE_CreateUpscaler(p_WorkerCount);
+    Size l_Pitch = GABLE_PPU_SCREEN_WIDTH * p_Scale * sizeof(Uint32);
+
+    // Warm up the caches and the worker threads before timing anything.
+    for (Index i = 0; i < 16; ++i)
+    {
+        GABLE_UpscaleFrame(l_Upscaler, p_Filter, p_Scale, s_SourceFrame, s_DestinationFrame, l_Pitch);
+    }
+
+    Float64 l_Start = B_GetSeconds();
+    for (Index i = 0; i < s_FrameCount; ++i)
+    {
+        GABLE_UpscaleFrame(l_Upscaler, p_Filter, p_Scale, s_SourceFrame, s_DestinationFrame, l_Pitch);
+    }
+    Float64 l_Elapsed = B_GetSeconds() - l_Start;
+
+    Float64 l_FramesPerSecond = (Float64) s_FrameCount / l_Elapsed;
+    Float64 l_OutputPixels = (Float64) GABLE_PPU_SCREEN_BUFFER_SIZE * p_Scale * p_Scale;
+    printf("  %-8s %ux  workers: %zu  %10.1f frames/s  %8.1f Mpix/s  %7.3f ms/frame\n",
+        (p_Filter == GABLE_UF_SCALE2X) ? "scale2x" : "nearest", p_Scale,
+        GABLE_GetUpscalerWorkerCount(l_Upscaler), l_FramesPerSecond,
+        l_FramesPerSecond * l_OutputPixels / 1000000.0, 1000.0 * l_Elapsed / (Float64) s_FrameCount);
+
+    GABLE_DestroyUpscaler(l_Upscaler);
+}
+
+static void B_RunUpscalerBenchmarks ()
+{
+    static const Count WORKER_COUNTS[] = { 0, 1, 3 };
+
+    printf("Upscaler (%zu frames per run):\n", s_FrameCount);
+    for (Index i = 0; i < sizeof(WORKER_COUNTS) / sizeof(WORKER_COUNTS[0]); ++i)
+    {
+        for (Uint8 l_Scale = GABLE_UPSCALER_MIN_SCALE; l_Scale <= GABLE_UPSCALER_MAX_SCALE; ++l_Scale)
+        {
+            B_BenchmarkUpscaler(WORKER_COUNTS[i], GABLE_UF_NEAREST, l_Scale);
+        }
+
+        B_BenchmarkUpscaler(WORKER_COUNTS[i], GABLE_UF_SCALE2X, 2);
+    }
+}
+
+static void B_BenchmarkPPU (Bool p_Threaded, Bool p_Cached, Bool p_Headless)
+{
+    GABLE_Engine* l_Engine = GABLE_CreateEngine();
+    GABLE_SetThreadedRendering(l_Engine, p_Threaded);
+    GABLE_SetBackgroundCaching(l_Engine, p_Cached);
+    GABLE_SetPPUHeadless(l_Engine, p_Headless);
+
+    // Fill the tile data and both tile maps with the benchmark pattern, so that the pixel fetcher
+    // has some real work to do.
+    const Uint8* l_Pattern = (const Uint8*) s_SourceFrame;
+    for (Index i = 0; i < GABLE_PPU_VRAM_BANK_SIZE; ++i)
+    {
+        GABLE_WriteVRAMByte(GABLE_GetPPU(l_Engine), GABLE_GB_VRAM_START + i, l_Pattern[i * 7]);
+    }
+
+    Float64 l_Start = B_GetSeconds();
+    GABLE_CycleEngine(l_Engine, (GABLE_DOTS_PER_FRAME / 4) * s_FrameCount / 10);
+    Float64 l_Elapsed = B_GetSeconds() - l_Start;
+
+    printf("  threaded: %-5s cached: %-5s headless: %-5s %10.1f frames/s\n",
+        (p_Threaded == true) ? "yes" : "no", (p_Cached == true) ? "yes" : "no",
+        (p_Headless == true) ? "yes" : "no", (Float64) (s_FrameCount / 10) / l_Elapsed);
+
+    GABLE_DestroyEngine(l_Engine);
+}
+
+static Uint8 B_NextRandom (Uint32* p_Seed)
+{
+    *p_Seed = *p_Seed * 1103515245 + 12345;
+    return (Uint8) (*p_Seed >> 16);
+}
+
+static void B_WriteBoth (GABLE_Engine** p_Engines, Uint16 p_Address, Uint8 p_Value)
+{
+    GABLE_WriteByte(p_Engines[0], p_Address, p_Value);
+    GABLE_WriteByte(p_Engines[1], p_Address, p_Value);
+}
+
+static void B_CheckPPUEquivalence (Bool p_Threaded, Bool p_Cached, Bool p_Headless)
+{
+    // Run two engines side by side, one drawing every scanline with the pixel fetcher and one with
+    // the given rendering options, while making the same random writes to the display registers.
+    // After every M-cycle, the two must agree on STAT, LY, IF, and whether VRAM is locked; and at
+    // the end of every frame, they must have drawn the same pixels (unless the PPU is headless).
+    GABLE_Engine* l_Engines[2] = { GABLE_CreateEngine(), GABLE_CreateEngine() };
+    GABLE_SetThreadedRendering(l_Engines[1], p_Threaded);
+    GABLE_SetBackgroundCaching(l_Engines[1], p_Cached);
+    GABLE_SetPPUHeadless(l_Engines[1], p_Headless);
+
+    Uint32 l_Seed = 11;
+    B_WriteBoth(l_Engines, GABLE_HP_LCDC, 0x00);
+    for (Index i = 0; i < GABLE_PPU_VRAM_BANK_SIZE; ++i)
+    {
+        B_WriteBoth(l_Engines, GABLE_GB_VRAM_START + i, B_NextRandom(&l_Seed));
+    }
+    for (Index i = 0; i < GABLE_PPU_OAM_OBJECT_COUNT * 4; ++i)
+    {
+        B_WriteBoth(l_Engines, GABLE_GB_OAM_START + i, B_NextRandom(&l_Seed));
+    }
+    B_WriteBoth(l_Engines, GABLE_HP_LCDC, 0x93);
+    B_WriteBoth(l_Engines, GABLE_HP_STAT, 0x78);
+    B_WriteBoth(l_Engines, GABLE_HP_IE, 0x03);
+
+    Count l_Steps = B_PPU_CHECK_FRAMES * GABLE_DOTS_PER_FRAME / 4;
+    Count l_Mismatches = 0, l_FrameMismatches = 0, l_Frames = 0;
+    Uint8 l_PreviousLY = 0;
+    for (Index i = 0; i < l_Steps; ++i)
+    {
+        switch (B_NextRandom(&l_Seed) % 128)
+        {
+            case 0: B_WriteBoth(l_Engines, GABLE_HP_SCX, B_NextRandom(&l_Seed)); break;
+            case 1: B_WriteBoth(l_Engines, GABLE_HP_LYC, B_NextRandom(&l_Seed) % 154); break;
+            case 2: B_WriteBoth(l_Engines, GABLE_HP_STAT, B_NextRandom(&l_Seed)); break;
+            case 3: B_WriteBoth(l_Engines, GABLE_HP_IF, 0x00); break;
+            case 4:
+                // Turn the LCD off now and then, but mostly leave it on.
+                if (B_NextRandom(&l_Seed) % 32 == 0)
+                {
+                    Uint8 l_LCDC = B_NextRandom(&l_Seed);
+                    B_WriteBoth(l_Engines, GABLE_HP_LCDC,
+                        (B_NextRandom(&l_Seed) % 4 != 0) ? (l_LCDC | 0x80) : l_LCDC);
+                }
+                break;
+            case 5: B_WriteBoth(l_Engines, GABLE_HP_SCY, B_NextRandom(&l_Seed)); break;
+            case 6: B_WriteBoth(l_Engines, GABLE_HP_BGP, B_NextRandom(&l_Seed)); break;
+            case 7: B_WriteBoth(l_Engines, GABLE_HP_OBP0, B_NextRandom(&l_Seed)); break;
+            case 8: B_WriteBoth(l_Engines, GABLE_HP_WX, B_NextRandom(&l_Seed)); break;
+            default: break;
+        }
+
+        Uint8 l_State[2][4];
+        for (Index e = 0; e < 2; ++e)
+        {
+            GABLE_CycleEngine(l_Engines[e], 1);
+            GABLE_ReadByte(l_Engines[e], GABLE_HP_STAT, &l_State[e][0]);
+            GABLE_ReadByte(l_Engines[e], GABLE_HP_LY, &l_State[e][1]);
+            GABLE_ReadByte(l_Engines[e], GABLE_HP_IF, &l_State[e][2]);
+            GABLE_ReadByte(l_Engines[e], GABLE_GB_VRAM_START + (i % 0x1800), &l_State[e][3]);
+        }
+
+        if (memcmp(l_State[0], l_State[1], sizeof(l_State[0])) != 0)
+        {
+            l_Mismatches++;
+        }
+
+        // Compare the frames as soon as the vertical blank period begins.
+        if (l_State[0][1] == GABLE_PPU_SCREEN_HEIGHT && l_PreviousLY != GABLE_PPU_SCREEN_HEIGHT)
+        {
+            l_Frames++;
+            if (
+                p_Headless == false &&
+                memcmp(GABLE_GetScreenBuffer(l_Engines[0]), GABLE_GetScreenBuffer(l_Engines[1]),
+                    GABLE_PPU_SCREEN_BUFFER_SIZE * sizeof(Uint32)) != 0
+            )
+            {
+                l_FrameMismatches++;
+            }
+        }
+
+        l_PreviousLY = l_State[0][1];
+    }
+
+    printf("  threaded: %-5s cached: %-5s headless: %-5s vs. fetcher: %8zu M-cycles  mismatches: %zu  frames: %zu  frame mismatches: %zu\n",
+        (p_Threaded == true) ? "yes" : "no", (p_Cached == true) ? "yes" : "no",
+        (p_Headless == true) ? "yes" : "no", l_Steps, l_Mismatches, l_Frames, l_FrameMismatches);
+    GABLE_expect(l_Mismatches == 0, "PPU timing differs from the pixel fetcher on %zu M-cycles", l_Mismatches);
+    GABLE_expect(l_FrameMismatches == 0, "PPU draws different pixels from the pixel fetcher on %zu frames",
+        l_FrameMismatches);
+
+    GABLE_DestroyEngine(l_Engines[0]);
+    GABLE_DestroyEngine(l_Engines[1]);
+}
+
+static void B_StartAudioChannels (GABLE_Engine* p_Engine)
+{
+    // Turn the APU on, and start all four channels playing, so that each of them has some real
+    // work to do. Their length timers are cleared, so that they keep on playing.
+    GABLE_WriteByte(p_Engine, GABLE_HP_NR52, 0x80);
+    GABLE_WriteByte(p_Engine, GABLE_HP_NR51, 0xFF);
+    GABLE_WriteByte(p_Engine, GABLE_HP_NR50, 0x77);
+    GABLE_WriteByte(p_Engine, GABLE_HP_NR11, 0x80);
+    GABLE_WriteByte(p_Engine, GABLE_HP_NR21, 0x80);
+    GABLE_WriteByte(p_Engine, GABLE_HP_NR31, 0x00);
+    GABLE_WriteByte(p_Engine, GABLE_HP_NR41, 0x00);
+    GABLE_WriteByte(p_Engine, GABLE_HP_NR12, 0xF0);
+    GABLE_WriteByte(p_Engine, GABLE_HP_NR14, 0x87);
+    GABLE_WriteByte(p_Engine, GABLE_HP_NR22, 0xF0);
+    GABLE_WriteByte(p_Engine, GABLE_HP_NR24, 0x86);
+    GABLE_WriteByte(p_Engine, GABLE_HP_NR30, 0x80);
+    GABLE_WriteByte(p_Engine, GABLE_HP_NR32, 0x20);
+    GABLE_WriteByte(p_Engine, GABLE_HP_NR34, 0x85);
+    GABLE_WriteByte(p_Engine, GABLE_HP_NR42, 0xF0);
+    GABLE_WriteByte(p_Engine, GABLE_HP_NR43, 0x10);
+    GABLE_WriteByte(p_Engine, GABLE_HP_NR44, 0x80);
+}
+
+static void B_BenchmarkAudio (Bool p_AudioEnabled, Bool p_BandLimited, Bool p_ReadBlocks)
+{
+    GABLE_Engine* l_Engine = GABLE_CreateEngine();
+    GABLE_SetPPUHeadless(l_Engine, true);
+    GABLE_SetAudioEnabled(l_Engine, p_AudioEnabled);
+    GABLE_SetBandLimitedAudio(l_Engine, p_BandLimited);
+    B_StartAudioChannels(l_Engine);
+
+    // Run the engine one frame at a time, as a host would, optionally reading each frame's audio
+    // out of the APU's sample ring buffer as a block.
+    GABLE_AudioSample l_Samples[GABLE_AUDIO_RING_DEFAULT_CAPACITY];
+    Count l_SampleCount = 0;
+    Float64 l_Start = B_GetSeconds();
+    for (Index i = 0; i < s_FrameCount / 10; ++i)
+    {
+        GABLE_CycleEngine(l_Engine, GABLE_DOTS_PER_FRAME / 4);
+        if (p_ReadBlocks == true)
+        {
+            l_SampleCount += GABLE_ReadAudioSamples(l_Engine, l_Samples,
+                GABLE_GetQueuedAudioSampleCount(l_Engine));
+        }
+    }
+    Float64 l_Elapsed = B_GetSeconds() - l_Start;
+
+    printf("  audio: %-5s band-limited: %-5s read blocks: %-5s %10.1f frames/s  %8zu samples read\n",
+        (p_AudioEnabled == true) ? "on" : "off", (p_BandLimited == true) ? "yes" : "no",
+        (p_ReadBlocks == true) ? "yes" : "no",
+        (Float64) (s_FrameCount / 10) / l_Elapsed, l_SampleCount);
+
+    GABLE_DestroyEngine(l_Engine);
+}
+
+static void B_CheckVectorizedAudio (Bool p_BandLimited, Uint32 p_SampleRate)
+{
+    // Run two engines side by side, one mixing with the vector kernels and one with the scalar
+    // reference kernels, and compare every sample they output. The panning and master volume are
+    // changed every frame, so that each of the mix's masks gets used.
+    GABLE_Engine* l_Engines[2] = { GABLE_CreateEngine(), GABLE_CreateEngine() };
+    for (Index e = 0; e < 2; ++e)
+    {
+        GABLE_SetPPUHeadless(l_Engines[e], true);
+        GABLE_SetBandLimitedAudio(l_Engines[e], p_BandLimited);
+        GABLE_SetAudioSampleRate(l_Engines[e], p_SampleRate);
+        GABLE_SetVectorizedAudio(l_Engines[e], e == 0);
+        B_StartAudioChannels(l_Engines[e]);
+    }
+
+    static GABLE_AudioSample l_Samples[2][GABLE_AUDIO_RING_DEFAULT_CAPACITY];
+    Float32 l_MaxDeviation = 0.0f;
+    Count l_SampleCount = 0;
+    for (Index i = 0; i < s_FrameCount / 10; ++i)
+    {
+        Count l_Counts[2] = { 0, 0 };
+        for (Index e = 0; e < 2; ++e)
+        {
+            GABLE_WriteByte(l_Engines[e], GABLE_HP_NR51, (Uint8) (i * 37));
+            GABLE_WriteByte(l_Engines[e], GABLE_HP_NR50, (Uint8) (i * 13) & 0x77);
+            GABLE_CycleEngine(l_Engines[e], GABLE_DOTS_PER_FRAME / 4);
+            l_Counts[e] = GABLE_ReadAudioSamples(l_Engines[e], l_Samples[e],
+                GABLE_GetQueuedAudioSampleCount(l_Engines[e]));
+        }
+
+        GABLE_expect(l_Counts[0] == l_Counts[1], "Vector and scalar mixes output different sample counts");
+        for (Index j = 0; j < l_Counts[0]; ++j)
+        {
+            Float32 l_Left = fabsf(l_Samples[0][j].m_Left - l_Samples[1][j].m_Left);
+            Float32 l_Right = fabsf(l_Samples[0][j].m_Right - l_Samples[1][j].m_Right);
+            if (l_Left > l_MaxDeviation) { l_MaxDeviation = l_Left; }
+            if (l_Right > l_MaxDeviation) { l_MaxDeviation = l_Right; }
+        }
+
+        l_SampleCount += l_Counts[0];
+    }
+
+    printf("  band-limited: %-5s sample rate: %6u Hz  vector vs. scalar: %8zu samples  max deviation: %.3g\n",
+        (p_BandLimited == true) ? "yes" : "no", p_SampleRate, l_SampleCount, (Float64) l_MaxDeviation);
+    GABLE_expect(l_MaxDeviation <= GABLE_AUDIO_VECTOR_MAX_DEVIATION,
+        "Vector mix deviates from the scalar mix by %g", (Float64) l_MaxDeviation);
+
+    GABLE_DestroyEngine(l_Engines[0]);
+    GABLE_DestroyEngine(l_Engines[1]);
+}
+
+static void B_CheckRateControl (Bool p_RateControl)
+{
+    // Simulate a host which runs the engine one frame at a time, in step with a display running at
+    // the Game Boy's own refresh rate, and whose audio device drains a 2048-sample buffer 0.2% faster
+    // than 44100 Hz, as a real device's clock might. Left alone, the buffer slowly runs dry. With
+    // the dynamic rate control fed the buffer's fill level each frame, it should settle partway
+    // between empty and half full, and never underflow. It settles where the rate control's
+    // adjustment makes up the 0.2%, at 30% full, or about 614 samples. That takes a while, so the
+    // check always runs for the same number of frames, however many the other benchmarks run for.
+    GABLE_Engine* l_Engine = GABLE_CreateEngine();
+    GABLE_SetPPUHeadless(l_Engine, true);
+    B_StartAudioChannels(l_Engine);
+
+    static GABLE_AudioSample l_Samples[GABLE_AUDIO_RING_DEFAULT_CAPACITY];
+    const Float64 l_Capacity = 2048.0;
+    const Float64 l_Drain = GABLE_AUDIO_SAMPLE_RATE * 1.002 / (4194304.0 / GABLE_DOTS_PER_FRAME);
+    Float64 l_Fill = l_Capacity / 2.0, l_MinFill = l_Fill, l_MaxFill = l_Fill;
+    Count l_Overflows = 0, l_Underflows = 0;
+    for (Index i = 0; i < B_RATE_CONTROL_FRAMES; ++i)
+    {
+        GABLE_CycleEngine(l_Engine, GABLE_DOTS_PER_FRAME / 4);
+        l_Fill += (Float64) GABLE_ReadAudioSamples(l_Engine, l_Samples,
+            GABLE_GetQueuedAudioSampleCount(l_Engine));
+        if (l_Fill > l_Capacity) { l_Overflows++; l_Fill = l_Capacity; }
+        if (l_Fill < l_Drain) { l_Underflows++; l_Fill = l_Drain; }
+        l_Fill -= l_Drain;
+
+        if (l_Fill < l_MinFill) { l_MinFill = l_Fill; }
+        if (l_Fill > l_MaxFill) { l_MaxFill = l_Fill; }
+        if (p_RateControl == true)
+        {
+            GABLE_SetAudioBufferFill(l_Engine, (Float32) (l_Fill / l_Capacity));
+        }
+    }
+
+    printf("  rate control: %-5s %zu frames  buffer fill: %6.1f (min %6.1f, max %6.1f)  overflows: %4zu  underflows: %4zu  rate: %.1f Hz\n",
+        (p_RateControl == true) ? "on" : "off", (Count) B_RATE_CONTROL_FRAMES, l_Fill, l_MinFill, l_MaxFill,
+        l_Overflows, l_Underflows, GABLE_GetEffectiveAudioSampleRate(l_Engine));
+    GABLE_expect(p_RateControl == false || (l_Overflows == 0 && l_Underflows == 0),
+        "Dynamic rate control let the audio buffer overflow %zu times and underflow %zu times",
+        l_Overflows, l_Underflows);
+
+    GABLE_DestroyEngine(l_Engine);
+}
+
+static Uint8 B_ReadPort (GABLE_Engine* p_Engine, Uint16 p_Address)
+{
+    Uint8 l_Value = 0;
+    GABLE_ReadByte(p_Engine, p_Address, &l_Value);
+    return l_Value;
+}
+
+static void B_StartSequencer (GABLE_Engine* p_Engine, Uint16 p_Address, Uint8 p_Command)
+{
+    GABLE_WriteByte(p_Engine, GABLE_HP_SQAH, p_Address >> 8);
+    GABLE_WriteByte(p_Engine, GABLE_HP_SQAL, p_Address & 0xFF);
+    GABLE_WriteByte(p_Engine, GABLE_HP_SQC, p_Command);
+}
+
+static void B_CheckSequencer ()
+{
+    // Play the check song from data store bank 0 through the sequencer's ports, as a program would,
+    // and check the sequencer's status as sound effects take channels from the music and from each
+    // other, and hand them back.
+    GABLE_Engine* l_Engine = GABLE_CreateEngine();
+    GABLE_SetPPUHeadless(l_Engine, true);
+    const GABLE_DataHandle* l_Handle = GABLE_LoadDataFromBuffer(l_Engine, "sequencer check",
+        B_SEQ_SONG_DATA, sizeof(B_SEQ_SONG_DATA), 0);
+    GABLE_expect(l_Handle != NULL, "Failed to load the sequencer check song");
+
+    const Count l_Frame = GABLE_DOTS_PER_FRAME / 4;
+    GABLE_WriteByte(l_Engine, GABLE_HP_NR52, 0x80);
+    GABLE_WriteByte(l_Engine, GABLE_HP_NR50, 0x77);
+
+    // Start the music. Its first row sets the marker, and starts a note on every channel.
+    B_StartSequencer(l_Engine, l_Handle->m_Address + B_SEQ_MUSIC_OFFSET, G_SQCF_PLAY_MUSIC);
+    GABLE_expect(B_ReadPort(l_Engine, GABLE_HP_SQC) == G_SQCF_PLAYING, "Music didn't start");
+    GABLE_CycleEngine(l_Engine, l_Frame);
+    GABLE_expect(B_ReadPort(l_Engine, GABLE_HP_SQM) == 0x42, "Music didn't set its marker");
+    GABLE_expect((B_ReadPort(l_Engine, GABLE_HP_NR52) & 0x0F) == 0x0F, "Music isn't playing on every channel");
+
+    // The long sound effect takes `PC2` from the music. The short one, at a lower priority, can only
+    // take `NC` from the music, and hands it back once it's done.
+    B_StartSequencer(l_Engine, l_Handle->m_Address + B_SEQ_LONG_EFFECT_OFFSET, G_SQCF_PLAY_SFX | 5);
+    GABLE_expect(B_ReadPort(l_Engine, GABLE_HP_SQC) == (G_SQCF_PLAYING | 0b0010),
+        "Sound effect didn't take PC2 from the music");
+    B_StartSequencer(l_Engine, l_Handle->m_Address + B_SEQ_SHORT_EFFECT_OFFSET, G_SQCF_PLAY_SFX | 2);
+    GABLE_expect(B_ReadPort(l_Engine, GABLE_HP_SQC) == (G_SQCF_PLAYING | 0b1010),
+        "Lower-priority sound effect didn't take NC alone");
+    GABLE_CycleEngine(l_Engine, l_Frame * 10);
+    GABLE_expect(B_ReadPort(l_Engine, GABLE_HP_SQC) == (G_SQCF_PLAYING | 0b0010),
+        "Once the short sound effect is done, only the long one should hold a channel (PC2)");
+
+    // At a higher priority, the short sound effect takes `PC2` from the long one, which stops. Once
+    // the short one is done, both channels go back to the music, well before the long one would
+    // have ended, and the music picks `PC2` up again from its next note.
+    B_StartSequencer(l_Engine, l_Handle->m_Address + B_SEQ_SHORT_EFFECT_OFFSET, G_SQCF_PLAY_SFX | 9);
+    GABLE_expect(B_ReadPort(l_Engine, GABLE_HP_SQC) == (G_SQCF_PLAYING | 0b1010),
+        "Higher-priority sound effect didn't take PC2");
+    GABLE_CycleEngine(l_Engine, l_Frame * 10);
+    GABLE_expect(B_ReadPort(l_Engine, GABLE_HP_SQC) == G_SQCF_PLAYING,
+        "Channels weren't handed back to the music");
+    GABLE_CycleEngine(l_Engine, l_Frame * 10);
+    GABLE_expect((B_ReadPort(l_Engine, GABLE_HP_NR52) & 0b0010) != 0, "Music didn't pick PC2 back up");
+
+    // Pausing the music silences its channels and holds its place; resuming it carries on from
+    // there, and it goes on to set its marker again when it loops.
+    GABLE_WriteByte(l_Engine, GABLE_HP_SQC, G_SQCF_PAUSE_MUSIC);
+    GABLE_WriteByte(l_Engine, GABLE_HP_SQM, 0x00);
+    GABLE_expect(B_ReadPort(l_Engine, GABLE_HP_SQC) == (G_SQCF_PLAYING | G_SQCF_PAUSED), "Music didn't pause");
+    GABLE_CycleEngine(l_Engine, l_Frame * 40);
+    GABLE_expect((B_ReadPort(l_Engine, GABLE_HP_NR52) & 0x0F) == 0x00, "Paused music is still playing");
+    GABLE_expect(B_ReadPort(l_Engine, GABLE_HP_SQM) == 0x00, "Paused music moved on");
+    GABLE_WriteByte(l_Engine, GABLE_HP_SQC, G_SQCF_RESUME_MUSIC);
+    GABLE_expect(B_ReadPort(l_Engine, GABLE_HP_SQC) == G_SQCF_PLAYING, "Music didn't resume");
+    GABLE_CycleEngine(l_Engine, l_Frame * 40);
+    GABLE_expect((B_ReadPort(l_Engine, GABLE_HP_NR52) & 0x0F) != 0x00, "Resumed music isn't playing");
+    GABLE_expect(B_ReadPort(l_Engine, GABLE_HP_SQM) == 0x42, "Resumed music didn't loop");
+
+    // Stopping the music silences every channel.
+    GABLE_WriteByte(l_Engine, GABLE_HP_SQC, G_SQCF_STOP_MUSIC);
+    GABLE_expect(B_ReadPort(l_Engine, GABLE_HP_SQC) == 0x00, "Music didn't stop");
+    GABLE_CycleEngine(l_Engine, l_Frame);
+    GABLE_expect((B_ReadPort(l_Engine, GABLE_HP_NR52) & 0x0F) == 0x00, "Stopped music is still playing");
+
+    printf("  sequencer: play, marker, effect priorities, pause/resume and stop: ok\n");
+    GABLE_DestroyEngine(l_Engine);
+}
+
+static void B_BenchmarkAPUCost (Bool p_BandLimited)
+{
+    // Run the same frames with the APU turned off, then with all four channels playing. The
+    // difference between the two is what the APU costs per engine cycle. That difference is small
+    // next to the rest of the engine, so the runs are alternated a few times, and the fastest of
+    // each kept, to keep noise out of it.
+    Float64 l_Elapsed[2] = { 1.0e9, 1.0e9 };
+    Uint64 l_Cycles = 0;
+    for (Index r = 0; r < B_APU_COST_RUNS * 2; ++r)
+    {
+        GABLE_Engine* l_Engine = GABLE_CreateEngine();
+        GABLE_SetPPUHeadless(l_Engine, true);
+        GABLE_SetBandLimitedAudio(l_Engine, p_BandLimited);
+        if (r % 2 == 0)
+        {
+            GABLE_WriteByte(l_Engine, GABLE_HP_NR52, 0x00);
+        }
+        else
+        {
+            B_StartAudioChannels(l_Engine);
+        }
+
+        Uint64 l_StartCycles = GABLE_GetCycleCount(l_Engine);
+        Float64 l_Start = B_GetSeconds();
+        for (Index i = 0; i < s_FrameCount / 10; ++i)
+        {
+            GABLE_CycleEngine(l_Engine, GABLE_DOTS_PER_FRAME / 4);
+        }
+        GABLE_GetLatestAudioSample(l_Engine);
+        Float64 l_RunElapsed = B_GetSeconds() - l_Start;
+        if (l_RunElapsed < l_Elapsed[r % 2])
+        {
+            l_Elapsed[r % 2] = l_RunElapsed;
+        }
+
+        l_Cycles = GABLE_GetCycleCount(l_Engine) - l_StartCycles;
+        GABLE_DestroyEngine(l_Engine);
+    }
+
+    printf("  band-limited: %-5s APU off: %6.2f ns/cycle  APU on: %6.2f ns/cycle  APU cost: %6.2f ns/cycle\n",
+        (p_BandLimited == true) ? "yes" : "no",
+        (l_Elapsed[0] * 1.0e9) / (Float64) l_Cycles, (l_Elapsed[1] * 1.0e9) / (Float64) l_Cycles,
+        ((l_Elapsed[1] - l_Elapsed[0]) * 1.0e9) / (Float64) l_Cycles);
+}
+
+static void B_PresentLine (GABLE_Engine* p_Engine, Uint8 p_Line, const Uint32* p_Pixels)
+{
+    // "Present" the scanline by copying it into the presented frame, then measure how long it has
+    // been since the scanline was finished, in both emulated dots and wall-clock time.
+    memcpy(&s_PresentedFrame[p_Line * GABLE_PPU_SCREEN_WIDTH], p_Pixels,
+        GABLE_PPU_SCREEN_WIDTH * sizeof(Uint32));
+
+    Uint64 l_Cycles = GABLE_GetCycleCount(p_Engine) - s_LineCycles[p_Line];
+    s_LatencyCycleSum += (Float64) l_Cycles;
+    s_LatencySecondSum += B_GetSeconds() - s_LineSeconds[p_Line];
+    s_LatencyCycleMax = (l_Cycles > s_LatencyCycleMax) ? l_Cycles : s_LatencyCycleMax;
+    s_LatencySamples++;
+}
+
+static void B_OnScanlineRendered (GABLE_Engine* p_Engine, GABLE_PPU* p_PPU, Uint8 p_Line,
+    const Uint32* p_Pixels)
+{
+    s_LineCycles[p_Line] = GABLE_GetCycleCount(p_Engine);
+    s_LineSeconds[p_Line] = B_GetSeconds();
+    if (s_PresentPerLine == true)
+    {
+        B_PresentLine(p_Engine, p_Line, p_Pixels);
+    }
+}
+
+static void B_OnFrameRendered (GABLE_Engine* p_Engine, GABLE_PPU* p_PPU)
+{
+    if (s_PresentPerLine == false)
+    {
+        const Uint32* l_ScreenBuffer = GABLE_GetScreenBuffer(p_Engine);
+        for (Uint8 l_Line = 0; l_Line < GABLE_PPU_SCREEN_HEIGHT; ++l_Line)
+        {
+            B_PresentLine(p_Engine, l_Line, &l_ScreenBuffer[l_Line * GABLE_PPU_SCREEN_WIDTH]);
+        }
+    }
+}
+
+static void B_BenchmarkLatency (Bool p_PerLine)
+{
+    GABLE_Engine* l_Engine = GABLE_CreateEngine();
+    GABLE_SetScanlineRenderedCallback(l_Engine, B_OnScanlineRendered);
+    GABLE_SetFrameRenderedCallback(l_Engine, B_OnFrameRendered);
+
+    s_PresentPerLine = p_PerLine;
+    s_LatencyCycleSum = 0.0;
+    s_LatencySecondSum = 0.0;
+    s_LatencyCycleMax = 0;
+    s_LatencySamples = 0;
+
+    GABLE_CycleEngine(l_Engine, (GABLE_DOTS_PER_FRAME / 4) * s_FrameCount / 10);
+
+    // The emulated latency is what the host would see running the engine in real time, at the
+    // Game Boy's 4.194304 MHz dot clock.
+    if (s_LatencySamples > 0)
+    {
+        printf("  %-9s  emulated: %8.1f us avg %8.1f us max  wall-clock: %8.2f us avg\n",
+            (p_PerLine == true) ? "scanline" : "frame",
+            1000000.0 * (s_LatencyCycleSum / (Float64) s_LatencySamples) / 4194304.0,
+            1000000.0 * (Float64) s_LatencyCycleMax / 4194304.0,
+            1000000.0 * s_LatencySecondSum / (Float64) s_LatencySamples);
+    }
+
+    GABLE_DestroyEngine(l_Engine);
+}
+
+static void B_RunLatencyBenchmarks ()
+{
+    printf("Scanline delivery latency (%zu frames per run):\n", s_FrameCount / 10);
+    B_BenchmarkLatency(false);
+    B_BenchmarkLatency(true);
+}
+
+static void B_RunPPUBenchmarks ()
+{
+    printf("PPU (%zu frames per run):\n", s_FrameCount / 10);
+    B_BenchmarkPPU(false, false, false);
+    B_BenchmarkPPU(true, false, false);
+    B_BenchmarkPPU(false, true, false);
+    B_BenchmarkPPU(false, false, true);
+    B_CheckPPUEquivalence(true, false, false);
+    B_CheckPPUEquivalence(false, true, false);
+    B_CheckPPUEquivalence(false, false, true);
+}
+
+// Static Functions - Init, Main, and Exit /////////////////////////////////////////////////////////
+
+static void B_AtStart (int argc, char** argv)
+{
+    if (argc > 1)
+    {
+        s_FrameCount = strtoul(argv[1], NULL, 10);
+        if (s_FrameCount == 0)
+        {
+            s_FrameCount = B_DEFAULT_FRAME_COUNT;
+        }
+    }
+
+    s_SourceFrame = GABLE_calloc(GABLE_PPU_SCREEN_BUFFER_SIZE, Uint32);
+    s_DestinationFrame = GABLE_calloc(GABLE_PPU_SCREEN_BUFFER_SIZE * GABLE_UPSCALER_MAX_SCALE *
+        GABLE_UPSCALER_MAX_SCALE, Uint32);
+    GABLE_pexpect(s_SourceFrame != NULL && s_DestinationFrame != NULL, "Failed to allocate frames");
+
+    // Fill the source frame with a tile-like pattern of the four DMG shades, so that the Scale2x
+    // filter sees a realistic mix of flat areas and edges.
+    static const Uint32 SHADES[4] = { 0xFFFFFFFF, 0xC0C0C0FF, 0x808080FF, 0x000000FF };
+    for (Index y = 0; y < GABLE_PPU_SCREEN_HEIGHT; ++y)
+    {
+        for (Index x = 0; x < GABLE_PPU_SCREEN_WIDTH; ++x)
+        {
+            s_SourceFrame[y * GABLE_PPU_SCREEN_WIDTH + x] = SHADES[((x / 8) ^ (y / 8) ^ ((x * y) >> 5)) & 3];
+        }
+    }
+}
+
+static void B_RunAudioBenchmarks ()
+{
+    printf("APU (%zu frames per run, headless PPU):\n", s_FrameCount / 10);
+    B_BenchmarkAudio(true, false, false);
+    B_BenchmarkAudio(true, true, false);
+    B_BenchmarkAudio(true, true, true);
+    B_BenchmarkAudio(false, true, false);
+    B_BenchmarkAPUCost(false);
+    B_BenchmarkAPUCost(true);
+    B_CheckVectorizedAudio(false, GABLE_AUDIO_SAMPLE_RATE);
+    B_CheckVectorizedAudio(true, GABLE_AUDIO_SAMPLE_RATE);
+    B_CheckVectorizedAudio(true, GABLE_AUDIO_MAX_SAMPLE_RATE);
+    B_CheckRateControl(false);
+    B_CheckRateControl(true);
+    B_CheckSequencer();
+}
+
+static void B_Main ()
+{
+    B_RunUpscalerBenchmarks();
+    B_RunPPUBenchmarks();
+    B_RunAudioBenchmarks();
+    B_RunLatencyBenchmarks();
+}
+
+static void B_AtExit ()
+{
+    GABLE_free(s_DestinationFrame);
+    GABLE_free(s_SourceFrame);
+}
+
+int main (int argc, char** argv)
+{
+    atexit(B_AtExit);
+    B_AtStart(argc, argv);
+    B_Main();
+
+    return 0;
+}
@@ -189,7 +189,7 @@
  */
 
 #pragma once
-#include <GABLE/Common.h>
+#include <GABLE/Capture.h>
 
 // Constants ///////////////////////////////////////////////////////////////////////////////////////
 
@@ -204,10 +204,49 @@
 #define GABLE_WAVE_RAM_NIBBLES 32
 
 /**
- * @brief The sample rate of the audio output by the GABLE Engine's APU, in Hz.
+ * @brief The default sample rate of the audio output by the GABLE Engine's APU, in Hz.
  */
 #define GABLE_AUDIO_SAMPLE_RATE 44100
 
+/**
+ * @brief The lowest sample rate the GABLE Engine's APU can be set to output audio at, in Hz.
+ */
+#define GABLE_AUDIO_MIN_SAMPLE_RATE 8000
+
+/**
+ * @brief The highest sample rate the GABLE Engine's APU can be set to output audio at, in Hz.
+ */
+#define GABLE_AUDIO_MAX_SAMPLE_RATE 192000
+
+/**
+ * @brief The most the vector mix kernels' output may differ from the scalar kernels' output by, in
+ *        either speaker, on any one sample. See `GABLE_SetVectorizedAudio`.
+ */
+#define GABLE_AUDIO_VECTOR_MAX_DEVIATION 1.0e-4f
+
+/**
+ * @brief The most the dynamic rate control nudges the APU's sample rate by, up or down, as a
+ *        fraction of it (0.5%). See `GABLE_SetAudioBufferFill`.
+ */
+#define GABLE_AUDIO_RATE_CONTROL_MAX_DELTA 0.005
+
+/**
+ * @brief The default capacity of the APU's audio sample ring, in samples (a little under 186
+ *        milliseconds of audio, at the default sample rate).
+ */
+#define GABLE_AUDIO_RING_DEFAULT_CAPACITY 8192
+
+/**
+ * @brief The minimum capacity of the APU's audio sample ring, in samples.
+ */
+#define GABLE_AUDIO_RING_MIN_CAPACITY 256
+
+/**
+ * @brief The maximum capacity of the APU's audio sample ring, in samples (a little under 24
+ *        seconds of audio, at the default sample rate).
+ */
+#define GABLE_AUDIO_RING_MAX_CAPACITY 1048576
+
 /**
  * @brief The maximum octave of the GABLE Engine's audio channels, from 0 to 7.
  */
@@ -564,6 +603,11 @@ GABLE_APU* GABLE_CreateAPU ();
 /**
  * @brief      Resets a GABLE Engine APU instance.
  * 
+ * The APU carries on from the engine cycle it was last rendered up to, so resetting a running
+ * engine's APU doesn't cause the cycles before that to be rendered again. The audio sample ring is
+ * left alone: any samples waiting in it can still be read out, and its read counter, which belongs
+ * to the thread reading samples out, is never written.
+ * 
  * @param      p_APU  A pointer to the GABLE Engine APU instance to reset.
  */
 void GABLE_ResetAPU (GABLE_APU* p_APU);
@@ -576,12 +620,35 @@ void GABLE_ResetAPU (GABLE_APU* p_APU);
 void GABLE_DestroyAPU (GABLE_APU* p_APU);
 
 /**
- * @brief      Ticks the GABLE Engine's APU component.
+ * @brief      Brings the GABLE Engine's APU component up to the engine's current cycle count.
+ * 
+ * Rather than being ticked on every cycle, the APU renders its audio in blocks: each call to this
+ * function advances the audio channels over all of the cycles elapsed since the previous call in
+ * one go, stopping only where the frame sequencer ticks or a sample is mixed. The mixed samples
+ * are pushed into the APU's audio sample ring, and passed to the mix callback, if one is set.
+ * 
+ * The engine calls this function before any access to the APU's registers, before any write to
+ * its wave pattern RAM or to the `DIV` register, before calling the frame rendered callback, and
+ * at the end of every call to `GABLE_CycleEngine`.
+ * 
+ * @param      p_APU     A pointer to the GABLE Engine APU instance.
+ * @param      p_Engine  A pointer to the GABLE Engine instance.
+ */
+void GABLE_SyncAPU (GABLE_APU* p_APU, GABLE_Engine* p_Engine);
+
+/**
+ * @brief      Mixes and pushes out the samples waiting in the GABLE Engine APU's mix block.
+ * 
+ * The samples in the mix block are only panned and scaled by the master volume once the block is
+ * mixed. Anything which writes `NR50` or `NR51` partway through a sync (eg. the music sequencer)
+ * must call this function first, so that the samples mixed before the write aren't mixed with the
+ * new settings. `GABLE_SyncAPU` pushes out the block before it returns, so writes made between
+ * syncs don't need to.
  * 
  * @param      p_APU     A pointer to the GABLE Engine APU instance.
  * @param      p_Engine  A pointer to the GABLE Engine instance.
  */
-void GABLE_TickAPU (GABLE_APU* p_APU, GABLE_Engine* p_Engine);
+void GABLE_FlushAPUMixBlock (GABLE_APU* p_APU, GABLE_Engine* p_Engine);
 
 // Public Functions - Memory Access ////////////////////////////////////////////////////////////////
 
@@ -939,13 +1006,182 @@ void GABLE_WriteNR44 (GABLE_APU* p_APU, Uint8 p_Register);
  * @brief      Sets the APU's audio mix callback function.
  * 
  * The audio mix callback function is called by the APU every time it generates a new audio sample.
- * The callback function is passed a pointer to the audio sample generated by the APU.
+ * The callback function is passed a pointer to the audio sample generated by the APU. Because the
+ * APU renders its audio in blocks, the callback is called in bursts, once per sample in each block,
+ * rather than at the exact cycle each sample was mixed at.
  * 
  * @param      p_Engine   A pointer to the GABLE Engine instance.
  * @param      p_Callback The audio mix callback function to set.
  */
 void GABLE_SetAudioMixCallback (GABLE_Engine* p_Engine, GABLE_AudioMixCallback p_Callback);
 
+/**
+ * @brief      Starts capturing the APU's mixed audio to a WAV file, at the APU's current sample rate.
+ *             Any audio capture already in progress is stopped first.
+ * 
+ * The APU hands each block of samples it mixes straight to the capture, which writes them out from
+ * a background writer thread. The capture is recorded at the sample rate the APU is mixing at when
+ * it starts, so the sample rate should not be changed until the capture is stopped.
+ * 
+ * @param      p_Engine   A pointer to the GABLE Engine instance.
+ * @param      p_Path     The path of the WAV file to write. See `GABLE_CreateAudioCapture`.
+ * @param      p_Format   The sample format to write.
+ * @param      p_Stems    `true` to also write one mono stem file per audio channel.
+ * 
+ * @return     `true` if the capture was started; `false` if its files could not be opened.
+ */
+Bool GABLE_StartAudioCapture (GABLE_Engine* p_Engine, const Char* p_Path,
+    GABLE_AudioCaptureFormat p_Format, Bool p_Stems);
+
+/**
+ * @brief      Stops the audio capture in progress, if any. Every sample mixed up to now is written
+ *             out, and the WAV file(s) finalized, before this function returns.
+ * 
+ * @param      p_Engine   A pointer to the GABLE Engine instance.
+ */
+void GABLE_StopAudioCapture (GABLE_Engine* p_Engine);
+
+/**
+ * @brief      Gets the audio capture in progress.
+ * 
+ * @param      p_Engine   A pointer to the GABLE Engine instance.
+ * 
+ * @return     A pointer to the audio capture in progress, or `NULL` if audio isn't being captured.
+ */
+GABLE_AudioCapture* GABLE_GetAudioCapture (GABLE_Engine* p_Engine);
+
+/**
+ * @brief      Enables or disables audio rendering. This is enabled by default.
+ * 
+ * While audio is disabled, the APU's channels are not ticked, and no audio samples are mixed, so
+ * the APU costs next to nothing; this is meant for hosts which never play the engine's audio, such
+ * as headless servers. Only the state which the APU's registers show is kept up to date: the
+ * channels' length timers and frequency sweep still run, and still switch the channels off (and
+ * clear their status bits in `NR52`) when they should. When audio is re-enabled, the channels
+ * carry on from their current registers, but the positions within their waveforms are not carried
+ * over.
+ * 
+ * Independently of this setting, the APU skips most of the work of any channel whose output can't
+ * change - one which is silent, muted, or not panned to either speaker.
+ * 
+ * @param      p_Engine   A pointer to the GABLE Engine instance.
+ * @param      p_Enabled  `true` to enable audio rendering; `false` to disable it.
+ */
+void GABLE_SetAudioEnabled (GABLE_Engine* p_Engine, Bool p_Enabled);
+
+/**
+ * @brief      Checks whether audio rendering is enabled.
+ * 
+ * @param      p_Engine  A pointer to the GABLE Engine instance.
+ * 
+ * @return     `true` if audio rendering is enabled; `false` otherwise.
+ */
+Bool GABLE_IsAudioEnabled (GABLE_Engine* p_Engine);
+
+/**
+ * @brief      Enables or disables band-limited synthesis. This is enabled by default.
+ * 
+ * While band-limited synthesis is enabled, every change in a channel's output is recorded as a
+ * step, at the exact cycle it happened on, and the steps are low-pass filtered with a windowed-sinc
+ * table as they are mixed, so that high-pitched channels don't alias. The mixed audio lags the
+ * emulation by eight samples (about 0.18 milliseconds, at the default sample rate). While it is
+ * disabled, the channels' outputs are simply point-sampled on each mix, which is slightly cheaper,
+ * but aliases badly.
+ * 
+ * @param      p_Engine   A pointer to the GABLE Engine instance.
+ * @param      p_Enabled  `true` to enable band-limited synthesis; `false` to disable it.
+ */
+void GABLE_SetBandLimitedAudio (GABLE_Engine* p_Engine, Bool p_Enabled);
+
+/**
+ * @brief      Checks whether band-limited synthesis is enabled.
+ * 
+ * @param      p_Engine  A pointer to the GABLE Engine instance.
+ * 
+ * @return     `true` if band-limited synthesis is enabled; `false` otherwise.
+ */
+Bool GABLE_IsBandLimitedAudio (GABLE_Engine* p_Engine);
+
+/**
+ * @brief      Enables or disables the vector mix kernels. This is enabled by default.
+ * 
+ * The APU mixes, pans, scales and high-pass filters its audio samples a block at a time. Where
+ * SSE2 is available, this is done four samples at a time, with vector kernels; otherwise, and while
+ * this is disabled, it is done one sample at a time, with scalar kernels. The scalar kernels are
+ * the reference the vector kernels are checked against: the two mix exactly alike, but the vector
+ * high-pass filter sums its terms in a different order, so its output can differ from the scalar
+ * filter's by a few rounding errors (no more than `GABLE_AUDIO_VECTOR_MAX_DEVIATION`).
+ * 
+ * @param      p_Engine   A pointer to the GABLE Engine instance.
+ * @param      p_Enabled  `true` to enable the vector mix kernels; `false` to use the scalar ones.
+ */
+void GABLE_SetVectorizedAudio (GABLE_Engine* p_Engine, Bool p_Enabled);
+
+/**
+ * @brief      Checks whether the vector mix kernels are enabled.
+ * 
+ * @param      p_Engine  A pointer to the GABLE Engine instance.
+ * 
+ * @return     `true` if the vector mix kernels are enabled; `false` otherwise.
+ */
+Bool GABLE_IsVectorizedAudio (GABLE_Engine* p_Engine);
+
+/**
+ * @brief      Sets the rate at which the APU mixes audio samples (eg. 22050, 32000, 44100, 48000 or
+ *             96000 Hz). The rate is kept exact over the long run, even where the APU's clock rate
+ *             isn't a whole multiple of it, so that the host's audio device neither starves nor
+ *             overflows. The default rate is `GABLE_AUDIO_SAMPLE_RATE`.
+ * 
+ * @param      p_Engine      A pointer to the GABLE Engine instance.
+ * @param      p_SampleRate  The new sample rate, in Hz. This value is clamped between
+ *                           `GABLE_AUDIO_MIN_SAMPLE_RATE` and `GABLE_AUDIO_MAX_SAMPLE_RATE`.
+ */
+void GABLE_SetAudioSampleRate (GABLE_Engine* p_Engine, Uint32 p_SampleRate);
+
+/**
+ * @brief      Feeds the host's audio buffer fill level back to the APU's dynamic rate control.
+ * 
+ * A host which paces the engine by its display's refresh rate consumes audio at a rate which
+ * doesn't quite match the rate the engine produces it at, so its audio buffer slowly fills up or
+ * runs dry. To stop this, the host should pass its buffer's fill level to this function regularly
+ * (eg. once per frame, or on each audio callback); the APU then nudges the rate it mixes samples
+ * at, by up to `GABLE_AUDIO_RATE_CONTROL_MAX_DELTA` either way, mixing slightly more samples while
+ * the buffer is less than half full, and slightly fewer while it is more than half full. The change
+ * in pitch is far too small to hear, and the buffer settles close to half full, so it can be kept
+ * small, to keep latency down.
+ * 
+ * The nominal sample rate, as set by `GABLE_SetAudioSampleRate`, is left unchanged, and with a fill
+ * level of exactly one half, the APU mixes at exactly that rate.
+ * 
+ * This function is safe to call from the host's audio thread while the engine runs on another. The
+ * new rate takes effect the next time the engine's thread brings the APU up to date, which it does
+ * at the end of every call to `GABLE_CycleEngine`.
+ * 
+ * @param      p_Engine  A pointer to the GABLE Engine instance.
+ * @param      p_Fill    The fraction of the host's audio buffer which is filled, from 0.0 (empty) to
+ *                       1.0 (full). This value is clamped to that range.
+ */
+void GABLE_SetAudioBufferFill (GABLE_Engine* p_Engine, Float32 p_Fill);
+
+/**
+ * @brief      Gets the rate the APU is actually mixing samples at, after the dynamic rate control's
+ *             adjustment.
+ * 
+ * @param      p_Engine  A pointer to the GABLE Engine instance.
+ * 
+ * @return     The effective sample rate, in Hz.
+ */
+Float64 GABLE_GetEffectiveAudioSampleRate (GABLE_Engine* p_Engine);
+
+/**
+ * @brief      Gets the rate at which the APU mixes audio samples.
+ * 
+ * @param      p_Engine  A pointer to the GABLE Engine instance.
+ * 
+ * @return     The sample rate, in Hz.
+ */
+Uint32 GABLE_GetAudioSampleRate (GABLE_Engine* p_Engine);
+
 /**
  * @brief      Gets the latest audio sample mixed by the GABLE Engine's APU.
  * 
@@ -954,3 +1190,74 @@ void GABLE_SetAudioMixCallback (GABLE_Engine* p_Engine, GABLE_AudioMixCallback p
  * @return     A pointer to the latest audio sample mixed by the APU.
  */
 const GABLE_AudioSample* GABLE_GetLatestAudioSample (GABLE_Engine* p_Engine);
+
+/**
+ * @brief      Sets the capacity of the APU's audio sample ring. Any samples still waiting in the
+ *             ring are discarded, and its underrun and overrun counts are reset.
+ * 
+ * The ring must not be read from another thread while its capacity is being changed.
+ * 
+ * @param      p_Engine    A pointer to the GABLE Engine instance.
+ * @param      p_Capacity  The new capacity, in samples. This value is rounded up to the next power
+ *                         of two, then clamped between `GABLE_AUDIO_RING_MIN_CAPACITY` and
+ *                         `GABLE_AUDIO_RING_MAX_CAPACITY`.
+ */
+void GABLE_SetAudioRingCapacity (GABLE_Engine* p_Engine, Count p_Capacity);
+
+/**
+ * @brief      Gets the capacity of the APU's audio sample ring.
+ * 
+ * @param      p_Engine  A pointer to the GABLE Engine instance.
+ * 
+ * @return     The capacity of the ring, in samples.
+ */
+Count GABLE_GetAudioRingCapacity (GABLE_Engine* p_Engine);
+
+/**
+ * @brief      Gets the number of audio samples waiting in the APU's audio sample ring. This may be
+ *             called from any thread.
+ * 
+ * @param      p_Engine  A pointer to the GABLE Engine instance.
+ * 
+ * @return     The number of audio samples which can be read with `GABLE_ReadAudioSamples`.
+ */
+Count GABLE_GetQueuedAudioSampleCount (GABLE_Engine* p_Engine);
+
+/**
+ * @brief      Reads a block of audio samples out of the APU's audio sample ring, oldest first.
+ * 
+ * The ring is a lock-free, single-producer, single-consumer queue: the thread running the engine
+ * pushes samples into it as they are mixed, and one other thread (typically the host's audio
+ * callback thread) may read them out with this function, without either side ever waiting on the
+ * other. If the ring is full when a sample is mixed, then that sample is dropped, and counted as
+ * an overrun. If fewer samples are waiting than were asked for, then the shortfall is counted as
+ * an underrun.
+ * 
+ * @param      p_Engine    A pointer to the GABLE Engine instance.
+ * @param      p_Samples   The buffer to copy the audio samples into.
+ * @param      p_Count     The number of audio samples to read.
+ * 
+ * @return     The number of audio samples read.
+ */
+Count GABLE_ReadAudioSamples (GABLE_Engine* p_Engine, GABLE_AudioSample* p_Samples, Count p_Count);
+
+/**
+ * @brief      Gets the number of audio samples which `GABLE_ReadAudioSamples` was asked for, but
+ *             which weren't waiting in the APU's audio sample ring. This may be called from any
+ *             thread.
+ * 
+ * @param      p_Engine  A pointer to the GABLE Engine instance.
+ * 
+ * @return     The number of samples lost to underruns.
+ */
+Uint64 GABLE_GetAudioUnderrunCount (GABLE_Engine* p_Engine);
+
+/**
+ * @brief      Gets the number of audio samples which were dropped because the APU's audio sample
+ *             ring was full. This may be called from any thread.
+ * 
+ * @param      p_Engine  A pointer to the GABLE Engine instance.
+ * 
+ * @return     The number of samples lost to overruns.
+ */
+Uint64 GABLE_GetAudioOverrunCount (GABLE_Engine* p_Engine);
@@ -0,0 +1,300 @@
+/**
+ * @file     GABLE/Capture.h
+ * @brief    The GABLE Engine's frame and audio capture structure and functions.
+ *
+ * The GABLE Engine's capture component records the PPU's completed frames and the APU's mixed
+ * audio samples to disk, for hosts which need to record gameplay without a display or an audio
+ * device (QA reproductions, trailers, regression artefacts, etc.). The host feeds the capture from
+ * its own frame rendered and audio mix callbacks; the frames and samples are then handed off to a
+ * background writer thread through a bounded queue, so that encoding and disk I/O never happen on
+ * the emulation thread.
+ *
+ * The capture supports the following output formats:
+ *
+ * - Y4M + WAV (`GABLE_CF_Y4M_WAV`): The frames are written to `<path>.y4m` as uncompressed 4:4:4
+ *   YCbCr video, and the audio is written to `<path>.wav` as 16-bit stereo PCM. Both files can be
+ *   read directly by most video tools (eg. `ffmpeg -i <path>.y4m -i <path>.wav ...`).
+ * - Delta-RLE (`GABLE_CF_DELTA_RLE`): The frames and audio are interleaved into a single, lossless
+ *   `<path>.gcap` container. Each frame is XORed against the frame before it, then run-length
+ *   encoded, which keeps captures of mostly-static Game Boy screens very small.
+ *
+ * Audio is kept frame-accurate with the video: the number of samples the APU mixes during a frame
+ * varies from frame to frame, and the APU may be set to mix at a rate other than
+ * `GABLE_AUDIO_SAMPLE_RATE`, so the writer thread resamples the audio captured along with each frame
+ * to exactly the number of samples that frame spans at the nominal rate.
+ *
+ * If the writer thread falls behind, and the queue fills up, then incoming frames are dropped
+ * rather than waiting on the writer thread. The audio captured along with a dropped frame is kept
+ * and written out along with the next frame which makes it into the queue, and the writer thread
+ * repeats the last frame it wrote in place of each dropped frame, so that the capture's timing is
+ * preserved. The number of dropped frames (and samples) can be queried at any time.
+ *
+ * Delta-RLE Container Layout (all values little-endian):
+ *
+ * - File Header:
+ *     - `Char[8]` Magic - `"GABLECAP"`
+ *     - `Uint16` Version - `1`
+ *     - `Uint16` Frame Width - `160`
+ *     - `Uint16` Frame Height - `144`
+ *     - `Uint16` Reserved - `0`
+ *     - `Uint32` Frame Rate Numerator - `4194304`
+ *     - `Uint32` Frame Rate Denominator - `70224`
+ *     - `Uint32` Audio Sample Rate - `44100`
+ *     - `Uint32` Frame Count (written when the capture is destroyed)
+ * - Frame Records (one per frame):
+ *     - `Uint32` Encoded Video Size, in bytes
+ *     - `Uint32` Audio Sample Count
+ *     - Encoded Video - A series of runs, each starting with a `Uint16` header. If bit 15 of the
+ *       header is set, then the next `Uint32` is repeated `(header & 0x7FFF) + 1` times; otherwise,
+ *       `header + 1` literal `Uint32`s follow. The decoded pixels are XORed against the previous
+ *       frame (all zeroes, for the first frame) to produce the frame's RGBA8888 pixels.
+ *     - Audio - `Int16` left and right samples, interleaved.
+ *
+ * Audio-Only Captures:
+ *
+ * For regression diffs and bug reports, the APU's mixed audio can also be captured on its own, at
+ * the exact rate and resolution the APU mixes it at, with no video and no resampling. An audio
+ * capture is fed by the APU directly, a whole mix block at a time, and is started and stopped with
+ * `GABLE_StartAudioCapture` and `GABLE_StopAudioCapture`; the host doesn't need to provide a mix
+ * callback. The samples are gathered into large blocks, which are handed off to a background writer
+ * thread, and written out as a 16-bit PCM or 32-bit float stereo WAV file. The WAV header's sizes
+ * are filled in once the capture is stopped.
+ *
+ * An audio capture can optionally also write one mono "stem" file per channel, holding that
+ * channel's DAC output, as sampled on each mix - before panning, the master volume and the
+ * high-pass filter are applied - which helps when debugging the mix.
+ */
+
+#pragma once
+#include <GABLE/Common.h>
+
+// Constants ///////////////////////////////////////////////////////////////////////////////////////
+
+/** @brief The default number of frames which can be waiting in the capture's queue. */
+#define GABLE_CAPTURE_DEFAULT_QUEUE_LENGTH 32
+
+/** @brief The maximum number of frames which can be waiting in the capture's queue. */
+#define GABLE_CAPTURE_MAX_QUEUE_LENGTH 256
+
+/**
+ * @brief The maximum number of audio samples which can be carried along with a single frame in the
+ *        capture's queue. This is enough for several frames' worth of audio, should frames be
+ *        dropped.
+ */
+#define GABLE_CAPTURE_MAX_FRAME_SAMPLES 4096
+
+/** @brief The number of audio samples in each block an audio capture hands off to its writer thread. */
+#define GABLE_AUDIO_CAPTURE_BLOCK_SAMPLES 16384
+
+/**
+ * @brief The number of blocks which can be waiting to be written in an audio capture's queue (about
+ *        six seconds of audio, at the default sample rate).
+ */
+#define GABLE_AUDIO_CAPTURE_QUEUE_LENGTH 16
+
+// Typedefs and Forward Declarations ///////////////////////////////////////////////////////////////
+
+/** @brief A forward-declaration of the GABLE Engine structure. */
+typedef struct GABLE_Engine GABLE_Engine;
+
+/** @brief A forward-declaration of the GABLE APU audio sample structure. */
+typedef struct GABLE_AudioSample GABLE_AudioSample;
+
+/** @brief A forward-declaration of the GABLE Engine's capture structure. */
+typedef struct GABLE_Capture GABLE_Capture;
+
+/** @brief A forward-declaration of the GABLE Engine's audio capture structure. */
+typedef struct GABLE_AudioCapture GABLE_AudioCapture;
+
+// Capture Format Enumeration //////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief An enumeration representing the output formats which can be written by the capture.
+ */
+typedef enum GABLE_CaptureFormat
+{
+    GABLE_CF_Y4M_WAV = 0,   ///< @brief Uncompressed Y4M video plus a 16-bit PCM WAV file.
+    GABLE_CF_DELTA_RLE      ///< @brief A single, lossless delta-RLE container file.
+} GABLE_CaptureFormat;
+
+/**
+ * @brief An enumeration representing the sample formats which can be written by an audio capture.
+ */
+typedef enum GABLE_AudioCaptureFormat
+{
+    GABLE_ACF_PCM16 = 0,    ///< @brief 16-bit signed integer PCM, clamped between -1.0 and 1.0.
+    GABLE_ACF_FLOAT32       ///< @brief 32-bit IEEE float, written exactly as the APU mixed it.
+} GABLE_AudioCaptureFormat;
+
+// Public Functions ////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Creates a new instance of the GABLE capture structure, opening its output files and
+ *        starting its writer thread.
+ *
+ * @param p_BasePath    The path to write the capture to, without an extension. The extension(s)
+ *                      are added based on the output format.
+ * @param p_Format      The output format to write.
+ * @param p_QueueLength The number of frames which can be waiting to be written before frames start
+ *                      being dropped. Pass zero to use `GABLE_CAPTURE_DEFAULT_QUEUE_LENGTH`. This
+ *                      value is clamped to `GABLE_CAPTURE_MAX_QUEUE_LENGTH`.
+ *
+ * @return A pointer to the newly created GABLE capture structure, or `NULL` if the output files
+ *         could not be opened.
+ */
+GABLE_Capture* GABLE_CreateCapture (const Char* p_BasePath, GABLE_CaptureFormat p_Format,
+    Count p_QueueLength);
+
+/**
+ * @brief Destroys an instance of the GABLE capture structure. Any frames still waiting in the
+ *        queue are written out, and the output files are finalized and closed.
+ *
+ * @param p_Capture A pointer to the GABLE capture structure to destroy.
+ */
+void GABLE_DestroyCapture (GABLE_Capture* p_Capture);
+
+/**
+ * @brief Submits a completed frame to the capture, along with all of the audio samples submitted
+ *        since the previous frame.
+ *
+ * This function never waits on the writer thread. If the capture's queue is full, then the frame
+ * is dropped instead.
+ *
+ * @param p_Capture A pointer to the GABLE capture structure.
+ * @param p_Frame   A pointer to the frame, in the same format as the PPU's screen buffer.
+ *
+ * @return `true` if the frame was queued; `false` if it was dropped.
+ */
+Bool GABLE_CaptureFrame (GABLE_Capture* p_Capture, const Uint32* p_Frame);
+
+/**
+ * @brief Submits a mixed audio sample to the capture. The sample is written out along with the next
+ *        frame submitted to the capture.
+ *
+ * @param p_Capture A pointer to the GABLE capture structure.
+ * @param p_Sample  A pointer to the audio sample.
+ */
+void GABLE_CaptureAudioSample (GABLE_Capture* p_Capture, const GABLE_AudioSample* p_Sample);
+
+/**
+ * @brief Gets the number of frames which have been submitted to the capture, including any which
+ *        were dropped.
+ *
+ * @param p_Capture A pointer to the GABLE capture structure.
+ *
+ * @return The number of frames submitted.
+ */
+Count GABLE_GetCaptureFrameCount (const GABLE_Capture* p_Capture);
+
+/**
+ * @brief Gets the number of frames which were dropped because the capture's writer thread could not
+ *        keep up.
+ *
+ * @param p_Capture A pointer to the GABLE capture structure.
+ *
+ * @return The number of frames dropped.
+ */
+Count GABLE_GetDroppedCaptureFrameCount (const GABLE_Capture* p_Capture);
+
+/**
+ * @brief Gets the number of audio samples which were dropped because too many frames were dropped
+ *        in a row to carry their audio along with the next queued frame. The writer thread fills in
+ *        for dropped samples when it resamples each frame's audio, so the capture stays in sync.
+ *
+ * @param p_Capture A pointer to the GABLE capture structure.
+ *
+ * @return The number of audio samples dropped.
+ */
+Count GABLE_GetDroppedCaptureSampleCount (const GABLE_Capture* p_Capture);
+
+/**
+ * @brief Checks whether the capture's writer thread has failed to write to its output files. Once a
+ *        write fails, the writer thread discards every frame submitted afterwards.
+ *
+ * @param p_Capture A pointer to the GABLE capture structure.
+ *
+ * @return `true` if a write has failed; `false` otherwise.
+ */
+Bool GABLE_HasCaptureFailed (const GABLE_Capture* p_Capture);
+
+// Public Functions - Audio Capture ////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Creates a new instance of the GABLE audio capture structure, opening its WAV file(s) and
+ *        starting its writer thread. Most hosts should use `GABLE_StartAudioCapture` instead.
+ *
+ * @param p_Path        The path of the WAV file to write. If stems are written, then they are
+ *                      written next to it, with `.pc1.wav`, `.pc2.wav`, `.wc.wav` and `.nc.wav` in
+ *                      place of its `.wav` extension.
+ * @param p_Format      The sample format to write.
+ * @param p_SampleRate  The sample rate to record in the WAV file(s), in Hz.
+ * @param p_Stems       `true` to also write one mono stem file per audio channel.
+ *
+ * @return A pointer to the newly created audio capture, or `NULL` if its files could not be opened.
+ */
+GABLE_AudioCapture* GABLE_CreateAudioCapture (const Char* p_Path, GABLE_AudioCaptureFormat p_Format,
+    Uint32 p_SampleRate, Bool p_Stems);
+
+/**
+ * @brief Destroys an instance of the GABLE audio capture structure. Any samples still waiting to be
+ *        written are written out, then the WAV headers are filled in and the files closed.
+ *
+ * @param p_Capture A pointer to the audio capture to destroy.
+ */
+void GABLE_DestroyAudioCapture (GABLE_AudioCapture* p_Capture);
+
+/**
+ * @brief Submits a block of mixed audio samples to an audio capture. This function never waits on
+ *        the writer thread; if its queue is full, then the samples are dropped instead.
+ *
+ * @param p_Capture     A pointer to the audio capture.
+ * @param p_Left        The left speaker's samples.
+ * @param p_Right       The right speaker's samples.
+ * @param p_Channels    The four audio channels' DAC outputs, one array per channel, for the stems;
+ *                      or `NULL`, if the capture isn't writing stems.
+ * @param p_Count       The number of samples in the block.
+ */
+void GABLE_CaptureAudioBlock (GABLE_AudioCapture* p_Capture, const Float32* p_Left,
+    const Float32* p_Right, const Float32* const* p_Channels, Count p_Count);
+
+/**
+ * @brief Checks whether an audio capture is writing per-channel stem files.
+ *
+ * @param p_Capture A pointer to the audio capture.
+ *
+ * @return `true` if stems are being written; `false` otherwise.
+ */
+Bool GABLE_HasAudioCaptureStems (const GABLE_AudioCapture* p_Capture);
+
+/**
+ * @brief Gets the number of audio samples which were dropped because the audio capture's writer
+ *        thread could not keep up.
+ *
+ * @param p_Capture A pointer to the audio capture.
+ *
+ * @return The number of audio samples dropped.
+ */
+Count GABLE_GetDroppedAudioCaptureSampleCount (const GABLE_AudioCapture* p_Capture);
+
+/**
+ * @brief Checks whether the audio capture's writer thread has failed to write to its files. Once a
+ *        write fails, the writer thread discards every block submitted afterwards.
+ *
+ * @param p_Capture A pointer to the audio capture.
+ *
+ * @return `true` if a write has failed; `false` otherwise.
+ */
+Bool GABLE_HasAudioCaptureFailed (const GABLE_AudioCapture* p_Capture);
+
+// Public Functions - High-Level Functions /////////////////////////////////////////////////////////
+
+/**
+ * @brief Submits the engine's current screen buffer to the capture. This is meant to be called from
+ *        the host's frame rendered callback.
+ *
+ * @param p_Engine  A pointer to the GABLE Engine structure.
+ * @param p_Capture A pointer to the GABLE capture structure.
+ *
+ * @return `true` if the frame was queued; `false` if it was dropped.
+ */
+Bool GABLE_CaptureScreenBuffer (GABLE_Engine* p_Engine, GABLE_Capture* p_Capture);
@@ -309,6 +309,11 @@ typedef enum GABLE_HardwarePort
     GABLE_HP_NR50      = 0xFF24,    ///< @brief `NR50` - Channel Control / Volume
     GABLE_HP_NR51      = 0xFF25,    ///< @brief `NR51` - Selection of Sound Output Terminal
     GABLE_HP_NR52      = 0xFF26,    ///< @brief `NR52` - Sound On/Off
+    GABLE_HP_SQAH      = 0xFF27,    ///< @brief `SQAH` - GABLE Only - Sequencer Data Address, High Byte
+    GABLE_HP_SQAL      = 0xFF28,    ///< @brief `SQAL` - GABLE Only - Sequencer Data Address, Low Byte
+    GABLE_HP_SQC       = 0xFF29,    ///< @brief `SQC` - GABLE Only - Sequencer Control
+    GABLE_HP_SQT       = 0xFF2A,    ///< @brief `SQT` - GABLE Only - Sequencer Tempo
+    GABLE_HP_SQM       = 0xFF2B,    ///< @brief `SQM` - GABLE Only - Sequencer Marker
     GABLE_HP_LCDC      = 0xFF40,    ///< @brief `LCDC` - LCD Control / Display Control
     GABLE_HP_STAT      = 0xFF41,    ///< @brief `STAT` - LCD Status / Display Status
     GABLE_HP_SCY       = 0xFF42,    ///< @brief `SCY` - Background Viewport Scroll Y
@@ -341,6 +346,9 @@ typedef enum GABLE_HardwarePort
     GABLE_HP_DSBKL     = 0xFF73,    ///< @brief `DSBKL` - GABLE Only - Data Store Bank Number, Low Byte
     GABLE_HP_PCM12     = 0xFF76,    ///< @brief `PCM12` - CGB Only - PCM Channel 1/2 Output
     GABLE_HP_PCM34     = 0xFF77,    ///< @brief `PCM34` - CGB Only - PCM Channel 3/4 Output
+    GABLE_HP_LTAH      = 0xFF78,    ///< @brief `LTAH` - GABLE Only - PPU Line Table Address, High Byte
+    GABLE_HP_LTAL      = 0xFF79,    ///< @brief `LTAL` - GABLE Only - PPU Line Table Address, Low Byte
+    GABLE_HP_LTC       = 0xFF7A,    ///< @brief `LTC` - GABLE Only - PPU Line Table Control
     GABLE_HP_IE        = 0xFFFF     ///< @brief `IE` - Interrupt Enable
 } GABLE_HardwarePort;
 
@@ -408,6 +416,11 @@ typedef enum GABLE_HardwarePort
 #define G_NR50              (GABLE_HP_NR50 & 0xFF)
 #define G_NR51              (GABLE_HP_NR51 & 0xFF)
 #define G_NR52              (GABLE_HP_NR52 & 0xFF)
+#define G_SQAH              (GABLE_HP_SQAH & 0xFF)
+#define G_SQAL              (GABLE_HP_SQAL & 0xFF)
+#define G_SQC               (GABLE_HP_SQC & 0xFF)
+#define G_SQT               (GABLE_HP_SQT & 0xFF)
+#define G_SQM               (GABLE_HP_SQM & 0xFF)
 #define G_LCDC              (GABLE_HP_LCDC & 0xFF)
 #define G_STAT              (GABLE_HP_STAT & 0xFF)
 #define G_SCY               (GABLE_HP_SCY & 0xFF)
@@ -440,6 +453,9 @@ typedef enum GABLE_HardwarePort
 #define G_DSBKL             (GABLE_HP_DSBKL & 0xFF)
 #define G_PCM12             (GABLE_HP_PCM12 & 0xFF)
 #define G_PCM34             (GABLE_HP_PCM34 & 0xFF)
+#define G_LTAH              (GABLE_HP_LTAH & 0xFF)
+#define G_LTAL              (GABLE_HP_LTAL & 0xFF)
+#define G_LTC               (GABLE_HP_LTC & 0xFF)
 #define G_IE                (GABLE_HP_IE & 0xFF)
 
 #define G_AUD1SWEEP         G_NR10
@@ -582,6 +598,32 @@ typedef enum GABLE_HardwarePort
 #define G_GRPMF_DMG          0b00000000
 #define G_GRPMB_MODE         0
 
+#define G_SQCF_PLAY_MUSIC    0x01
+#define G_SQCF_STOP_MUSIC    0x02
+#define G_SQCF_PAUSE_MUSIC   0x03
+#define G_SQCF_RESUME_MUSIC  0x04
+#define G_SQCF_STOP_SFX      0x05
+#define G_SQCF_PLAY_SFX      0x10
+#define G_SQCF_SFX_CHANNELS  0b00001111
+#define G_SQCF_PAUSED        0b01000000
+#define G_SQCF_PLAYING       0b10000000
+#define G_SQCB_PAUSED        6
+#define G_SQCB_PLAYING       7
+
+#define G_LTCF_ON            0b10000000
+#define G_LTCF_OFF           0b00000000
+#define G_LTCF_BGP           0b00010000
+#define G_LTCF_WX            0b00001000
+#define G_LTCF_WY            0b00000100
+#define G_LTCF_SCX           0b00000010
+#define G_LTCF_SCY           0b00000001
+#define G_LTCB_ON            7
+#define G_LTCB_BGP           4
+#define G_LTCB_WX            3
+#define G_LTCB_WY            2
+#define G_LTCB_SCX           1
+#define G_LTCB_SCY           0
+
 #define G_IEF_RTC            0b00100000
 #define G_IEF_JOYPAD         0b00010000
 #define G_IEF_NET            0b00001000
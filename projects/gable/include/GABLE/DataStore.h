@@ -122,6 +122,35 @@ void GABLE_DestroyDataStore (GABLE_DataStore* p_DataStore);
  */
 Bool GABLE_ReadDataStoreByte (const GABLE_DataStore* p_DataStore, Uint16 p_Address, Uint8* p_Value);
 
+/**
+ * @brief      Reads a block of bytes from the data store, starting at the specified address. Bytes
+ *             at addresses past the first bank are read from the current bank.
+ * 
+ * @param      p_DataStore  A pointer to the GABLE Engine data store instance.
+ * @param      p_Address     The address in the data store to start reading from.
+ * @param      p_Buffer      A pointer to the buffer to store the read bytes in.
+ * @param      p_Length      The number of bytes to read.
+ * 
+ * @return     `true` if the read operation was successful, `false` otherwise.
+ */
+Bool GABLE_ReadDataStoreBlock (const GABLE_DataStore* p_DataStore, Uint16 p_Address, Uint8* p_Buffer,
+    Size p_Length);
+
+/**
+ * @brief      Reads a block of bytes from the given bank of the data store, regardless of which
+ *             bank is currently selected.
+ * 
+ * @param      p_DataStore  A pointer to the GABLE Engine data store instance.
+ * @param      p_BankNumber  The number of the bank to read from.
+ * @param      p_Offset      The offset within the bank to start reading from.
+ * @param      p_Buffer      A pointer to the buffer to store the read bytes in.
+ * @param      p_Length      The number of bytes to read. The block may not run past the end of the bank.
+ * 
+ * @return     `true` if the read operation was successful, `false` otherwise.
+ */
+Bool GABLE_ReadDataStoreBankBlock (const GABLE_DataStore* p_DataStore, Uint16 p_BankNumber,
+    Uint16 p_Offset, Uint8* p_Buffer, Size p_Length);
+
 // Public Functions - Hardware Register Getters ////////////////////////////////////////////////////
 
 /**
@@ -80,6 +80,11 @@ typedef struct GABLE_Joypad GABLE_Joypad;
  */
 typedef struct GABLE_NetworkContext GABLE_NetworkContext;
 
+/**
+ * @brief      Forward declaration of the GABLE Engine Music Sequencer structure.
+ */
+typedef struct GABLE_Sequencer GABLE_Sequencer;
+
 /**
  * @brief      The GABLE Engine's core context structure.
  */
@@ -171,6 +176,21 @@ Bool GABLE_CycleEngine (GABLE_Engine* p_Engine, Count p_Cycles);
  */
 Bool GABLE_ReadByte (GABLE_Engine* p_Engine, Uint16 p_Address, Uint8* p_Value);
 
+/**
+ * @brief      Reads a block of bytes from the GABLE Engine's memory map, starting at the specified
+ *             address. If the block lies entirely within the data store, VRAM, SRAM, WRAM or echo
+ *             RAM, then it is copied straight out of the backing memory; otherwise, it is read one
+ *             byte at a time, as with `GABLE_ReadByte`.
+ * 
+ * @param      p_Engine         A pointer to the GABLE Engine instance.
+ * @param      p_Address        The address to start reading from.
+ * @param      p_Buffer         A pointer to the buffer to store the read bytes.
+ * @param      p_Length         The number of bytes to read.
+ * 
+ * @return     `true` if the memory map was read from successfully; `false` otherwise.
+ */
+Bool GABLE_ReadBlock (GABLE_Engine* p_Engine, Uint16 p_Address, Uint8* p_Buffer, Size p_Length);
+
 /**
  * @brief      Reads a word from the specified address in the GABLE Engine's memory map.
  * 
@@ -415,6 +435,15 @@ GABLE_Joypad* GABLE_GetJoypad (GABLE_Engine* p_Engine);
  */
 GABLE_NetworkContext* GABLE_GetNetwork (GABLE_Engine* p_Engine);
 
+/**
+ * @brief      Gets the GABLE Engine's music sequencer instance.
+ * 
+ * @param      p_Engine  A pointer to the GABLE Engine instance.
+ * 
+ * @return     A pointer to the GABLE Engine's music sequencer instance.
+ */
+GABLE_Sequencer* GABLE_GetSequencer (GABLE_Engine* p_Engine);
+
 // Public Functions - User Data ////////////////////////////////////////////////////////////////////
 
 /**
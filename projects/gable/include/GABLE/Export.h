@@ -0,0 +1,253 @@
+/**
+ * @file     GABLE/Export.h
+ * @brief    The GABLE Engine's shared-memory frame and audio export structures and functions.
+ *
+ * The GABLE Engine's export component publishes completed frames and mixed audio samples into a
+ * named POSIX shared-memory object, so that tools running in other processes (streamers, recorders,
+ * ML agents, etc.) can watch the engine without each running a copy of it. The host feeds the
+ * export from its own frame rendered and audio mix callbacks, in the same manner as a capture.
+ *
+ * The shared-memory object holds a header, followed by a ring of frame slots, followed by a ring of
+ * audio blocks. Each slot and block is guarded by a sequence counter, in the manner of a seqlock:
+ * the engine makes the counter odd before it starts writing, and even again once it is done. A
+ * reader notes the counter before reading, and checks that it hasn't changed afterwards; if it has,
+ * then the engine overwrote the slot in the meantime, and the read has to be thrown away. Neither
+ * side ever waits on the other, so a slow (or stalled, or crashed) reader can never hold up the
+ * engine.
+ *
+ * Readers open the export by name, then read frames in place, straight out of shared memory,
+ * without copying them:
+ *
+ * @code
+ * GABLE_Export* l_Export = GABLE_OpenExport("/gable");
+ * Uint64 l_Frame = GABLE_GetLatestExportedFrame(l_Export);
+ * Uint64 l_Ticket = 0;
+ * const Uint32* l_Pixels = GABLE_BeginExportedFrameRead(l_Export, l_Frame, &l_Ticket);
+ * if (l_Pixels != NULL)
+ * {
+ *     // ... use the pixels ...
+ *     if (GABLE_EndExportedFrameRead(l_Export, l_Frame, l_Ticket) == false)
+ *     {
+ *         // The frame was overwritten while it was being used. Discard whatever was done with it.
+ *     }
+ * }
+ * @endcode
+ *
+ * Frames stay readable until the engine comes back around to their slot, so a reader has as many
+ * frames' worth of time as the export has frame slots, less one, to finish with a frame.
+ */
+
+#pragma once
+#include <GABLE/Common.h>
+
+// Constants ///////////////////////////////////////////////////////////////////////////////////////
+
+/** @brief The magic number at the start of an export's shared-memory object (`"GBLX"`). */
+#define GABLE_EXPORT_MAGIC 0x584C4247
+
+/** @brief The version of the export's shared-memory layout. */
+#define GABLE_EXPORT_VERSION 1
+
+/** @brief The default number of frame slots in an export. */
+#define GABLE_EXPORT_DEFAULT_FRAME_SLOTS 4
+
+/** @brief The maximum number of frame slots in an export. */
+#define GABLE_EXPORT_MAX_FRAME_SLOTS 64
+
+/** @brief The number of audio samples in each of an export's audio blocks. */
+#define GABLE_EXPORT_AUDIO_BLOCK_SAMPLES 512
+
+/** @brief The number of audio blocks in an export's audio ring (about three quarters of a second). */
+#define GABLE_EXPORT_AUDIO_BLOCK_COUNT 64
+
+// Typedefs and Forward Declarations ///////////////////////////////////////////////////////////////
+
+/** @brief A forward-declaration of the GABLE Engine structure. */
+typedef struct GABLE_Engine GABLE_Engine;
+
+/** @brief A forward-declaration of the GABLE APU audio sample structure. */
+typedef struct GABLE_AudioSample GABLE_AudioSample;
+
+/** @brief A forward-declaration of the GABLE Engine's export structure. */
+typedef struct GABLE_Export GABLE_Export;
+
+// Shared-Memory Layout Structures /////////////////////////////////////////////////////////////////
+
+/**
+ * @brief The header at the start of an export's shared-memory object.
+ *
+ * The sequence counters in this header, and in the slots and blocks below, are only ever updated
+ * with atomic operations, and should only be read with them.
+ */
+typedef struct GABLE_ExportHeader
+{
+    Uint32  m_Magic;                ///< @brief The magic number, `GABLE_EXPORT_MAGIC`.
+    Uint32  m_Version;              ///< @brief The layout version, `GABLE_EXPORT_VERSION`.
+    Uint32  m_FrameWidth;           ///< @brief The width of each frame, in pixels.
+    Uint32  m_FrameHeight;          ///< @brief The height of each frame, in pixels.
+    Uint32  m_FrameSlotCount;       ///< @brief The number of frame slots.
+    Uint32  m_AudioBlockCount;      ///< @brief The number of audio blocks.
+    Uint32  m_AudioBlockSamples;    ///< @brief The number of audio samples in each audio block.
+    Uint32  m_AudioSampleRate;      ///< @brief The sample rate of the audio, in Hz. Updated by `GABLE_ExportScreenBuffer`.
+    Uint64  m_FrameOffset;          ///< @brief The offset of the first frame slot, in bytes.
+    Uint64  m_AudioOffset;          ///< @brief The offset of the first audio block, in bytes.
+    Uint64  m_LatestFrame;          ///< @brief The number of the latest frame published, starting from 1.
+    Uint64  m_LatestAudioBlock;     ///< @brief The number of the latest audio block published, starting from 1.
+    Uint64  m_Reserved[2];          ///< @brief Reserved; pads the header to 64 bytes.
+} GABLE_ExportHeader;
+
+/**
+ * @brief A frame slot in an export's shared-memory object. Frame number `n` is held in slot
+ *        `(n - 1) % m_FrameSlotCount`.
+ */
+typedef struct GABLE_ExportFrameSlot
+{
+    Uint64  m_Sequence;             ///< @brief The slot's sequence counter. Odd while the slot is being written.
+    Uint64  m_FrameNumber;          ///< @brief The number of the frame held in the slot.
+    Uint64  m_Reserved[6];          ///< @brief Reserved; pads the slot's header to 64 bytes.
+    Uint32  m_Pixels[160 * 144];    ///< @brief The frame's pixels, in the same format as the PPU's screen buffer.
+} GABLE_ExportFrameSlot;
+
+/**
+ * @brief An audio block in an export's shared-memory object. Block number `n` is held in block
+ *        `(n - 1) % m_AudioBlockCount`.
+ */
+typedef struct GABLE_ExportAudioBlock
+{
+    Uint64  m_Sequence;             ///< @brief The block's sequence counter. Odd while the block is being written.
+    Uint64  m_BlockNumber;          ///< @brief The number of the block.
+    Uint64  m_Reserved[6];          ///< @brief Reserved; pads the block's header to 64 bytes.
+    Float32 m_Samples[GABLE_EXPORT_AUDIO_BLOCK_SAMPLES * 2];  ///< @brief Interleaved left and right audio samples.
+} GABLE_ExportAudioBlock;
+
+// Public Functions - Engine Side //////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Creates a new export, along with its shared-memory object. Any existing shared-memory
+ *        object with the same name is replaced.
+ *
+ * @param p_Name            The name of the shared-memory object, which should start with a `/`
+ *                          (eg. `"/gable"`).
+ * @param p_FrameSlotCount  The number of frame slots. Pass zero to use
+ *                          `GABLE_EXPORT_DEFAULT_FRAME_SLOTS`. This value is clamped between 2 and
+ *                          `GABLE_EXPORT_MAX_FRAME_SLOTS`.
+ *
+ * @return A pointer to the new export, or `NULL` if the shared-memory object could not be created.
+ */
+GABLE_Export* GABLE_CreateExport (const Char* p_Name, Count p_FrameSlotCount);
+
+/**
+ * @brief Publishes a completed frame to the export. This never waits on any readers.
+ *
+ * @param p_Export  A pointer to an export created with `GABLE_CreateExport`.
+ * @param p_Frame   A pointer to the frame, in the same format as the PPU's screen buffer.
+ */
+void GABLE_ExportFrame (GABLE_Export* p_Export, const Uint32* p_Frame);
+
+/**
+ * @brief Adds a mixed audio sample to the export. The sample is published once the audio block it
+ *        was added to is full.
+ *
+ * @param p_Export  A pointer to an export created with `GABLE_CreateExport`.
+ * @param p_Sample  A pointer to the audio sample.
+ */
+void GABLE_ExportAudioSample (GABLE_Export* p_Export, const GABLE_AudioSample* p_Sample);
+
+// Public Functions - Reader Side //////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Opens an existing export's shared-memory object, for reading.
+ *
+ * @param p_Name The name the export was created with.
+ *
+ * @return A pointer to the opened export, or `NULL` if the export could not be opened, or if its
+ *         layout is not one this build of the engine understands.
+ */
+GABLE_Export* GABLE_OpenExport (const Char* p_Name);
+
+/**
+ * @brief Gets the number of the latest frame published to the export.
+ *
+ * @param p_Export  A pointer to the export.
+ *
+ * @return The number of the latest frame, starting from 1, or 0 if no frames have been published.
+ */
+Uint64 GABLE_GetLatestExportedFrame (const GABLE_Export* p_Export);
+
+/**
+ * @brief Begins reading a frame in place, straight out of the export's shared memory.
+ *
+ * @param p_Export      A pointer to the export.
+ * @param p_FrameNumber The number of the frame to read.
+ * @param p_Ticket      Receives the ticket to pass to `GABLE_EndExportedFrameRead`.
+ *
+ * @return A pointer to the frame's pixels, or `NULL` if the frame is being written, or is no longer
+ *         (or not yet) held by the export.
+ */
+const Uint32* GABLE_BeginExportedFrameRead (const GABLE_Export* p_Export, Uint64 p_FrameNumber,
+    Uint64* p_Ticket);
+
+/**
+ * @brief Finishes reading a frame started with `GABLE_BeginExportedFrameRead`.
+ *
+ * @param p_Export      A pointer to the export.
+ * @param p_FrameNumber The number of the frame which was read.
+ * @param p_Ticket      The ticket given by `GABLE_BeginExportedFrameRead`.
+ *
+ * @return `true` if the frame was left untouched while it was being read; `false` if it was
+ *         overwritten, in which case anything read from it must be discarded.
+ */
+Bool GABLE_EndExportedFrameRead (const GABLE_Export* p_Export, Uint64 p_FrameNumber, Uint64 p_Ticket);
+
+/**
+ * @brief Gets the number of the latest audio block published to the export.
+ *
+ * @param p_Export  A pointer to the export.
+ *
+ * @return The number of the latest audio block, starting from 1, or 0 if none have been published.
+ */
+Uint64 GABLE_GetLatestExportedAudioBlock (const GABLE_Export* p_Export);
+
+/**
+ * @brief Copies an audio block out of the export.
+ *
+ * @param p_Export      A pointer to the export.
+ * @param p_BlockNumber The number of the audio block to read.
+ * @param p_Samples     Receives the block's `GABLE_EXPORT_AUDIO_BLOCK_SAMPLES` audio samples.
+ *
+ * @return `true` if the block was read; `false` if it is being written, or is no longer (or not yet)
+ *         held by the export.
+ */
+Bool GABLE_ReadExportedAudioBlock (const GABLE_Export* p_Export, Uint64 p_BlockNumber,
+    GABLE_AudioSample* p_Samples);
+
+// Public Functions - Both Sides ///////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Destroys an export. On the engine side, this also removes the export's shared-memory
+ *        object; readers which still have it open can keep on reading the last frames published.
+ *
+ * @param p_Export A pointer to the export to destroy.
+ */
+void GABLE_DestroyExport (GABLE_Export* p_Export);
+
+/**
+ * @brief Gets a pointer to the header of the export's shared-memory object.
+ *
+ * @param p_Export A pointer to the export.
+ *
+ * @return A pointer to the header.
+ */
+const GABLE_ExportHeader* GABLE_GetExportHeader (const GABLE_Export* p_Export);
+
+// Public Functions - High-Level Functions /////////////////////////////////////////////////////////
+
+/**
+ * @brief Publishes the engine's current screen buffer to the export, and updates the export's audio
+ *        sample rate to match the engine's. This is meant to be called from the host's frame
+ *        rendered callback.
+ *
+ * @param p_Engine  A pointer to the GABLE Engine structure.
+ * @param p_Export  A pointer to an export created with `GABLE_CreateExport`.
+ */
+void GABLE_ExportScreenBuffer (GABLE_Engine* p_Engine, GABLE_Export* p_Export);
@@ -16,9 +16,13 @@ extern "C" {
 #include <GABLE/DataStore.h>
 #include <GABLE/RAM.h>
 #include <GABLE/APU.h>
+#include <GABLE/Sequencer.h>
 #include <GABLE/PPU.h>
 #include <GABLE/Joypad.h>
 #include <GABLE/Network.h>
+#include <GABLE/Upscaler.h>
+#include <GABLE/Capture.h>
+#include <GABLE/Export.h>
 #include <GABLE/Instructions.h>
 #include <GABLE/Stdlib.h>
 
@@ -174,6 +174,27 @@
  * - `GRPM` (PPU Graphics Mode): The PPU graphics mode register is used to set the PPU's graphics mode.
  *   Setting this register to 0 indicates that the PPU is in DMG graphics mode, while setting it to
  *   any non-zero value indicates that the PPU is in CGB graphics mode.
+ * - `LTAH` and `LTAL` (Line Table Address, High and Low Bytes): The line table address registers
+ *   hold the address, in the engine's memory map, of the PPU's line table. More on the line table
+ *   below.
+ * - `LTC` (Line Table Control): The line table control register enables the line table, and selects
+ *   which registers each of its entries holds. The bits of this register are as follows:
+ *       - Bit 7 - Line Table Enable: Set to apply the line table at the start of each scanline.
+ *       - Bit 4 - `BGP` Entry: Set if each entry holds a value for the `BGP` register.
+ *       - Bit 3 - `WX` Entry: Set if each entry holds a value for the `WX` register.
+ *       - Bit 2 - `WY` Entry: Set if each entry holds a value for the `WY` register.
+ *       - Bit 1 - `SCX` Entry: Set if each entry holds a value for the `SCX` register.
+ *       - Bit 0 - `SCY` Entry: Set if each entry holds a value for the `SCY` register.
+ * 
+ * The PPU's line table allows raster effects (wavy backgrounds, parallax splits, per-line palette
+ * changes, etc.) to be carried out without requesting an `LCD_STAT` interrupt on every scanline. The
+ * line table holds one entry for each of the 144 visible scanlines, one after the other, starting at
+ * the address in the `LTAH` and `LTAL` registers. Each entry holds one byte for each register
+ * selected in the `LTC` register, in the order `SCY`, `SCX`, `WY`, `WX`, `BGP`, with unselected
+ * registers left out. If the line table is enabled, then, at the start of each visible scanline's
+ * object scan, the PPU reads that scanline's entry and writes its values to their registers, just as
+ * if the program had written them. The line table can be placed anywhere in the memory map, and can
+ * be changed at any time; changes take effect from the next scanline.
  * 
  * The PPU component is responsible for the following hardware interrupts:
  * 
@@ -384,6 +405,9 @@
 /** @brief The number of tiles that can be stored in the tile data region of a VRAM bank. */
 #define GABLE_PPU_VRAM_TILE_COUNT 384
 
+/** @brief The number of tile animation slots. */
+#define GABLE_PPU_TILE_ANIMATION_SLOT_COUNT 8
+
 // Typedefs and Forward Declarations ///////////////////////////////////////////////////////////////
 
 /** @brief A forward-declaration of the GABLE Engine structure. */
@@ -395,6 +419,12 @@ typedef struct GABLE_PPU GABLE_PPU;
 /** @brief A pointer to a callback function that is called when a frame is rendered by the PPU. */
 typedef void (*GABLE_FrameRenderedCallback) (GABLE_Engine*, GABLE_PPU*);
 
+/**
+ * @brief A pointer to a callback function that is called when a scanline is rendered by the PPU. It
+ *        is given the number of the scanline, and a pointer to its 160 pixels in the screen buffer.
+ */
+typedef void (*GABLE_ScanlineRenderedCallback) (GABLE_Engine*, GABLE_PPU*, Uint8, const Uint32*);
+
 // Display Mode Enumeration ////////////////////////////////////////////////////////////////////////
 
 /**
@@ -649,6 +679,27 @@ typedef union GABLE_HDMAControl
     Uint8 m_Register;  ///< @brief The raw register value.
 } GABLE_HDMAControl;
 
+// Line Table Control Union ///////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief A union representing the PPU's `LTC` line table control register.
+ */
+typedef union GABLE_LineTableControl
+{
+    struct
+    {
+        Uint8 m_SCYEntry : 1;   ///< @brief Set if each line table entry holds a value for `SCY`.
+        Uint8 m_SCXEntry : 1;   ///< @brief Set if each line table entry holds a value for `SCX`.
+        Uint8 m_WYEntry : 1;    ///< @brief Set if each line table entry holds a value for `WY`.
+        Uint8 m_WXEntry : 1;    ///< @brief Set if each line table entry holds a value for `WX`.
+        Uint8 m_BGPEntry : 1;   ///< @brief Set if each line table entry holds a value for `BGP`.
+        Uint8 : 2;
+        Uint8 m_Enable : 1;     ///< @brief Set to apply the line table at the start of each scanline.
+    };
+
+    Uint8 m_Register;  ///< @brief The raw register value.
+} GABLE_LineTableControl;
+
 // Palette Specification Union /////////////////////////////////////////////////////////////////////
 
 /**
@@ -807,8 +858,9 @@ void GABLE_ResetPPU (GABLE_PPU* p_PPU);
 void GABLE_TickPPU (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine);
 
 /**
- * @brief Ticks the PPU's OAM DMA transfer process, copying the next byte of data from the engine's
- *        memory to the OAM buffer.
+ * @brief Ticks the PPU's OAM DMA transfer process. All 160 bytes of the transfer are copied from the
+ *        engine's memory to the OAM buffer at once, on the transfer's first machine cycle; the
+ *        remaining machine cycles only count down the transfer's window.
  * 
  * @param p_PPU     A pointer to the GABLE PPU structure.
  * @param p_Engine  A pointer to the GABLE Engine structure.
@@ -828,6 +880,19 @@ void GABLE_TickODMA (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine);
  */
 Bool GABLE_ReadVRAMByte (const GABLE_PPU* p_PPU, Uint16 p_Address, Uint8* p_Value);
 
+/**
+ * @brief Reads a block of bytes from the current bank of the video RAM (VRAM) buffer. Relative and
+ *        absolute addresses are treated in the same way as with `GABLE_ReadVRAMByte`.
+ * 
+ * @param p_PPU     A pointer to the GABLE PPU structure.
+ * @param p_Address The address in the VRAM buffer to start reading from.
+ * @param p_Buffer  A pointer to a buffer to store the read bytes.
+ * @param p_Length  The number of bytes to read.
+ * 
+ * @return `true` if the bytes were read successfully; `false` otherwise.
+ */
+Bool GABLE_ReadVRAMBlock (const GABLE_PPU* p_PPU, Uint16 p_Address, Uint8* p_Buffer, Size p_Length);
+
 /**
  * @brief Writes a byte to the video RAM (VRAM) buffer.
  * 
@@ -1045,6 +1110,33 @@ Uint8 GABLE_ReadOPRI (const GABLE_PPU* p_PPU);
  */
 Uint8 GABLE_ReadGRPM (const GABLE_PPU* p_PPU);
 
+/**
+ * @brief Gets the value of the PPU's `LTAH` line table address high byte register.
+ * 
+ * @param p_PPU A pointer to the GABLE PPU structure.
+ * 
+ * @return The value of the PPU's `LTAH` line table address high byte register.
+ */
+Uint8 GABLE_ReadLTAH (const GABLE_PPU* p_PPU);
+
+/**
+ * @brief Gets the value of the PPU's `LTAL` line table address low byte register.
+ * 
+ * @param p_PPU A pointer to the GABLE PPU structure.
+ * 
+ * @return The value of the PPU's `LTAL` line table address low byte register.
+ */
+Uint8 GABLE_ReadLTAL (const GABLE_PPU* p_PPU);
+
+/**
+ * @brief Gets the value of the PPU's `LTC` line table control register.
+ * 
+ * @param p_PPU A pointer to the GABLE PPU structure.
+ * 
+ * @return The value of the PPU's `LTC` line table control register.
+ */
+Uint8 GABLE_ReadLTC (const GABLE_PPU* p_PPU);
+
 // Public Functions - Hardware Register Setters ////////////////////////////////////////////////////
 
 /**
@@ -1238,6 +1330,30 @@ void GABLE_WriteOPRI (GABLE_PPU* p_PPU, Uint8 p_Value);
  */
 void GABLE_WriteGRPM (GABLE_PPU* p_PPU, Uint8 p_Value);
 
+/**
+ * @brief Sets the value of the PPU's `LTAH` line table address high byte register.
+ * 
+ * @param p_PPU     A pointer to the GABLE PPU structure.
+ * @param p_Value   The new value to set.
+ */
+void GABLE_WriteLTAH (GABLE_PPU* p_PPU, Uint8 p_Value);
+
+/**
+ * @brief Sets the value of the PPU's `LTAL` line table address low byte register.
+ * 
+ * @param p_PPU     A pointer to the GABLE PPU structure.
+ * @param p_Value   The new value to set.
+ */
+void GABLE_WriteLTAL (GABLE_PPU* p_PPU, Uint8 p_Value);
+
+/**
+ * @brief Sets the value of the PPU's `LTC` line table control register.
+ * 
+ * @param p_PPU     A pointer to the GABLE PPU structure.
+ * @param p_Value   The new value to set.
+ */
+void GABLE_WriteLTC (GABLE_PPU* p_PPU, Uint8 p_Value);
+
 // Public Functions - High-Level Functions /////////////////////////////////////////////////////////
 
 /**
@@ -1252,6 +1368,23 @@ void GABLE_WriteGRPM (GABLE_PPU* p_PPU, Uint8 p_Value);
  */
 void GABLE_SetFrameRenderedCallback (GABLE_Engine* p_Engine, GABLE_FrameRenderedCallback p_Callback);
 
+/**
+ * @brief Sets the function to be called when the PPU finishes rendering each visible scanline.
+ * 
+ * This allows the host to hand each scanline over to the display (or an encoder, or the network)
+ * as soon as it has been drawn, rather than waiting for the whole frame to be finished, for "beam
+ * racing" with sub-frame latency.
+ * 
+ * @param p_Engine   A pointer to the GABLE Engine structure.
+ * @param p_Callback A pointer to the function to call when a scanline is rendered.
+ * 
+ * @note  This callback function is called at the start of each scanline's `HBLANK` period, before
+ *        the `LCD_STAT` interrupt for that period is serviced. It is not called in headless mode.
+ *        While threaded rendering is enabled, it is called for every scanline of the frame at the
+ *        start of the `VBLANK` period, just before the frame rendered callback.
+ */
+void GABLE_SetScanlineRenderedCallback (GABLE_Engine* p_Engine, GABLE_ScanlineRenderedCallback p_Callback);
+
 /**
  * @brief Gets the PPU's screen buffer, containing the RGBA color values of the pixels to be displayed
  *        on the screen.
@@ -1261,3 +1394,255 @@ void GABLE_SetFrameRenderedCallback (GABLE_Engine* p_Engine, GABLE_FrameRendered
  * @return A pointer to the screen buffer.
  */
 const Uint32* GABLE_GetScreenBuffer (GABLE_Engine* p_Engine);
+
+/**
+ * @brief Enables or disables threaded rendering.
+ *
+ * While threaded rendering is enabled, the PPU ticked by the engine only keeps track of the
+ * display's timing (`LY`, the `STAT` display mode and the interrupts which depend on them), and
+ * records every write to VRAM, OAM, color RAM and the rendering-related PPU registers, tagged with
+ * the dot at which it was made. A render worker thread replays those writes into a second PPU
+ * context, which it runs through the pixel fetcher to produce the frame. The engine's thread waits
+ * for the render worker at the start of each `VBLANK` period, before calling the frame-rendered
+ * callback, so the screen buffer is always complete by then.
+ * 
+ * @param p_Engine  A pointer to the GABLE Engine structure.
+ * @param p_Enabled `true` to enable threaded rendering; `false` to disable it.
+ * 
+ * @note  The length of the pixel transfer period is worked out from `SCX` while threaded rendering
+ *        is enabled, rather than being driven by the pixel fetcher. It only depends on the fine
+ *        horizontal scroll either way, so the `STAT` display mode changes on the same dots, unless
+ *        the fine horizontal scroll is changed partway through the pixel transfer period.
+ *
+ * @note  Threaded rendering can't be enabled in headless mode.
+ */
+void GABLE_SetThreadedRendering (GABLE_Engine* p_Engine, Bool p_Enabled);
+
+/**
+ * @brief Checks whether threaded rendering is enabled.
+ * 
+ * @param p_Engine A pointer to the GABLE Engine structure.
+ * 
+ * @return `true` if threaded rendering is enabled; `false` otherwise.
+ */
+Bool GABLE_IsThreadedRendering (GABLE_Engine* p_Engine);
+
+/**
+ * @brief Enables or disables background caching.
+ *
+ * While background caching is enabled, the PPU keeps a pre-rendered copy of both 256x256 pixel
+ * tilemaps. Each tile in that copy is re-rendered only after its tile number, its attributes or its
+ * tile data is written to, so scanlines which only show the background layer (plus any objects) are
+ * produced by copying a row out of the cache at the current scroll offsets, without running the
+ * pixel fetcher at all. Scanlines showing the window layer are still rendered by the pixel fetcher.
+ * 
+ * @param p_Engine  A pointer to the GABLE Engine structure.
+ * @param p_Enabled `true` to enable background caching; `false` to disable it.
+ * 
+ * @note  Scanlines rendered from the cache read `SCX` and `SCY` once, at the start of the pixel
+ *        transfer period, and the length of that period is worked out in the same manner as it is
+ *        during threaded rendering.
+ */
+void GABLE_SetBackgroundCaching (GABLE_Engine* p_Engine, Bool p_Enabled);
+
+/**
+ * @brief Checks whether background caching is enabled.
+ * 
+ * @param p_Engine A pointer to the GABLE Engine structure.
+ * 
+ * @return `true` if background caching is enabled; `false` otherwise.
+ */
+Bool GABLE_IsBackgroundCaching (GABLE_Engine* p_Engine);
+
+/**
+ * @brief Enables or disables headless mode.
+ *
+ * In headless mode, the PPU keeps the display's timing exactly as it would otherwise - `LY`, the
+ * `STAT` display mode and line coincidence flag, the `VBLANK` and `LCD_STAT` interrupts, HDMA
+ * transfers at the start of each `HBLANK` period, and the locking of VRAM and OAM during the object
+ * scan and pixel transfer periods - but produces no pixels at all. The object scan, the pixel
+ * fetcher and all color lookups are skipped, and the PPU only does any work on the dots where its
+ * display mode changes. This is meant for runs which never look at the screen, such as server-side
+ * simulations, soak tests and bot training.
+ * 
+ * The frame-rendered callback is still called at the start of each `VBLANK` period, but the screen
+ * buffer is left untouched while headless mode is enabled.
+ * 
+ * @param p_Engine   A pointer to the GABLE Engine structure.
+ * @param p_Headless `true` to enable headless mode; `false` to disable it.
+ * 
+ * @note  Enabling headless mode disables threaded rendering.
+ */
+void GABLE_SetPPUHeadless (GABLE_Engine* p_Engine, Bool p_Headless);
+
+/**
+ * @brief Checks whether headless mode is enabled.
+ * 
+ * @param p_Engine A pointer to the GABLE Engine structure.
+ * 
+ * @return `true` if headless mode is enabled; `false` otherwise.
+ */
+Bool GABLE_IsPPUHeadless (GABLE_Engine* p_Engine);
+
+/**
+ * @brief Sets up one of the PPU's tile animation slots, which animates a range of tiles in VRAM
+ *        without the game having to copy each frame of the animation in by itself.
+ *
+ * The frames of the animation are stored back-to-back in the data store, in a single data chunk:
+ * each frame holds the tile data for every tile in the range, in order, and the number of frames is
+ * worked out from the length of the chunk. The first frame is copied into VRAM right away. After
+ * that, at the start of every `p_FramePeriod`-th `VBLANK` period, the PPU copies the next frame
+ * (wrapping back around to the first) straight from the data store into VRAM, by itself.
+ * 
+ * @param p_Engine      A pointer to the GABLE Engine structure.
+ * @param p_Slot        The index of the slot to set up, less than `GABLE_PPU_TILE_ANIMATION_SLOT_COUNT`.
+ *                      Any animation already in the slot is replaced.
+ * @param p_Handle      A handle to the data chunk holding the animation's frames.
+ * @param p_VRAMBank    The VRAM bank holding the tiles to animate (0 or 1).
+ * @param p_FirstTile   The index of the first tile to animate, relative to the start of the VRAM bank.
+ * @param p_TileCount   The number of tiles to animate.
+ * @param p_FramePeriod The number of frames each frame of the animation is shown for. Must be non-zero.
+ * 
+ * @return `true` if the slot was set up; `false` if any of the parameters are invalid.
+ *
+ * @note  The animation's frames are written into VRAM, and so can be read back by the game, and
+ *        overwrite any tile data the game writes into the animated range itself. The animation only
+ *        advances while the display is on.
+ */
+Bool GABLE_SetTileAnimation (GABLE_Engine* p_Engine, Uint8 p_Slot, const GABLE_DataHandle* p_Handle,
+    Uint8 p_VRAMBank, Uint16 p_FirstTile, Uint16 p_TileCount, Uint8 p_FramePeriod);
+
+/**
+ * @brief Stops the animation in one of the PPU's tile animation slots. The animated tiles are left
+ *        holding whichever frame of the animation was last copied into VRAM.
+ * 
+ * @param p_Engine  A pointer to the GABLE Engine structure.
+ * @param p_Slot    The index of the slot to clear.
+ */
+void GABLE_ClearTileAnimation (GABLE_Engine* p_Engine, Uint8 p_Slot);
+
+/**
+ * @brief Sets up the PPU's map streamer, which scrolls one of the tilemaps around a map larger than
+ *        the tilemap itself, without the game having to copy each newly-visible part of the map in
+ *        by itself.
+ *
+ * The map's tile numbers (and, optionally, its tile attributes) are stored in the data store, one
+ * byte per tile, row by row. The tilemap is used as a window onto the map which wraps around at its
+ * edges: at the start of each `VBLANK` period, the PPU copies only the rows and columns of the map
+ * which the camera (see `GABLE_SetMapCamera`) has brought into view straight from the data store
+ * into the tilemap, then points `SCX` and `SCY` at the camera.
+ *
+ * The camera starts out in the map's top-left corner, which is streamed in right away.
+ * 
+ * @param p_Engine      A pointer to the GABLE Engine structure.
+ * @param p_Tilemap     The tilemap to stream the map into (0 for `$9800`, 1 for `$9C00`).
+ * @param p_Tiles       A handle to the data chunk holding the map's tile numbers.
+ * @param p_Attributes  A handle to the data chunk holding the map's tile attributes, which are
+ *                      streamed into VRAM bank 1, or `NULL` if the map has none.
+ * @param p_Width       The width of the map, in tiles.
+ * @param p_Height      The height of the map, in tiles.
+ * 
+ * @return `true` if the map streamer was set up; `false` if any of the parameters are invalid.
+ *
+ * @note  While the map streamer is in use, it owns `SCX` and `SCY`, and the part of the tilemap
+ *        (and attribute map) streamed into; anything the game writes to them is overwritten as soon
+ *        as the camera moves.
+ */
+Bool GABLE_SetMapStreamer (GABLE_Engine* p_Engine, Uint8 p_Tilemap, const GABLE_DataHandle* p_Tiles,
+    const GABLE_DataHandle* p_Attributes, Uint16 p_Width, Uint16 p_Height);
+
+/**
+ * @brief Moves the map streamer's camera. The camera is kept within the map, so that the screen
+ *        never shows anything past the map's edges.
+ * 
+ * @param p_Engine  A pointer to the GABLE Engine structure.
+ * @param p_X       The X-coordinate of the screen's top-left corner within the map, in pixels.
+ * @param p_Y       The Y-coordinate of the screen's top-left corner within the map, in pixels.
+ *
+ * @note  The camera's new position takes effect at the start of the next `VBLANK` period, or right
+ *        away if the display is off.
+ */
+void GABLE_SetMapCamera (GABLE_Engine* p_Engine, Uint16 p_X, Uint16 p_Y);
+
+/**
+ * @brief Stops the map streamer. The tilemap is left holding whatever was last streamed into it.
+ * 
+ * @param p_Engine  A pointer to the GABLE Engine structure.
+ */
+void GABLE_ClearMapStreamer (GABLE_Engine* p_Engine);
+
+/**
+ * @brief Copies a block of palette data into the background color RAM in one go, rather than a
+ *        byte at a time through `BGPI` and `BGPD`.
+ * 
+ * @param p_Engine  A pointer to the GABLE Engine structure.
+ * @param p_Index   The index of the byte in color RAM to start copying to.
+ * @param p_Data    A pointer to the palette data, in the same format as color RAM.
+ * @param p_Length  The number of bytes to copy. The block may not run past the end of color RAM.
+ * 
+ * @return `true` if the palette data was copied; `false` if the block is out of bounds, or if color
+ *         RAM could not be written to at the time, under the same conditions as for `BGPD`.
+ */
+Bool GABLE_UploadBackgroundPalettes (GABLE_Engine* p_Engine, Uint8 p_Index, const Uint8* p_Data, Size p_Length);
+
+/**
+ * @brief Copies a block of palette data into the object color RAM in one go, rather than a byte at
+ *        a time through `OBPI` and `OBPD`.
+ * 
+ * @param p_Engine  A pointer to the GABLE Engine structure.
+ * @param p_Index   The index of the byte in color RAM to start copying to.
+ * @param p_Data    A pointer to the palette data, in the same format as color RAM.
+ * @param p_Length  The number of bytes to copy. The block may not run past the end of color RAM.
+ * 
+ * @return `true` if the palette data was copied; `false` if the block is out of bounds, or if color
+ *         RAM could not be written to at the time, under the same conditions as for `OBPD`.
+ */
+Bool GABLE_UploadObjectPalettes (GABLE_Engine* p_Engine, Uint8 p_Index, const Uint8* p_Data, Size p_Length);
+
+/**
+ * @brief Gets one of the PPU's preset colors.
+ * 
+ * @param p_Color The preset color to get.
+ * 
+ * @return The preset color, in RGB555 format.
+ */
+GABLE_ColorRGB555 GABLE_GetPresetColor (GABLE_Color p_Color);
+
+/**
+ * @brief Begins fading every color in both color RAM buffers towards a set of target palettes.
+ *
+ * At the start of each `VBLANK` period, until the fade is over, the PPU works out each channel of
+ * each color by interpolating between the color as it was when the fade began and its target, and
+ * writes the results into color RAM in one go. Starting a new fade replaces any fade in progress.
+ * 
+ * @param p_Engine              A pointer to the GABLE Engine structure.
+ * @param p_BackgroundTarget    A pointer to the 64 bytes of target background palette data, or
+ *                              `NULL` to leave the background palettes as they are.
+ * @param p_ObjectTarget        A pointer to the 64 bytes of target object palette data, or `NULL`
+ *                              to leave the object palettes as they are.
+ * @param p_FrameCount          The number of frames the fade lasts for. A fade lasting zero frames
+ *                              takes effect right away.
+ *
+ * @note  Color RAM is only used in CGB graphics mode. The fade only advances while the display is on.
+ */
+void GABLE_FadePalettes (GABLE_Engine* p_Engine, const Uint8* p_BackgroundTarget, const Uint8* p_ObjectTarget,
+    Uint16 p_FrameCount);
+
+/**
+ * @brief Begins fading every color in both color RAM buffers towards a single color, such as black
+ *        or white. See `GABLE_FadePalettes`.
+ * 
+ * @param p_Engine      A pointer to the GABLE Engine structure.
+ * @param p_Color       The color to fade towards.
+ * @param p_FrameCount  The number of frames the fade lasts for.
+ */
+void GABLE_FadePalettesToColor (GABLE_Engine* p_Engine, GABLE_ColorRGB555 p_Color, Uint16 p_FrameCount);
+
+/**
+ * @brief Checks whether a palette fade is in progress.
+ * 
+ * @param p_Engine A pointer to the GABLE Engine structure.
+ * 
+ * @return `true` if a palette fade is in progress; `false` otherwise.
+ */
+Bool GABLE_IsPaletteFading (GABLE_Engine* p_Engine);
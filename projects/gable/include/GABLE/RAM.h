@@ -127,6 +127,31 @@ Bool GABLE_ReadWRAMByte (GABLE_RAM* p_RAM, Uint16 p_Address, Uint8* p_Value);
  */
 Bool GABLE_ReadSRAMByte (GABLE_RAM* p_RAM, Uint16 p_Address, Uint8* p_Value);
 
+/**
+ * @brief      Reads a block of bytes from the WRAM, starting at the specified address. Bytes at
+ *             addresses past the first WRAM bank are read from the current WRAM bank.
+ * 
+ * @param      p_RAM     A pointer to the GABLE Engine RAM instance.
+ * @param      p_Address The address to start reading from.
+ * @param      p_Buffer  A pointer to the buffer to store the read bytes.
+ * @param      p_Length  The number of bytes to read.
+ * 
+ * @return     `true` if the WRAM was read from successfully; `false` otherwise.
+ */
+Bool GABLE_ReadWRAMBlock (GABLE_RAM* p_RAM, Uint16 p_Address, Uint8* p_Buffer, Size p_Length);
+
+/**
+ * @brief      Reads a block of bytes from the current SRAM bank, starting at the specified address.
+ * 
+ * @param      p_RAM     A pointer to the GABLE Engine RAM instance.
+ * @param      p_Address The address to start reading from.
+ * @param      p_Buffer  A pointer to the buffer to store the read bytes.
+ * @param      p_Length  The number of bytes to read.
+ * 
+ * @return     `true` if the SRAM was read from successfully; `false` otherwise.
+ */
+Bool GABLE_ReadSRAMBlock (GABLE_RAM* p_RAM, Uint16 p_Address, Uint8* p_Buffer, Size p_Length);
+
 /**
  * @brief      Reads a byte from the specified address in the HRAM buffer.
  * 
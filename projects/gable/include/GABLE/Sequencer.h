@@ -0,0 +1,324 @@
+/**
+ * @file     GABLE/Sequencer.h
+ * @brief    Contains the GABLE Engine's music sequencer structure and public functions.
+ *
+ * The GABLE Engine's music sequencer plays tracker-style songs and sound effects, stored in the
+ * data store, on the APU's four audio channels. It does the work of the music driver which a Game
+ * Boy game would otherwise have to run itself, every frame: it steps through each song's patterns,
+ * and writes the APU's registers natively, on the APU's "DIV-APU" ticks, so that a program only has
+ * to tell it what to play.
+ *
+ * The music sequencer provides the following hardware registers:
+ *
+ * - `SQAH` and `SQAL` (Sequencer Data Address, High and Low Bytes): The sequencer data address
+ *   registers hold the address of the song or sound effect to be started by the next command
+ *   written to the `SQC` register. The address must lie in the data store's part of the memory map
+ *   (`$0000` - `$7FFF`); if it lies in the switchable bank (`$4000` - `$7FFF`), then the bank which
+ *   is selected when the command is written is the one which is played from, even if another bank
+ *   is selected later.
+ * - `SQC` (Sequencer Control): Writing to the sequencer control register issues a command to the
+ *   sequencer. The commands are as follows:
+ *       - `$01` - Play Music: Starts the song at `SQAH`/`SQAL`, replacing any song which is playing.
+ *       - `$02` - Stop Music: Stops the song which is playing.
+ *       - `$03` - Pause Music: Pauses the song which is playing, silencing its channels.
+ *       - `$04` - Resume Music: Resumes the paused song.
+ *       - `$05` - Stop Sound Effects: Stops all sound effects.
+ *       - `$1n` - Play Sound Effect: Starts the sound effect at `SQAH`/`SQAL`, with priority `n`.
+ *   Reading this register gives the sequencer's status, the bits of which are as follows:
+ *       - Bits 0-3 - Sound Effect Channels: Set for each channel (`PC1`, `PC2`, `WC` and `NC`, in
+ *         that order) which is currently held by a sound effect.
+ *       - Bit 6 - Music Paused: Set if the music is paused.
+ *       - Bit 7 - Music Playing: Set if a song is playing (whether or not it is paused).
+ * - `SQT` (Sequencer Tempo): The sequencer tempo register holds the tempo of the song which is
+ *   playing. This register is set from the song's header when the song is started, and may be
+ *   changed by the song itself, or by the program (eg. to speed the music up when time is running
+ *   out). See below for how the tempo is measured.
+ * - `SQM` (Sequencer Marker): The sequencer marker register holds the value of the last marker
+ *   reached by a song or sound effect, which a program can use to keep its events in time with the
+ *   music. Writing to this register sets its value.
+ *
+ * The sequencer is clocked by the APU's "DIV-APU" ticks, 512 times per second. On each of these,
+ * each playing song's tempo is added to a counter, and each time that counter passes 256, the song
+ * advances by one tick. A song therefore ticks `2 * tempo` times per second; a tempo of 30 ticks the
+ * song at 60 Hz, in time with the display. Each row of a song's patterns lasts for the song's speed,
+ * in ticks. Because the sequencer is clocked by the APU, it stops whenever the APU is switched off
+ * by `NR52`, and the program is responsible for switching the APU on, and for setting its master
+ * volume in `NR50`, before starting any music.
+ *
+ * Songs and sound effects share the same format. Every offset in a song is counted from the start
+ * of the song, and all of a song's data must lie in the same data store bank. A song begins with an
+ * eight-byte header, as follows:
+ *
+ * - Byte 0 - Tempo: The song's initial tempo.
+ * - Byte 1 - Speed: The number of ticks in each row. Zero is treated as one.
+ * - Byte 2 - Rows: The number of rows in each of the song's patterns. Zero is treated as 256.
+ * - Byte 3 - Order Count: The number of entries in the song's order list.
+ * - Byte 4 - Loop Order: The entry in the order list to go back to once the song has played its last
+ *   entry. If this is not a valid entry (eg. `$FF`), the song stops at its end instead. Sound
+ *   effects should not loop.
+ * - Byte 5 - Instrument Count: The number of instruments in the song, up to 32.
+ * - Byte 6 - Wave Count: The number of wave patterns in the song.
+ * - Byte 7 - Pattern Count: The number of patterns in the song.
+ *
+ * The header is followed, in order, by:
+ *
+ * - The instruments, of `GABLE_SEQ_INSTRUMENT_SIZE` bytes each, as follows:
+ *       - Byte 0 - Envelope: For `PC1`, `PC2` and `NC`, the value to write to the channel's volume
+ *         envelope register (`NRx2`). For `WC`, bits 5-6 hold the value of its output level
+ *         register (`NR32`).
+ *       - Byte 1 - Timbre: For `PC1` and `PC2`, bits 6-7 hold the wave pattern duty cycle. For `WC`,
+ *         this is the number of the song's wave pattern to load into the wave pattern RAM. For `NC`,
+ *         bit 3 selects the 7-bit LFSR.
+ *       - Byte 2 - Length: The length of each note, in the length timer's 256 Hz ticks, from 1 to 64
+ *         (or 255, for `WC`). Zero lets notes ring on until the next note or note-off.
+ *       - Byte 3 - Panning: Bit 1 outputs the channel to the left speaker, and bit 0 to the right.
+ *       - Byte 4 - Vibrato Delay: The number of ticks after each note is started before its vibrato
+ *         starts.
+ *       - Byte 5 - Vibrato Depth: How far the vibrato bends each note's pitch, in period units. Zero
+ *         disables the vibrato. `NC` has no vibrato.
+ *       - Byte 6 - Vibrato Speed: How far the vibrato moves through its cycle each tick, in 64ths of
+ *         a cycle.
+ *       - Byte 7 - Sweep: For `PC1`, the value to write to its frequency sweep register (`NR10`).
+ * - The wave patterns, of `GABLE_WAVE_RAM_SIZE` bytes each, in the same format as the wave pattern
+ *   RAM.
+ * - The pattern table, of two bytes for each pattern, in little-endian order: the offset of each
+ *   pattern's data.
+ * - The order list, of four bytes for each entry: the number of the pattern to play on each of the
+ *   channels `PC1`, `PC2`, `WC` and `NC`, in that order, or `$FF` to leave the channel silent. A
+ *   sound effect plays on (and takes over) the channels used by its first entry.
+ * - The patterns' data.
+ *
+ * Each channel's pattern is a stream of events. Each row is ended by an event which plays a note,
+ * stops a note, or waits; any number of events which change a setting may come before it. Once the
+ * stream ends, the channel sits out the rest of the pattern. The events are as follows:
+ *
+ * - `$00` - `$47` - Note: Plays a note with the current instrument, from C in octave 2 (`$00`) up to
+ *   B in octave 7 (`$47`), in semitones. The pulse and wave channels play a note at the same pitch.
+ *   On `NC`, the notes pick the noise's clock, four steps to an octave, from the lowest (`$00`) up to
+ *   the highest (`$3B` and above).
+ * - `$7F` - Note Off: Silences the channel.
+ * - `$80` - `$BF` - Wait: Ends the row, then waits out a further `n & $3F` empty rows.
+ * - `$C0` - `$DF` - Instrument: Selects instrument `n & $1F` for the following notes.
+ * - `$E0 vv` - Volume: Plays the following notes at volume `vv` (0-15) rather than the instrument's,
+ *   until an instrument is next selected.
+ * - `$E1 xy` - Vibrato: Sets the vibrato's depth to `x` and its speed to `y`, until an instrument is
+ *   next selected.
+ * - `$E2 tt` - Tempo: Sets the song's tempo to `tt`.
+ * - `$E3 ss` - Speed: Sets the number of ticks in each row to `ss`.
+ * - `$E4 mm` - Marker: Sets the `SQM` register to `mm`.
+ * - `$E5 pp` - Panning: Sets the channel's panning to `pp`, in the same format as an instrument's,
+ *   until an instrument is next selected.
+ * - `$FF` - End: Ends the channel's stream.
+ *
+ * Sound effects are played over the music, which carries on playing on the channels they don't
+ * use. A sound effect is started with a priority, from 0 to 15; it takes each of its channels from
+ * the music, or from a sound effect of the same or a lower priority, but not from a sound effect of
+ * a higher priority, and is dropped entirely if it can't take any of its channels. Once a sound
+ * effect ends, the music takes its channels back, from the next note it plays on them.
+ */
+
+#pragma once
+#include <GABLE/Common.h>
+
+// Constants ///////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief The size of a song's header, in bytes.
+ */
+#define GABLE_SEQ_HEADER_SIZE           8
+
+/**
+ * @brief The size of each of a song's instruments, in bytes.
+ */
+#define GABLE_SEQ_INSTRUMENT_SIZE       8
+
+/**
+ * @brief The maximum number of instruments in a song.
+ */
+#define GABLE_SEQ_MAX_INSTRUMENTS       32
+
+/**
+ * @brief The maximum number of sound effects which can be played at once.
+ */
+#define GABLE_SEQ_EFFECT_SLOTS          4
+
+/**
+ * @brief The number of notes which can be played, from C in octave 2 to B in octave 7.
+ */
+#define GABLE_SEQ_NOTE_COUNT            72
+
+/**
+ * @brief The pattern event which silences a channel.
+ */
+#define GABLE_SEQ_NOTE_OFF              0x7F
+
+/**
+ * @brief The pattern event which ends a row, then waits out a further `n & 0x3F` empty rows.
+ */
+#define GABLE_SEQ_WAIT                  0x80
+
+/**
+ * @brief The pattern event which selects instrument `n & 0x1F`.
+ */
+#define GABLE_SEQ_INSTRUMENT            0xC0
+
+/**
+ * @brief The pattern events which change a setting, each followed by a parameter byte.
+ */
+#define GABLE_SEQ_VOLUME                0xE0
+#define GABLE_SEQ_VIBRATO               0xE1
+#define GABLE_SEQ_TEMPO                 0xE2
+#define GABLE_SEQ_SPEED                 0xE3
+#define GABLE_SEQ_MARKER                0xE4
+#define GABLE_SEQ_PANNING               0xE5
+
+/**
+ * @brief The pattern event which ends a channel's stream.
+ */
+#define GABLE_SEQ_END                   0xFF
+
+// Typedefs and Forward Declarations ///////////////////////////////////////////////////////////////
+
+/**
+ * @brief A forward declaration of the GABLE Engine structure.
+ */
+typedef struct GABLE_Engine GABLE_Engine;
+
+/**
+ * @brief The GABLE Engine's music sequencer structure.
+ */
+typedef struct GABLE_Sequencer GABLE_Sequencer;
+
+// Public Functions ////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief      Creates a new GABLE Engine music sequencer instance.
+ *
+ * @return     A pointer to the new GABLE Engine music sequencer instance.
+ */
+GABLE_Sequencer* GABLE_CreateSequencer ();
+
+/**
+ * @brief      Resets a GABLE Engine music sequencer instance, stopping everything it is playing.
+ *
+ * @param      p_Sequencer  A pointer to the GABLE Engine music sequencer instance to reset.
+ */
+void GABLE_ResetSequencer (GABLE_Sequencer* p_Sequencer);
+
+/**
+ * @brief      Destroys a GABLE Engine music sequencer instance.
+ *
+ * @param      p_Sequencer  A pointer to the GABLE Engine music sequencer instance to destroy.
+ */
+void GABLE_DestroySequencer (GABLE_Sequencer* p_Sequencer);
+
+/**
+ * @brief      Ticks the music sequencer. This is called by the APU on each of its "DIV-APU" ticks,
+ *             while it is being brought up to date, and writes the APU's registers directly.
+ *
+ * @param      p_Sequencer  A pointer to the GABLE Engine music sequencer instance.
+ * @param      p_Engine     A pointer to the GABLE Engine instance.
+ */
+void GABLE_TickSequencer (GABLE_Sequencer* p_Sequencer, GABLE_Engine* p_Engine);
+
+/**
+ * @brief      Checks whether the music sequencer is playing anything; that is, whether it needs to
+ *             be ticked at all.
+ *
+ * @param      p_Sequencer  A pointer to the GABLE Engine music sequencer instance.
+ *
+ * @return     `true` if a song or sound effect is playing; `false` otherwise.
+ */
+Bool GABLE_IsSequencerPlaying (const GABLE_Sequencer* p_Sequencer);
+
+// Public Functions - Hardware Register Getters ////////////////////////////////////////////////////
+
+/**
+ * @brief      Gets the value of the `SQAH` (Sequencer Data Address High) register.
+ *
+ * @param      p_Sequencer  A pointer to the GABLE Engine music sequencer instance.
+ *
+ * @return     The value of the `SQAH` register.
+ */
+Uint8 GABLE_ReadSQAH (const GABLE_Sequencer* p_Sequencer);
+
+/**
+ * @brief      Gets the value of the `SQAL` (Sequencer Data Address Low) register.
+ *
+ * @param      p_Sequencer  A pointer to the GABLE Engine music sequencer instance.
+ *
+ * @return     The value of the `SQAL` register.
+ */
+Uint8 GABLE_ReadSQAL (const GABLE_Sequencer* p_Sequencer);
+
+/**
+ * @brief      Gets the value of the `SQC` (Sequencer Control) register; that is, the sequencer's
+ *             status.
+ *
+ * @param      p_Sequencer  A pointer to the GABLE Engine music sequencer instance.
+ *
+ * @return     The value of the `SQC` register.
+ */
+Uint8 GABLE_ReadSQC (const GABLE_Sequencer* p_Sequencer);
+
+/**
+ * @brief      Gets the value of the `SQT` (Sequencer Tempo) register.
+ *
+ * @param      p_Sequencer  A pointer to the GABLE Engine music sequencer instance.
+ *
+ * @return     The value of the `SQT` register.
+ */
+Uint8 GABLE_ReadSQT (const GABLE_Sequencer* p_Sequencer);
+
+/**
+ * @brief      Gets the value of the `SQM` (Sequencer Marker) register.
+ *
+ * @param      p_Sequencer  A pointer to the GABLE Engine music sequencer instance.
+ *
+ * @return     The value of the `SQM` register.
+ */
+Uint8 GABLE_ReadSQM (const GABLE_Sequencer* p_Sequencer);
+
+// Public Functions - Hardware Register Setters ////////////////////////////////////////////////////
+
+/**
+ * @brief      Sets the value of the `SQAH` (Sequencer Data Address High) register.
+ *
+ * @param      p_Sequencer  A pointer to the GABLE Engine music sequencer instance.
+ * @param      p_Value      The value to write to the `SQAH` register.
+ */
+void GABLE_WriteSQAH (GABLE_Sequencer* p_Sequencer, Uint8 p_Value);
+
+/**
+ * @brief      Sets the value of the `SQAL` (Sequencer Data Address Low) register.
+ *
+ * @param      p_Sequencer  A pointer to the GABLE Engine music sequencer instance.
+ * @param      p_Value      The value to write to the `SQAL` register.
+ */
+void GABLE_WriteSQAL (GABLE_Sequencer* p_Sequencer, Uint8 p_Value);
+
+/**
+ * @brief      Writes a command to the `SQC` (Sequencer Control) register, and carries it out. The
+ *             APU must be up to date when this is called.
+ *
+ * @param      p_Sequencer  A pointer to the GABLE Engine music sequencer instance.
+ * @param      p_Engine     A pointer to the GABLE Engine instance.
+ * @param      p_Value      The command to write to the `SQC` register.
+ */
+void GABLE_WriteSQC (GABLE_Sequencer* p_Sequencer, GABLE_Engine* p_Engine, Uint8 p_Value);
+
+/**
+ * @brief      Sets the value of the `SQT` (Sequencer Tempo) register.
+ *
+ * @param      p_Sequencer  A pointer to the GABLE Engine music sequencer instance.
+ * @param      p_Value      The value to write to the `SQT` register.
+ */
+void GABLE_WriteSQT (GABLE_Sequencer* p_Sequencer, Uint8 p_Value);
+
+/**
+ * @brief      Sets the value of the `SQM` (Sequencer Marker) register.
+ *
+ * @param      p_Sequencer  A pointer to the GABLE Engine music sequencer instance.
+ * @param      p_Value      The value to write to the `SQM` register.
+ */
+void GABLE_WriteSQM (GABLE_Sequencer* p_Sequencer, Uint8 p_Value);
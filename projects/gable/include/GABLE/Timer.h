@@ -128,6 +128,16 @@ void GABLE_TickTimer (GABLE_Timer* p_Timer, GABLE_Engine* p_Engine);
  */
 Bool GABLE_CheckTimerDividerBit (GABLE_Timer* p_Timer, Uint8 p_Bit);
 
+/**
+ * @brief      Gets the full, 16-bit value of the timer's divider. The `DIV` register only exposes
+ *             the upper byte of this value.
+ * 
+ * @param      p_Timer  A pointer to the GABLE Engine timer instance.
+ * 
+ * @return     The value of the timer's divider.
+ */
+Uint16 GABLE_GetTimerDivider (const GABLE_Timer* p_Timer);
+
 // Public Functions - Hardware Register Getters ////////////////////////////////////////////////////
 
 Uint8 GABLE_ReadDIV (const GABLE_Timer* p_Timer);
@@ -0,0 +1,122 @@
+/**
+ * @file     GABLE/Upscaler.h
+ * @brief    The GABLE Engine's software upscaler structure and functions.
+ *
+ * The GABLE Engine's upscaler component provides a CPU-side means of enlarging the PPU's 160x144
+ * pixel screen buffer for presentation, for hosts which either lack a GPU path or which need to
+ * hand an already-scaled frame to some other consumer (an encoder, a network stream, etc.). The
+ * upscaler writes its output into a caller-provided destination buffer, which may be strided (that
+ * is, each row of the destination buffer may be wider than the upscaled frame, as is the case with
+ * locked streaming textures).
+ *
+ * The upscaler supports the following filters:
+ *
+ * - Nearest-Neighbour (`GABLE_UF_NEAREST`): Each source pixel is replicated into an NxN block of
+ *   destination pixels, where N is an integer scale factor between 2 and 8, inclusive.
+ * - Scale2x (`GABLE_UF_SCALE2X`): The EPX / Scale2x pixel-art filter, which replicates each source
+ *   pixel into a 2x2 block, but rounds off diagonal edges by comparing the pixel against its four
+ *   orthogonal neighbours. This filter only supports a scale factor of 2.
+ *
+ * Both filters are vectorized with SSE2 intrinsics on hosts which support them, with a scalar path
+ * being used otherwise. The upscaler can also split the frame into horizontal bands of source rows
+ * and distribute those bands across a small pool of worker threads. The calling thread always
+ * processes the first band itself, then waits for the workers to finish theirs, so the upscaler's
+ * functions only return once the entire destination buffer has been written.
+ */
+
+#pragma once
+#include <GABLE/Common.h>
+
+// Constants ///////////////////////////////////////////////////////////////////////////////////////
+
+/** @brief The smallest integer scale factor supported by the upscaler. */
+#define GABLE_UPSCALER_MIN_SCALE 2
+
+/** @brief The largest integer scale factor supported by the upscaler. */
+#define GABLE_UPSCALER_MAX_SCALE 8
+
+/** @brief The maximum number of worker threads which may be owned by an upscaler. */
+#define GABLE_UPSCALER_MAX_WORKERS 7
+
+// Typedefs and Forward Declarations ///////////////////////////////////////////////////////////////
+
+/** @brief A forward-declaration of the GABLE Engine structure. */
+typedef struct GABLE_Engine GABLE_Engine;
+
+/** @brief A forward-declaration of the GABLE Engine's upscaler structure. */
+typedef struct GABLE_Upscaler GABLE_Upscaler;
+
+// Upscale Filter Enumeration //////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief An enumeration representing the filters which can be used by the upscaler.
+ */
+typedef enum GABLE_UpscaleFilter
+{
+    GABLE_UF_NEAREST = 0,   ///< @brief Nearest-neighbour integer scaling (2x to 8x).
+    GABLE_UF_SCALE2X        ///< @brief The EPX / Scale2x pixel-art filter (2x only).
+} GABLE_UpscaleFilter;
+
+// Public Functions ////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Creates a new instance of the GABLE upscaler structure.
+ *
+ * @param p_WorkerCount The number of worker threads to spawn, in addition to the calling thread.
+ *                      Pass zero to upscale entirely on the calling thread. This value is clamped
+ *                      to `GABLE_UPSCALER_MAX_WORKERS`.
+ *
+ * @return A pointer to the newly created GABLE upscaler structure.
+ */
+GABLE_Upscaler* GABLE_CreateUpscaler (Count p_WorkerCount);
+
+/**
+ * @brief Destroys an instance of the GABLE upscaler structure, joining its worker threads.
+ *
+ * @param p_Upscaler A pointer to the GABLE upscaler structure to destroy.
+ */
+void GABLE_DestroyUpscaler (GABLE_Upscaler* p_Upscaler);
+
+/**
+ * @brief Gets the number of worker threads owned by the upscaler.
+ *
+ * @param p_Upscaler A pointer to the GABLE upscaler structure.
+ *
+ * @return The number of worker threads, not including the calling thread.
+ */
+Count GABLE_GetUpscalerWorkerCount (const GABLE_Upscaler* p_Upscaler);
+
+/**
+ * @brief Upscales a 160x144 pixel frame into a caller-provided destination buffer.
+ *
+ * @param p_Upscaler    A pointer to the GABLE upscaler structure.
+ * @param p_Filter      The filter to upscale the frame with.
+ * @param p_Scale       The integer scale factor. Must be between 2 and 8 for the nearest-neighbour
+ *                      filter, and exactly 2 for the Scale2x filter.
+ * @param p_Source      A pointer to the source frame, in the same format as the PPU's screen buffer.
+ * @param p_Destination A pointer to the destination buffer. It must be large enough to hold
+ *                      `160 * p_Scale` pixels per row, and `144 * p_Scale` rows.
+ * @param p_Pitch       The distance between the starts of two consecutive rows in the destination
+ *                      buffer, in bytes. Must be at least `160 * p_Scale * 4`.
+ *
+ * @return `true` if the frame was upscaled successfully; `false` otherwise.
+ */
+Bool GABLE_UpscaleFrame (GABLE_Upscaler* p_Upscaler, GABLE_UpscaleFilter p_Filter, Uint8 p_Scale,
+    const Uint32* p_Source, Uint32* p_Destination, Size p_Pitch);
+
+// Public Functions - High-Level Functions /////////////////////////////////////////////////////////
+
+/**
+ * @brief Upscales the engine's current screen buffer into a caller-provided destination buffer.
+ *
+ * @param p_Engine      A pointer to the GABLE Engine structure.
+ * @param p_Upscaler    A pointer to the GABLE upscaler structure.
+ * @param p_Filter      The filter to upscale the frame with.
+ * @param p_Scale       The integer scale factor.
+ * @param p_Destination A pointer to the destination buffer.
+ * @param p_Pitch       The destination buffer's row pitch, in bytes.
+ *
+ * @return `true` if the frame was upscaled successfully; `false` otherwise.
+ */
+Bool GABLE_UpscaleScreenBuffer (GABLE_Engine* p_Engine, GABLE_Upscaler* p_Upscaler,
+    GABLE_UpscaleFilter p_Filter, Uint8 p_Scale, Uint32* p_Destination, Size p_Pitch);
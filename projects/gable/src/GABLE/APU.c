@@ -3,9 +3,36 @@
 #include <GABLE/Engine.h>
 #include <GABLE/Timer.h>
 #include <GABLE/APU.h>
+#include <GABLE/Sequencer.h>
+#include <stddef.h>
+
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
 
 // Private Constants ///////////////////////////////////////////////////////////////////////////////
 
+// Band-limited synthesis: every change in a channel's output is recorded as a step, at the exact
+// cycle it happened on, into a short buffer of pending sample contributions. Each step is spread
+// over `GABLE_BLIP_WIDTH` samples by a windowed-sinc step table, picked from one of
+// `GABLE_BLIP_PHASES` rows by where the step falls between two samples. Levels and table entries
+// are fixed-point integers, so that the running sum of the steps never drifts.
+#define GABLE_BLIP_WIDTH            16
+#define GABLE_BLIP_PHASES           32
+#define GABLE_BLIP_BUFFER_SIZE      32
+#define GABLE_BLIP_KERNEL_UNITY     32768
+#define GABLE_BLIP_LEVEL_SCALE      65536.0f
+#define GABLE_BLIP_CUTOFF           0.45
+
+// Block mixing: the samples mixed over a sync are gathered into a block, then panned, scaled and
+// high-pass filtered in one pass, before being pushed into the sample ring. The block's size must
+// be a multiple of four, the width of the vector kernels.
+#define GABLE_MIX_BLOCK_SIZE        64
+
+// Dynamic rate control: the fraction of a cycle between two mixes is counted in this many
+// `m_SampleRate`ths of a cycle, so that the mix period can be nudged by fine fractions of a sample.
+#define GABLE_MIX_PHASE_SCALE       1000
+
 static const Uint8 GABLE_WAVE_DUTY_PATTERNS[4] = {
     [GABLE_PDC_12_5]    = 0b00000001,
     [GABLE_PDC_25]      = 0b00000011,
@@ -129,6 +156,30 @@ static const Float32 GABLE_NOTE_FREQUENCY_TABLE[] = {
 
 };
 
+// The noise channel's clock frequency, indexed by `NR43`'s clock divider code, then its clock
+// shift. Divider code 0 is treated as a divider of 0.5.
+static const Uint32 GABLE_NOISE_CLOCK_FREQUENCY_TABLE[8][16] = {
+    { 524288, 262144, 131072,  65536,  32768,  16384,   8192,   4096,   2048,   1024,    512,    256,    128,     64,     32,     16 },
+    { 262144, 131072,  65536,  32768,  16384,   8192,   4096,   2048,   1024,    512,    256,    128,     64,     32,     16,      8 },
+    { 131072,  65536,  32768,  16384,   8192,   4096,   2048,   1024,    512,    256,    128,     64,     32,     16,      8,      4 },
+    {  87381,  43690,  21845,  10922,   5461,   2730,   1365,    682,    341,    170,     85,     42,     21,     10,      5,      2 },
+    {  65536,  32768,  16384,   8192,   4096,   2048,   1024,    512,    256,    128,     64,     32,     16,      8,      4,      2 },
+    {  52428,  26214,  13107,   6553,   3276,   1638,    819,    409,    204,    102,     51,     25,     12,      6,      3,      1 },
+    {  43690,  21845,  10922,   5461,   2730,   1365,    682,    341,    170,     85,     42,     21,     10,      5,      2,      1 },
+    {  37449,  18724,   9362,   4681,   2340,   1170,    585,    292,    146,     73,     36,     18,      9,      4,      2,      1 }
+};
+
+// The noise channel's LFSR runs through a fixed sequence of states: 32,767 of them in 15-bit mode,
+// and 127 in 7-bit mode. The sequences are laid out in tables, so that the LFSR can be moved any
+// number of steps along in one go, and its output read off a bit table, rather than stepping it
+// one bit at a time.
+#define GABLE_NOISE_PERIOD_15       32767
+#define GABLE_NOISE_PERIOD_7        127
+#define GABLE_NOISE_NO_POSITION_15  0xFFFF
+#define GABLE_NOISE_NO_POSITION_7   0xFF
+#define GABLE_NOISE_BIT_WORDS_15    ((GABLE_NOISE_PERIOD_15 + 127) / 64 + 1)
+#define GABLE_NOISE_BIT_WORDS_7     ((GABLE_NOISE_PERIOD_7 + 127) / 64 + 1)
+
 // Audio Channel Structures ////////////////////////////////////////////////////////////////////////
 
 typedef struct GABLE_PulseChannel
@@ -143,7 +194,7 @@ typedef struct GABLE_PulseChannel
 
     // Internal Registers
     Uint16                          m_CurrentPeriod;            ///< @brief The current period of the channel.
-    Uint16                          m_PeriodDivider;            ///< @brief The period divider.
+    Uint32                          m_PeriodTimer;              ///< @brief The number of cycles left until the period divider next overflows.
     Uint8                           m_CurrentLengthTimer;       ///< @brief The current length timer.
     Uint8                           m_CurrentVolume;            ///< @brief The current volume.
     Uint8                           m_CurrentWavePointer;       ///< @brief Points to the current wave sample in the current duty cycle pattern.
@@ -172,7 +223,7 @@ typedef struct GABLE_WaveChannel
 
     // Internal Registers
     Uint16                          m_CurrentPeriod;                ///< @brief The current period of the channel.
-    Uint16                          m_PeriodDivider;                ///< @brief The period divider.
+    Uint32                          m_PeriodTimer;                  ///< @brief The number of cycles left until the period divider next overflows.
     Uint8                           m_CurrentLengthTimer;           ///< @brief The current length timer.
     Uint8                           m_CurrentSampleIndex;           ///< @brief Points to the current 4-bit sample in the wave RAM buffer.
 
@@ -197,6 +248,7 @@ typedef struct GABLE_NoiseChannel
     Uint8                           m_CurrentVolume;                ///< @brief The current volume.
     Uint8                           m_CurrentEnvelopeTicks;         ///< @brief The envelope sweep unit's current tick counter.
     Uint64                          m_CurrentClockFrequency;        ///< @brief The current clock frequency of the noise channel.
+    Uint32                          m_StepTimer;                    ///< @brief The number of cycles left until the LFSR is next stepped.
 
     // Digital-to-Analog Converter (DAC)
     Bool                            m_DACEnabled;                   ///< @brief The channel's DAC enable flag.
@@ -225,29 +277,113 @@ typedef struct GABLE_APU
     GABLE_AudioSample               m_AudioSample;                  ///< @brief The current audio sample mixed by the APU.
 
     // Mix Handler and State
+    Bool                            m_AudioEnabled;                 ///< @brief Whether audio is rendered at all, or only the registers are kept up to date.
     GABLE_AudioMixCallback          m_MixCallback;                  ///< @brief The audio mix callback function.
     Float32                         m_PreviousLeftInput;            ///< @brief The previous left speaker input.
     Float32                         m_PreviousRightInput;           ///< @brief The previous right speaker input.
     Float32                         m_PreviousLeftOutput;           ///< @brief The previous left speaker output.
     Float32                         m_PreviousRightOutput;          ///< @brief The previous right speaker output.
+    Float32                         m_HighPassAlpha;                ///< @brief The high-pass filter's coefficient, for the current sample rate.
+
+    // Mix Block
+    Bool                            m_Vectorized;                   ///< @brief Whether blocks are processed with the vector kernels, rather than the scalar ones.
+    Float32                         m_MixBlockChannels[4][GABLE_MIX_BLOCK_SIZE];    ///< @brief Each channel's DAC output, per sample, or zero where the channel can't be heard.
+    Float32                         m_MixBlockLeft[GABLE_MIX_BLOCK_SIZE];           ///< @brief The left speaker's samples.
+    Float32                         m_MixBlockRight[GABLE_MIX_BLOCK_SIZE];          ///< @brief The right speaker's samples.
+    Count                           m_MixBlockCount;                ///< @brief The number of samples in the block.
+
+    // Audio Capture
+    GABLE_AudioCapture*             m_AudioCapture;                 ///< @brief The audio capture in progress, if any.
+    Bool                            m_AudioCaptureStems;            ///< @brief Whether the audio capture is writing per-channel stems.
+
+    // Band-Limited Synthesis
+    Bool                            m_BandLimited;                  ///< @brief Whether samples are band-limited, rather than point-sampled.
+    Int16                           m_BlipKernel[GABLE_BLIP_PHASES][GABLE_BLIP_WIDTH];   ///< @brief The band-limited step table, one row per phase.
+    Int64                           m_BlipLeft[GABLE_BLIP_BUFFER_SIZE];     ///< @brief The left speaker's pending step contributions, per sample.
+    Int64                           m_BlipRight[GABLE_BLIP_BUFFER_SIZE];    ///< @brief The right speaker's pending step contributions, per sample.
+    Int64                           m_BlipLeftSum;                  ///< @brief The running sum of the left speaker's step contributions.
+    Int64                           m_BlipRightSum;                 ///< @brief The running sum of the right speaker's step contributions.
+    Int32                           m_BlipLeftLevels[4];            ///< @brief Each channel's contribution to the left speaker, as last recorded.
+    Int32                           m_BlipRightLevels[4];           ///< @brief Each channel's contribution to the right speaker, as last recorded.
 
     // Internal Registers
     Uint16                          m_Divider;                      ///< @brief The APU's internal divider.
-    Uint64                          m_MixClockFrequency;            ///< @brief How often should the mix callback be called.
+    Uint32                          m_SampleRate;                   ///< @brief The rate audio samples are mixed at, in Hz.
+    Uint64                          m_MixPeriod;                    ///< @brief The whole number of cycles between two mixes.
+    Uint64                          m_MixPeriodRemainder;           ///< @brief The fraction of a cycle between two mixes, in `GABLE_MIX_PHASE_SCALE * m_SampleRate`ths of a cycle.
+    Uint64                          m_MixPhase;                     ///< @brief The fraction of a cycle carried over by the mixes so far, in the same units.
+    Float64                         m_RateAdjustment;               ///< @brief The dynamic rate control's adjustment to the sample rate, as a fraction of it.
+    Uint64                          m_MixCount;                     ///< @brief The number of audio samples mixed so far.
+    Uint64                          m_PreviousMixCycle;             ///< @brief The engine cycle the last audio sample was mixed on.
+    Uint64                          m_NextMixCycle;                 ///< @brief The engine cycle the next audio sample will be mixed on.
+    Uint64                          m_SyncedCycles;                 ///< @brief The engine cycle the APU has been rendered up to.
+
+    // Audio Sample Ring - The counters below are shared with the host's audio thread, and are
+    // only ever accessed with atomic operations. They are kept last, so that `GABLE_ResetAPU` can
+    // clear everything before them without touching the reading thread's counter.
+    GABLE_AudioSample*              m_SampleRing;                   ///< @brief The ring of mixed audio samples.
+    Count                           m_SampleRingCapacity;           ///< @brief The capacity of the ring. Always a power of two.
+    Uint64                          m_SamplesWritten;               ///< @brief The number of samples ever pushed into the ring. Written by the engine's thread only.
+    Uint64                          m_SamplesRead;                  ///< @brief The number of samples ever read out of the ring. Written by the reading thread only.
+    Uint64                          m_Underruns;                    ///< @brief The number of samples asked for, but not waiting in the ring.
+    Uint64                          m_Overruns;                     ///< @brief The number of samples dropped because the ring was full.
+    Float64                         m_RequestedRateAdjustment;      ///< @brief The dynamic rate control's adjustment, as last worked out from the host's buffer fill level. Applied by `GABLE_SyncAPU`.
 
 } GABLE_APU;
 
+// Static Members //////////////////////////////////////////////////////////////////////////////////
+
+// The noise channel's LFSR sequence tables. These are built once, by the first APU created, and are
+// only ever read after that. The 7-bit mode's states are stored by their lower seven bits only; see
+// `GABLE_GetNoiseState`.
+static Bool   s_NoiseTablesBuilt = false;                                  ///< @brief Have the tables been built?
+static Uint16 s_NoiseStates15[GABLE_NOISE_PERIOD_15];                     ///< @brief The 15-bit mode's states, in sequence.
+static Uint16 s_NoisePositions15[0x8000];                                 ///< @brief Each 15-bit state's position in the sequence.
+static Uint64 s_NoiseBits15[GABLE_NOISE_BIT_WORDS_15];                    ///< @brief The 15-bit mode's output bits, in sequence, repeating.
+static Uint8  s_NoiseStates7[GABLE_NOISE_PERIOD_7];                       ///< @brief The 7-bit mode's states, in sequence.
+static Uint8  s_NoisePositions7[0x80];                                    ///< @brief Each 7-bit state's position in the sequence.
+static Uint64 s_NoiseBits7[GABLE_NOISE_BIT_WORDS_7];                      ///< @brief The 7-bit mode's output bits, in sequence, repeating.
+
 // Static Function Prototypes //////////////////////////////////////////////////////////////////////
 
 static void GABLE_TriggerChannelInternal (GABLE_APU* p_APU, GABLE_AudioChannel p_Channel);
 static Uint8 GABLE_ReadWaveNibble (const GABLE_APU* p_APU, Uint8 p_Index);
 static void GABLE_WriteWaveNibble (GABLE_APU* p_APU, Uint8 p_Index, Uint8 p_Value);
-static void GABLE_TickPulseChannels (GABLE_APU* p_APU);
-static void GABLE_TickWaveChannel (GABLE_APU* p_APU);
-static void GABLE_TickNoiseChannel (GABLE_APU* p_APU);
+static void GABLE_BuildBlipKernel (GABLE_APU* p_APU);
+static void GABLE_GetChannelLevel (const GABLE_APU* p_APU, GABLE_AudioChannel p_Channel, Int32* p_Left,
+    Int32* p_Right);
+static Bool GABLE_IsChannelStatic (const GABLE_APU* p_APU, GABLE_AudioChannel p_Channel);
+static void GABLE_UpdateBlipLevel (GABLE_APU* p_APU, GABLE_AudioChannel p_Channel, Uint64 p_Cycle);
+static void GABLE_UpdateBlipLevels (GABLE_APU* p_APU, Uint64 p_Cycle);
+static void GABLE_ReadBlipSample (GABLE_APU* p_APU, Index p_Slot);
+static void GABLE_UpdateMixPeriod (GABLE_APU* p_APU);
+static void GABLE_StartMixClock (GABLE_APU* p_APU, Uint64 p_Cycle);
+static void GABLE_AdvanceMixClock (GABLE_APU* p_APU);
+static void GABLE_ResetChannelTimer (GABLE_APU* p_APU, GABLE_AudioChannel p_Channel);
+static Uint16 GABLE_StepNoiseLFSR (Uint16 p_LFSR, Bool p_Short);
+static void GABLE_BuildNoiseTables ();
+static Bool GABLE_FindNoisePosition (const GABLE_NoiseChannel* p_Channel, Uint32* p_Position);
+static Uint16 GABLE_GetNoiseState (Bool p_Short, Uint32 p_Position);
+static Uint32 GABLE_GetNoiseRunLength (Bool p_Short, Uint32 p_Position);
+static Uint32 GABLE_AdvanceNoisePosition (Bool p_Short, Uint32 p_Position, Uint64 p_Steps);
+static void GABLE_UpdateNoiseDAC (GABLE_NoiseChannel* p_Channel);
+static void GABLE_ClockPulseChannel (GABLE_PulseChannel* p_Channel, Uint64 p_Overflows);
+static void GABLE_ClockWaveChannel (GABLE_APU* p_APU, Uint64 p_Overflows);
+static void GABLE_TickPulseChannel (GABLE_APU* p_APU, GABLE_AudioChannel p_Channel, Uint64 p_FromCycle,
+    Uint64 p_ToCycle);
+static void GABLE_TickWaveChannel (GABLE_APU* p_APU, Uint64 p_FromCycle, Uint64 p_ToCycle);
+static void GABLE_TickNoiseChannel (GABLE_APU* p_APU, Uint64 p_FromCycle, Uint64 p_ToCycle);
 static void GABLE_TickLengthTimers (GABLE_APU* p_APU);
 static void GABLE_TickFrequencySweep (GABLE_APU* p_APU);
 static void GABLE_TickEnvelopeSweeps (GABLE_APU* p_APU);
+static void GABLE_TickDividerAPU (GABLE_APU* p_APU, GABLE_Engine* p_Engine);
+static void GABLE_TickChannels (GABLE_APU* p_APU, Uint64 p_FromCycle, Uint64 p_ToCycle);
+static void GABLE_CapturePointSample (GABLE_APU* p_APU, Index p_Slot);
+static void GABLE_MixBlockScalar (GABLE_APU* p_APU, Index p_From, Index p_To);
+static void GABLE_MixBlockVector (GABLE_APU* p_APU);
+static void GABLE_FilterBlockScalar (GABLE_APU* p_APU, Index p_From, Index p_To);
+static void GABLE_FilterBlockVector (GABLE_APU* p_APU);
+static void GABLE_FlushMixBlock (GABLE_Engine* p_Engine, GABLE_APU* p_APU);
 static void GABLE_UpdateAudioSample (GABLE_Engine* p_Engine, GABLE_APU* p_APU);
 
 // Static Functions ////////////////////////////////////////////////////////////////////////////////
@@ -270,7 +406,7 @@ void GABLE_TriggerChannelInternal (GABLE_APU* p_APU, GABLE_AudioChannel p_Channe
             p_Channel->m_CurrentLengthTimer = p_Channel->m_LengthDuty.m_InitialLength;
             p_Channel->m_CurrentVolume = p_Channel->m_VolumeEnvelope.m_InitialVolume;
             p_Channel->m_CurrentPeriod = (p_Channel->m_PeriodHighControl.m_PeriodHigh << 8) | p_Channel->m_PeriodLow.m_PeriodLow;
-            p_Channel->m_PeriodDivider = p_Channel->m_CurrentPeriod;
+            GABLE_ResetChannelTimer(p_APU, GABLE_AC_PULSE_1);
             p_Channel->m_CurrentWavePointer = 0;
             p_Channel->m_CurrentFrequencyTicks = 0;
             p_Channel->m_CurrentEnvelopeTicks = 0;
@@ -288,7 +424,7 @@ void GABLE_TriggerChannelInternal (GABLE_APU* p_APU, GABLE_AudioChannel p_Channe
             p_Channel->m_CurrentLengthTimer = p_Channel->m_LengthDuty.m_InitialLength;
             p_Channel->m_CurrentVolume = p_Channel->m_VolumeEnvelope.m_InitialVolume;
             p_Channel->m_CurrentPeriod = (p_Channel->m_PeriodHighControl.m_PeriodHigh << 8) | p_Channel->m_PeriodLow.m_PeriodLow;
-            p_Channel->m_PeriodDivider = p_Channel->m_CurrentPeriod;
+            GABLE_ResetChannelTimer(p_APU, GABLE_AC_PULSE_2);
             p_Channel->m_CurrentWavePointer = 0;
             p_Channel->m_CurrentFrequencyTicks = 0;
             p_Channel->m_CurrentEnvelopeTicks = 0;
@@ -305,7 +441,7 @@ void GABLE_TriggerChannelInternal (GABLE_APU* p_APU, GABLE_AudioChannel p_Channe
             // Trigger the channel
             p_Channel->m_CurrentLengthTimer = p_Channel->m_LengthTimer.m_InitialLength;
             p_Channel->m_CurrentPeriod = (p_Channel->m_PeriodHighControl.m_PeriodHigh << 8) | p_Channel->m_PeriodLow.m_PeriodLow;
-            p_Channel->m_PeriodDivider = p_Channel->m_CurrentPeriod;
+            GABLE_ResetChannelTimer(p_APU, GABLE_AC_WAVE);
             p_Channel->m_CurrentSampleIndex = 0;
 
             // Enable the channel only if its DAC is enabled.
@@ -322,6 +458,7 @@ void GABLE_TriggerChannelInternal (GABLE_APU* p_APU, GABLE_AudioChannel p_Channe
             p_Channel->m_CurrentVolume = p_Channel->m_VolumeEnvelope.m_InitialVolume;
             p_Channel->m_LFSR = 0;
             p_Channel->m_CurrentEnvelopeTicks = 0;
+            GABLE_ResetChannelTimer(p_APU, GABLE_AC_NOISE);
 
             // Enable the channel only if its DAC is enabled.
             p_APU->m_MasterControl.m_NCEnable = p_Channel->m_DACEnabled;
@@ -374,139 +511,712 @@ void GABLE_WriteWaveNibble (GABLE_APU* p_APU, Uint8 p_Index, Uint8 p_Value)
     p_APU->m_WaveChannel.m_WaveRAM[l_ByteIndex] = l_Byte;
 }
 
-void GABLE_TickPulseChannels (GABLE_APU* p_APU)
+void GABLE_BuildBlipKernel (GABLE_APU* p_APU)
 {
 
-    // Point to PC1.
-    GABLE_PulseChannel* p_Channel = &p_APU->m_PulseChannel1;
+    // Each row of the table holds a band-limited impulse: a sinc function, cut off a little below
+    // the Nyquist frequency and shaped by a Blackman window, sampled at the offsets of the
+    // `GABLE_BLIP_WIDTH` samples around a step which falls `p / GABLE_BLIP_PHASES` of the way
+    // between two samples. Summing those impulses up turns each step into a band-limited one.
+    static const Float64 L_PI = 3.14159265358979323846;
+    for (Index p = 0; p < GABLE_BLIP_PHASES; ++p)
+    {
+        Float64 l_Taps[GABLE_BLIP_WIDTH];
+        Float64 l_Sum = 0.0;
+        for (Index i = 0; i < GABLE_BLIP_WIDTH; ++i)
+        {
+            Float64 l_X = ((Float64) i - (GABLE_BLIP_WIDTH / 2) + 1) - ((Float64) p / GABLE_BLIP_PHASES);
+            Float64 l_Angle = L_PI * 2.0 * GABLE_BLIP_CUTOFF * l_X;
+            Float64 l_Sinc = (l_X == 0.0) ? 1.0 : sin(l_Angle) / l_Angle;
+            Float64 l_Window = (l_X + (GABLE_BLIP_WIDTH / 2)) / GABLE_BLIP_WIDTH;
+            l_Window = 0.42 - 0.5 * cos(2.0 * L_PI * l_Window) + 0.08 * cos(4.0 * L_PI * l_Window);
+            l_Taps[i] = l_Sinc * l_Window;
+            l_Sum += l_Taps[i];
+        }
 
-    // If the channel is enabled, then increment its period divider. When that value exceeds 2047 (0x7FF),
-    // the divider overflows and is then reset to the channel's period.
-    if (p_APU->m_MasterControl.m_PC1Enable && ++p_Channel->m_PeriodDivider > 0x800)
+        // Scale each row so that its entries add up to exactly `GABLE_BLIP_KERNEL_UNITY`, folding
+        // any rounding error into the centre entry, so that every step settles at exactly its
+        // full height.
+        Int32 l_Total = 0;
+        for (Index i = 0; i < GABLE_BLIP_WIDTH; ++i)
+        {
+            p_APU->m_BlipKernel[p][i] = (Int16) lround(l_Taps[i] * GABLE_BLIP_KERNEL_UNITY / l_Sum);
+            l_Total += p_APU->m_BlipKernel[p][i];
+        }
+
+        p_APU->m_BlipKernel[p][GABLE_BLIP_WIDTH / 2 - 1] += (Int16) (GABLE_BLIP_KERNEL_UNITY - l_Total);
+    }
+
+}
+
+void GABLE_GetChannelLevel (const GABLE_APU* p_APU, GABLE_AudioChannel p_Channel, Int32* p_Left,
+    Int32* p_Right)
+{
+
+    // Work out whether the channel is being heard, what its DAC is outputting, and which speakers
+    // it is panned to, in the same manner as the point-sampled mix does.
+    Bool l_Audible = false, l_Left = false, l_Right = false;
+    Float32 l_Output = 0.0f;
+    switch (p_Channel)
     {
+        case GABLE_AC_PC1:
+            l_Audible = p_APU->m_MasterControl.m_PC1Enable && p_APU->m_PulseChannel1.m_DACEnabled;
+            l_Output = p_APU->m_PulseChannel1.m_DACOutput;
+            l_Left = p_APU->m_SoundPanning.m_PC1Left;
+            l_Right = p_APU->m_SoundPanning.m_PC1Right;
+            break;
+        case GABLE_AC_PC2:
+            l_Audible = p_APU->m_MasterControl.m_PC2Enable && p_APU->m_PulseChannel2.m_DACEnabled;
+            l_Output = p_APU->m_PulseChannel2.m_DACOutput;
+            l_Left = p_APU->m_SoundPanning.m_PC2Left;
+            l_Right = p_APU->m_SoundPanning.m_PC2Right;
+            break;
+        case GABLE_AC_WC:
+            l_Audible = p_APU->m_MasterControl.m_WCEnable && p_APU->m_WaveChannel.m_DACEnable.m_DACPower;
+            l_Output = p_APU->m_WaveChannel.m_DACOutput;
+            l_Left = p_APU->m_SoundPanning.m_WCLeft;
+            l_Right = p_APU->m_SoundPanning.m_WCRight;
+            break;
+        case GABLE_AC_NC:
+            l_Audible = p_APU->m_MasterControl.m_NCEnable && p_APU->m_NoiseChannel.m_DACEnabled;
+            l_Output = p_APU->m_NoiseChannel.m_DACOutput;
+            l_Left = p_APU->m_SoundPanning.m_NCLeft;
+            l_Right = p_APU->m_SoundPanning.m_NCRight;
+            break;
+    }
 
-        // Reset the period divider to the channel's current period. The difference between this
-        // value and the overflow value (0x800) determines the channel's frequency.
-        p_Channel->m_PeriodDivider = p_Channel->m_CurrentPeriod;
+    // The channel's contribution to each speaker is then affected by that speaker's master
+    // volume, and converted to fixed-point.
+    *p_Left = (l_Audible && l_Left) ? (Int32) lrintf(l_Output *
+        (p_APU->m_MasterVolumeControl.m_LeftVolume / 7.5f) * GABLE_BLIP_LEVEL_SCALE) : 0;
+    *p_Right = (l_Audible && l_Right) ? (Int32) lrintf(l_Output *
+        (p_APU->m_MasterVolumeControl.m_RightVolume / 7.5f) * GABLE_BLIP_LEVEL_SCALE) : 0;
 
-        // Advance the wave pointer by one place.
-        p_Channel->m_CurrentWavePointer = (p_Channel->m_CurrentWavePointer + 1) & 0b111;
+}
 
-        // The channel's DAC input value is set to the pointed-to bit in the current duty cycle pattern...
-        p_Channel->m_DACInput = (
-            GABLE_WAVE_DUTY_PATTERNS[p_Channel->m_LengthDuty.m_DutyCycle] 
-                >> p_Channel->m_CurrentWavePointer
-        ) & 0b1;
+Bool GABLE_IsChannelStatic (const GABLE_APU* p_APU, GABLE_AudioChannel p_Channel)
+{
 
-        // ...then multiplied by the channel's current volume.
-        p_Channel->m_DACInput *= p_Channel->m_CurrentVolume;
+    // A channel's contribution to the mix is fixed if it isn't heard by either speaker...
+    const GABLE_SoundPanning* l_Panning = &p_APU->m_SoundPanning;
+    Bool l_Left = false, l_Right = false;
+    switch (p_Channel)
+    {
+        case GABLE_AC_PC1:  l_Left = l_Panning->m_PC1Left;  l_Right = l_Panning->m_PC1Right;  break;
+        case GABLE_AC_PC2:  l_Left = l_Panning->m_PC2Left;  l_Right = l_Panning->m_PC2Right;  break;
+        case GABLE_AC_WC:   l_Left = l_Panning->m_WCLeft;   l_Right = l_Panning->m_WCRight;   break;
+        case GABLE_AC_NC:   l_Left = l_Panning->m_NCLeft;   l_Right = l_Panning->m_NCRight;   break;
+    }
 
-        // The channel's DAC input is then translated to an analog DAC output value, by...
-        // - Dividing the input by 7.5, then subtracting 1.0.
-        p_Channel->m_DACOutput = -(((Float32) p_Channel->m_DACInput / 7.5f) - 1.0f);
+    if ((l_Left == false || p_APU->m_MasterVolumeControl.m_LeftVolume == 0) &&
+        (l_Right == false || p_APU->m_MasterVolumeControl.m_RightVolume == 0))
+    {
+        return true;
+    }
 
+    // ...or if its DAC input is held at zero, whatever its timer does. The envelopes only change
+    // the channels' volumes on "DIV-APU" ticks, and the wave channel's output level only changes
+    // on a write to `NR32`, so this holds until the end of the current run at least.
+    switch (p_Channel)
+    {
+        case GABLE_AC_PC1:  return p_APU->m_PulseChannel1.m_CurrentVolume == 0;
+        case GABLE_AC_PC2:  return p_APU->m_PulseChannel2.m_CurrentVolume == 0;
+        case GABLE_AC_WC:   return p_APU->m_WaveChannel.m_OutputLevel.m_OutputLevel == GABLE_WOL_MUTE;
+        case GABLE_AC_NC:   return p_APU->m_NoiseChannel.m_CurrentVolume == 0;
     }
 
-    // Repeat the above process for PC2.
-    p_Channel = &p_APU->m_PulseChannel2;
-    if (p_APU->m_MasterControl.m_PC2Enable && ++p_Channel->m_PeriodDivider > 0x800)
+    return false;
+
+}
+
+void GABLE_UpdateBlipLevel (GABLE_APU* p_APU, GABLE_AudioChannel p_Channel, Uint64 p_Cycle)
+{
+
+    // Get the channel's current contribution to each speaker. If neither has changed since it was
+    // last recorded, then there's no step to record.
+    Int32 l_Left = 0, l_Right = 0;
+    GABLE_GetChannelLevel(p_APU, p_Channel, &l_Left, &l_Right);
+    Int32 l_LeftDelta = l_Left - p_APU->m_BlipLeftLevels[p_Channel];
+    Int32 l_RightDelta = l_Right - p_APU->m_BlipRightLevels[p_Channel];
+    if (l_LeftDelta == 0 && l_RightDelta == 0)
+    {
+        return;
+    }
+
+    p_APU->m_BlipLeftLevels[p_Channel] = l_Left;
+    p_APU->m_BlipRightLevels[p_Channel] = l_Right;
+
+    // Find the sample the step falls after, and how far it falls between that sample and the next.
+    // A step on the very cycle the next sample is due falls right on that sample, since the sample
+    // is mixed after the channels are ticked. Then spread the step over the samples after it. The
+    // spread is delayed by half of the table's width, so that no step ever lands on a sample which
+    // has already been mixed.
+    Uint64 l_Sample = p_APU->m_MixCount;
+    Index l_Phase = 0;
+    if (p_Cycle >= p_APU->m_NextMixCycle)
+    {
+        l_Sample++;
+    }
+    else
+    {
+        l_Phase = (p_Cycle - p_APU->m_PreviousMixCycle) * GABLE_BLIP_PHASES /
+            (p_APU->m_NextMixCycle - p_APU->m_PreviousMixCycle);
+    }
+
+    const Int16* l_Kernel = p_APU->m_BlipKernel[l_Phase];
+    for (Index i = 0; i < GABLE_BLIP_WIDTH; ++i)
+    {
+        Index l_Index = (l_Sample + 1 + i) & (GABLE_BLIP_BUFFER_SIZE - 1);
+        p_APU->m_BlipLeft[l_Index] += (Int64) l_LeftDelta * l_Kernel[i];
+        p_APU->m_BlipRight[l_Index] += (Int64) l_RightDelta * l_Kernel[i];
+    }
+
+}
+
+void GABLE_UpdateBlipLevels (GABLE_APU* p_APU, Uint64 p_Cycle)
+{
+    GABLE_UpdateBlipLevel(p_APU, GABLE_AC_PC1, p_Cycle);
+    GABLE_UpdateBlipLevel(p_APU, GABLE_AC_PC2, p_Cycle);
+    GABLE_UpdateBlipLevel(p_APU, GABLE_AC_WC, p_Cycle);
+    GABLE_UpdateBlipLevel(p_APU, GABLE_AC_NC, p_Cycle);
+}
+
+void GABLE_ReadBlipSample (GABLE_APU* p_APU, Index p_Slot)
+{
+
+    // Add the sample's pending step contributions to the running sums, then clear its slot in the
+    // buffer for the sample `GABLE_BLIP_BUFFER_SIZE` places on.
+    Index l_Index = (p_APU->m_MixCount + 1) & (GABLE_BLIP_BUFFER_SIZE - 1);
+    p_APU->m_BlipLeftSum += p_APU->m_BlipLeft[l_Index];
+    p_APU->m_BlipRightSum += p_APU->m_BlipRight[l_Index];
+    p_APU->m_BlipLeft[l_Index] = 0;
+    p_APU->m_BlipRight[l_Index] = 0;
+
+    // Convert the running sums back out of fixed-point.
+    static const Float64 L_SCALE = 1.0 / (GABLE_BLIP_LEVEL_SCALE * GABLE_BLIP_KERNEL_UNITY);
+    p_APU->m_MixBlockLeft[p_Slot] = (Float32) ((Float64) p_APU->m_BlipLeftSum * L_SCALE);
+    p_APU->m_MixBlockRight[p_Slot] = (Float32) ((Float64) p_APU->m_BlipRightSum * L_SCALE);
+
+}
+
+void GABLE_UpdateMixPeriod (GABLE_APU* p_APU)
+{
+
+    // The APU's clock rate is rarely a whole multiple of the sample rate, so the time between two
+    // mixes is split into a whole number of cycles and a remainder, in fine fractions of a cycle.
+    // The remainders are carried from mix to mix, in the manner of a fixed-point phase accumulator,
+    // and each time they add up to a whole cycle, one mix is pushed back by a cycle. This keeps the
+    // long-run rate exact, with no rounding drift.
+    //
+    // The dynamic rate control's adjustment stretches or shrinks the period, in the same units.
+    // With no adjustment, the period is exactly `4194304 / m_SampleRate` cycles.
+    Uint64 l_Denominator = (Uint64) p_APU->m_SampleRate * GABLE_MIX_PHASE_SCALE;
+    Uint64 l_Numerator = 4194304ULL * GABLE_MIX_PHASE_SCALE;
+    if (p_APU->m_RateAdjustment != 0.0)
+    {
+        l_Numerator = (Uint64) llround((Float64) l_Numerator / (1.0 + p_APU->m_RateAdjustment));
+    }
+
+    p_APU->m_MixPeriod = l_Numerator / l_Denominator;
+    p_APU->m_MixPeriodRemainder = l_Numerator % l_Denominator;
+
+}
+
+void GABLE_StartMixClock (GABLE_APU* p_APU, Uint64 p_Cycle)
+{
+
+    // Work out the time between two mixes, then schedule the first mix.
+    GABLE_UpdateMixPeriod(p_APU);
+    p_APU->m_MixPhase = 0;
+    p_APU->m_NextMixCycle = p_Cycle;
+    GABLE_AdvanceMixClock(p_APU);
+
+    // The high-pass filter's coefficient applies once per sample, so scale it to keep its cutoff
+    // frequency the same at every sample rate.
+    p_APU->m_HighPassAlpha = (Float32) pow(0.999958, (Float64) GABLE_AUDIO_SAMPLE_RATE / p_APU->m_SampleRate);
+
+}
+
+void GABLE_AdvanceMixClock (GABLE_APU* p_APU)
+{
+    p_APU->m_PreviousMixCycle = p_APU->m_NextMixCycle;
+    p_APU->m_NextMixCycle += p_APU->m_MixPeriod;
+    p_APU->m_MixPhase += p_APU->m_MixPeriodRemainder;
+    if (p_APU->m_MixPhase >= (Uint64) p_APU->m_SampleRate * GABLE_MIX_PHASE_SCALE)
+    {
+        p_APU->m_MixPhase -= (Uint64) p_APU->m_SampleRate * GABLE_MIX_PHASE_SCALE;
+        p_APU->m_NextMixCycle++;
+    }
+}
+
+void GABLE_ResetChannelTimer (GABLE_APU* p_APU, GABLE_AudioChannel p_Channel)
+{
+
+    // The channels' timers count down the cycles left until their next event, starting from the
+    // last synced cycle, which is where any register write or sweep which resets them happens.
+    Uint64 l_Cycle = p_APU->m_SyncedCycles;
+    switch (p_Channel)
+    {
+
+        // The pulse channels' period dividers are ticked on every fourth cycle, and the wave
+        // channel's on every second cycle. Once reset to the channel's period, a divider overflows
+        // `0x801 - period` ticks later, counting from the next tick.
+        case GABLE_AC_PULSE_1:
+            p_APU->m_PulseChannel1.m_PeriodTimer = (4 - (l_Cycle & 0b11)) +
+                (0x800 - p_APU->m_PulseChannel1.m_CurrentPeriod) * 4;
+            break;
+        case GABLE_AC_PULSE_2:
+            p_APU->m_PulseChannel2.m_PeriodTimer = (4 - (l_Cycle & 0b11)) +
+                (0x800 - p_APU->m_PulseChannel2.m_CurrentPeriod) * 4;
+            break;
+        case GABLE_AC_WAVE:
+            p_APU->m_WaveChannel.m_PeriodTimer = (2 - (l_Cycle & 0b1)) +
+                (0x800 - p_APU->m_WaveChannel.m_CurrentPeriod) * 2;
+            break;
+
+        // The noise channel's LFSR is stepped on every cycle which is a multiple of its clock
+        // frequency.
+        case GABLE_AC_NOISE:
+            p_APU->m_NoiseChannel.m_StepTimer = p_APU->m_NoiseChannel.m_CurrentClockFrequency -
+                (l_Cycle % p_APU->m_NoiseChannel.m_CurrentClockFrequency);
+            break;
+
+    }
+
+}
+
+Uint16 GABLE_StepNoiseLFSR (Uint16 p_LFSR, Bool p_Short)
+{
+
+    // Get bits 0 and 1 of the LFSR.
+    Uint8 bit0 = (p_LFSR >> 0) & 0b1;
+    Uint8 bit1 = (p_LFSR >> 1) & 0b1;
+
+    // Determine the new value of bit 15 (and 7 if the LFSR width is set).
+    Uint8 bit15 = (bit0 == bit1) ? 1 : 0;
+
+    // Set the new value of bit 15 (and 7 if the LFSR width is set).
+    p_LFSR |= (bit15 << 15);
+    if (p_Short)
+    {
+        p_LFSR |= (bit15 << 7);
+    }
+
+    // Shift the LFSR right by one bit, then clear the new value of bit 15 (and 7 if the LFSR width is set).
+    p_LFSR >>= 1;
+    p_LFSR &= ~(1 << 15);
+    if (p_Short)
+    {
+        p_LFSR &= ~(1 << 7);
+    }
+
+    return p_LFSR;
+
+}
+
+void GABLE_BuildNoiseTables ()
+{
+    if (__atomic_load_n(&s_NoiseTablesBuilt, __ATOMIC_ACQUIRE) == true)
+    {
+        return;
+    }
+
+    // Both sequences start from zero, which is where the LFSR is reset to when the channel is
+    // triggered. States which aren't part of a sequence (the all-ones lock-up states) are marked
+    // as having no position.
+    memset(s_NoisePositions15, 0xFF, sizeof(s_NoisePositions15));
+    memset(s_NoisePositions7, 0xFF, sizeof(s_NoisePositions7));
+    memset(s_NoiseBits15, 0, sizeof(s_NoiseBits15));
+    memset(s_NoiseBits7, 0, sizeof(s_NoiseBits7));
+
+    Uint16 l_LFSR = 0;
+    for (Index i = 0; i < GABLE_NOISE_PERIOD_15; ++i)
+    {
+        s_NoiseStates15[i] = l_LFSR;
+        s_NoisePositions15[l_LFSR] = (Uint16) i;
+        l_LFSR = GABLE_StepNoiseLFSR(l_LFSR, false);
+    }
+
+    l_LFSR = 0;
+    for (Index i = 0; i < GABLE_NOISE_PERIOD_7; ++i)
+    {
+        s_NoiseStates7[i] = (Uint8) (l_LFSR & 0x7F);
+        s_NoisePositions7[l_LFSR & 0x7F] = (Uint8) i;
+        l_LFSR = GABLE_StepNoiseLFSR(l_LFSR, true);
+    }
+
+    // The output bit tables repeat their sequences past the end of one period, so that 64 bits can
+    // be read from any position without wrapping around.
+    for (Index i = 0; i < GABLE_NOISE_BIT_WORDS_15 * 64; ++i)
+    {
+        s_NoiseBits15[i / 64] |= (Uint64) (s_NoiseStates15[i % GABLE_NOISE_PERIOD_15] & 0b1) << (i % 64);
+    }
+
+    for (Index i = 0; i < GABLE_NOISE_BIT_WORDS_7 * 64; ++i)
+    {
+        s_NoiseBits7[i / 64] |= (Uint64) (s_NoiseStates7[i % GABLE_NOISE_PERIOD_7] & 0b1) << (i % 64);
+    }
+
+    __atomic_store_n(&s_NoiseTablesBuilt, true, __ATOMIC_RELEASE);
+}
+
+Bool GABLE_FindNoisePosition (const GABLE_NoiseChannel* p_Channel, Uint32* p_Position)
+{
+
+    // In 15-bit mode, every state but the lock-up state is part of the sequence.
+    if (p_Channel->m_FrequencyRandomness.m_LFSRWidth == 0)
+    {
+        *p_Position = s_NoisePositions15[p_Channel->m_LFSR & 0x7FFF];
+        return *p_Position != GABLE_NOISE_NO_POSITION_15;
+    }
+
+    // In 7-bit mode, the output only depends on the lower seven bits. Bits 8 to 14 hold a copy of
+    // those, and bit 7 is clear; the LFSR settles into that form within a few steps of being
+    // switched into 7-bit mode, and is only in the sequence once it has.
+    Uint8 l_Lower = p_Channel->m_LFSR & 0x7F;
+    if (p_Channel->m_LFSR != (l_Lower | (l_Lower << 8)))
+    {
+        return false;
+    }
+
+    *p_Position = s_NoisePositions7[l_Lower];
+    return *p_Position != GABLE_NOISE_NO_POSITION_7;
+
+}
+
+Uint16 GABLE_GetNoiseState (Bool p_Short, Uint32 p_Position)
+{
+    if (p_Short == false)
+    {
+        return s_NoiseStates15[p_Position];
+    }
+
+    Uint16 l_Lower = s_NoiseStates7[p_Position];
+    return l_Lower | (l_Lower << 8);
+}
+
+Uint32 GABLE_GetNoiseRunLength (Bool p_Short, Uint32 p_Position)
+{
+
+    // Read the 64 output bits following the given position, flipped if need be so that a set bit
+    // marks a change from the output at that position. Neither sequence has a run longer than 15
+    // bits, so a change is always found.
+    const Uint64* l_Bits = (p_Short == true) ? s_NoiseBits7 : s_NoiseBits15;
+    Uint32 l_Start = p_Position + 1;
+    Uint32 l_Shift = l_Start % 64;
+    Uint64 l_Next = l_Bits[l_Start / 64] >> l_Shift;
+    if (l_Shift != 0)
     {
-        p_Channel->m_PeriodDivider = p_Channel->m_CurrentPeriod;
-        p_Channel->m_CurrentWavePointer = (p_Channel->m_CurrentWavePointer + 1) & 0b111;
-        p_Channel->m_DACInput = (
-            GABLE_WAVE_DUTY_PATTERNS[p_Channel->m_LengthDuty.m_DutyCycle] 
-                >> p_Channel->m_CurrentWavePointer
-        ) & 0b1;
-        p_Channel->m_DACInput *= p_Channel->m_CurrentVolume;
-        p_Channel->m_DACOutput = -(((Float32) p_Channel->m_DACInput / 7.5f) - 1.0f);
+        l_Next |= l_Bits[l_Start / 64 + 1] << (64 - l_Shift);
     }
 
+    if (((l_Bits[p_Position / 64] >> (p_Position % 64)) & 0b1) == 1)
+    {
+        l_Next = ~l_Next;
+    }
+
+    return (Uint32) __builtin_ctzll(l_Next) + 1;
+
 }
 
-void GABLE_TickWaveChannel (GABLE_APU* p_APU)
+Uint32 GABLE_AdvanceNoisePosition (Bool p_Short, Uint32 p_Position, Uint64 p_Steps)
+{
+    Uint32 l_Period = (p_Short == true) ? GABLE_NOISE_PERIOD_7 : GABLE_NOISE_PERIOD_15;
+    Uint64 l_Position = p_Position + p_Steps;
+    return (Uint32) ((l_Position < l_Period) ? l_Position : (l_Position % l_Period));
+}
+
+void GABLE_UpdateNoiseDAC (GABLE_NoiseChannel* p_Channel)
+{
+
+    // The value of bit 0 of the LFSR determines the DAC input value, which is then multiplied by the channel's current volume.
+    p_Channel->m_DACInput = (p_Channel->m_LFSR & 0b1) * p_Channel->m_CurrentVolume;
+
+    // The channel's DAC input is then translated to an analog DAC output value, by...
+    // - Dividing the input by 7.5, then subtracting 1.0.
+    p_Channel->m_DACOutput = -(((Float32) p_Channel->m_DACInput / 7.5f) - 1.0f);
+
+}
+
+void GABLE_ClockPulseChannel (GABLE_PulseChannel* p_Channel, Uint64 p_Overflows)
+{
+
+    // Advance the wave pointer by one place for each overflow.
+    p_Channel->m_CurrentWavePointer = (p_Channel->m_CurrentWavePointer + p_Overflows) & 0b111;
+
+    // The channel's DAC input value is set to the pointed-to bit in the current duty cycle pattern...
+    p_Channel->m_DACInput = (
+        GABLE_WAVE_DUTY_PATTERNS[p_Channel->m_LengthDuty.m_DutyCycle] 
+            >> p_Channel->m_CurrentWavePointer
+    ) & 0b1;
+
+    // ...then multiplied by the channel's current volume.
+    p_Channel->m_DACInput *= p_Channel->m_CurrentVolume;
+
+    // The channel's DAC input is then translated to an analog DAC output value, by...
+    // - Dividing the input by 7.5, then subtracting 1.0.
+    p_Channel->m_DACOutput = -(((Float32) p_Channel->m_DACInput / 7.5f) - 1.0f);
+
+}
+
+void GABLE_ClockWaveChannel (GABLE_APU* p_APU, Uint64 p_Overflows)
 {
 
     // Point to the wave channel.
     GABLE_WaveChannel* p_Channel = &p_APU->m_WaveChannel;
 
-    // If the channel is enabled, then increment its period divider. When that value exceeds 2047 (0x7FF),
-    // the divider overflows and is then reset to the channel's period.
-    if (p_APU->m_MasterControl.m_WCEnable && ++p_Channel->m_PeriodDivider > 0x800)
+    // Advance the sample index by one place for each overflow.
+    p_Channel->m_CurrentSampleIndex = (p_Channel->m_CurrentSampleIndex + p_Overflows) % GABLE_WAVE_RAM_NIBBLES;
+
+    // The channel's DAC input value is set to the pointed-to 4-bit sample in the wave RAM buffer...
+    p_Channel->m_DACInput = GABLE_ReadWaveNibble(p_APU, p_Channel->m_CurrentSampleIndex);
+
+    // ...then affected by the channel's wave output level.
+    switch (p_Channel->m_OutputLevel.m_OutputLevel)
     {
+        case GABLE_WOL_MUTE:
+            p_Channel->m_DACInput = 0;
+            break;
+        case GABLE_WOL_FULL:
+            break;
+        case GABLE_WOL_HALF:
+            p_Channel->m_DACInput >>= 1;
+            break;
+        case GABLE_WOL_QUARTER:
+            p_Channel->m_DACInput >>= 2;
+            break;
+    }
 
-        // Reset the period divider to the channel's current period. The difference between this
-        // value and the overflow value (0x800) determines the channel's frequency.
-        p_Channel->m_PeriodDivider = p_Channel->m_CurrentPeriod;
-        
-        // Advance the sample index by one place.
-        p_Channel->m_CurrentSampleIndex = (p_Channel->m_CurrentSampleIndex + 1) % GABLE_WAVE_RAM_NIBBLES;
+    // The channel's DAC input is then translated to an analog DAC output value, by...
+    // - Dividing the input by 7.5, then subtracting 1.0.
+    p_Channel->m_DACOutput = -(((Float32) p_Channel->m_DACInput / 7.5f) - 1.0f);
+
+}
 
-        // The channel's DAC input value is set to the pointed-to 4-bit sample in the wave RAM buffer...
-        p_Channel->m_DACInput = GABLE_ReadWaveNibble(p_APU, p_Channel->m_CurrentSampleIndex);
+void GABLE_TickPulseChannel (GABLE_APU* p_APU, GABLE_AudioChannel p_Channel, Uint64 p_FromCycle,
+    Uint64 p_ToCycle)
+{
+
+    // Point to the pulse channel. Don't tick it if it isn't enabled.
+    GABLE_PulseChannel* l_Channel = (p_Channel == GABLE_AC_PC1) ?
+        &p_APU->m_PulseChannel1 : &p_APU->m_PulseChannel2;
+    Bool l_Enabled = (p_Channel == GABLE_AC_PC1) ?
+        p_APU->m_MasterControl.m_PC1Enable : p_APU->m_MasterControl.m_PC2Enable;
+    if (l_Enabled == false)
+    {
+        return;
+    }
+
+    // The channel is ticked on every fourth cycle. Each tick increments its period divider. Whenever
+    // that value exceeds 2047 (0x7FF), the divider overflows and is then reset to the channel's
+    // period; the difference between the period and the overflow value (0x800) determines the
+    // channel's frequency.
+    //
+    // Rather than counting the ticks, the channel's period timer counts down the cycles left until
+    // the divider next overflows. Most runs end before then, and cost just a subtraction.
+    Uint64 l_Cycles = p_ToCycle - p_FromCycle;
+    if (l_Cycles < l_Channel->m_PeriodTimer)
+    {
+        l_Channel->m_PeriodTimer -= l_Cycles;
+        return;
+    }
+
+    // Otherwise, the divider overflows once the timer runs out, then again every time the timer is
+    // reloaded and runs out, until the end of the run. `l_Cycles` is left as the number of cycles
+    // from each overflow to the end of the run.
+    Uint64 l_Reload = (0x801 - l_Channel->m_CurrentPeriod) * 4;
+    l_Cycles -= l_Channel->m_PeriodTimer;
+
+    // When point-sampling, nothing that the DAC depends on changes over the cycles being run here,
+    // so only the number of overflows matters, not when each of them happened. The same goes when
+    // band-limiting, if the channel's contribution to the mix can't change over the run; then, only
+    // the first overflow is recorded, in case the channel's level has changed since the last one.
+    if (p_APU->m_BandLimited == false || GABLE_IsChannelStatic(p_APU, p_Channel) == true)
+    {
+        Uint64 l_FirstOverflowCycle = p_ToCycle - l_Cycles;
+        if (l_Cycles < l_Reload)
+        {
+            l_Channel->m_PeriodTimer = l_Reload - l_Cycles;
+            GABLE_ClockPulseChannel(l_Channel, 1);
+        }
+        else
+        {
+            l_Channel->m_PeriodTimer = l_Reload - (l_Cycles % l_Reload);
+            GABLE_ClockPulseChannel(l_Channel, 1 + (l_Cycles / l_Reload));
+        }
 
-        // ...then affected by the channel's wave output level.
-        switch (p_Channel->m_OutputLevel.m_OutputLevel)
+        if (p_APU->m_BandLimited == true)
         {
-            case GABLE_WOL_MUTE:
-                p_Channel->m_DACInput = 0;
-                break;
-            case GABLE_WOL_FULL:
-                break;
-            case GABLE_WOL_HALF:
-                p_Channel->m_DACInput >>= 1;
-                break;
-            case GABLE_WOL_QUARTER:
-                p_Channel->m_DACInput >>= 2;
-                break;
+            GABLE_UpdateBlipLevel(p_APU, p_Channel, l_FirstOverflowCycle);
         }
 
-        // The channel's DAC input is then translated to an analog DAC output value, by...
-        // - Dividing the input by 7.5, then subtracting 1.0.
-        p_Channel->m_DACOutput = -(((Float32) p_Channel->m_DACInput / 7.5f) - 1.0f);
+        return;
+    }
 
+    // When band-limiting, clock the channel one overflow at a time, so that each change in the
+    // channel's output is recorded at the exact cycle it happened on.
+    while (true)
+    {
+        GABLE_ClockPulseChannel(l_Channel, 1);
+        GABLE_UpdateBlipLevel(p_APU, p_Channel, p_ToCycle - l_Cycles);
+        if (l_Cycles < l_Reload)
+        {
+            l_Channel->m_PeriodTimer = l_Reload - l_Cycles;
+            break;
+        }
+
+        l_Cycles -= l_Reload;
     }
 
 }
 
-void GABLE_TickNoiseChannel (GABLE_APU* p_APU)
+void GABLE_TickWaveChannel (GABLE_APU* p_APU, Uint64 p_FromCycle, Uint64 p_ToCycle)
 {
 
-    // Point to the noise channel.
-    GABLE_NoiseChannel* p_Channel = &p_APU->m_NoiseChannel;
+    // Point to the wave channel. Don't tick it if it isn't enabled.
+    GABLE_WaveChannel* l_Channel = &p_APU->m_WaveChannel;
+    if (p_APU->m_MasterControl.m_WCEnable == false)
+    {
+        return;
+    }
+
+    // The channel is ticked on every second cycle, and its period divider and timer work in the
+    // same manner as the pulse channels' do.
+    Uint64 l_Cycles = p_ToCycle - p_FromCycle;
+    if (l_Cycles < l_Channel->m_PeriodTimer)
+    {
+        l_Channel->m_PeriodTimer -= l_Cycles;
+        return;
+    }
+
+    Uint64 l_Reload = (0x801 - l_Channel->m_CurrentPeriod) * 2;
+    l_Cycles -= l_Channel->m_PeriodTimer;
 
-    // If the channel is enabled, then update the channel's LFSR.
-    if (p_APU->m_MasterControl.m_NCEnable)
+    if (p_APU->m_BandLimited == false || GABLE_IsChannelStatic(p_APU, GABLE_AC_WC) == true)
     {
+        Uint64 l_FirstOverflowCycle = p_ToCycle - l_Cycles;
+        if (l_Cycles < l_Reload)
+        {
+            l_Channel->m_PeriodTimer = l_Reload - l_Cycles;
+            GABLE_ClockWaveChannel(p_APU, 1);
+        }
+        else
+        {
+            l_Channel->m_PeriodTimer = l_Reload - (l_Cycles % l_Reload);
+            GABLE_ClockWaveChannel(p_APU, 1 + (l_Cycles / l_Reload));
+        }
 
-        // Get bits 0 and 1 of the LFSR.
-        Uint8 bit0 = (p_Channel->m_LFSR >> 0) & 0b1;
-        Uint8 bit1 = (p_Channel->m_LFSR >> 1) & 0b1;
+        if (p_APU->m_BandLimited == true)
+        {
+            GABLE_UpdateBlipLevel(p_APU, GABLE_AC_WC, l_FirstOverflowCycle);
+        }
 
-        // Determine the new value of bit 15 (and 7 if the LFSR width is set).
-        Uint8 bit15 = (bit0 == bit1) ? 1 : 0;
+        return;
+    }
 
-        // Set the new value of bit 15 (and 7 if the LFSR width is set).
-        p_Channel->m_LFSR |= (bit15 << 15);
-        if (p_Channel->m_FrequencyRandomness.m_LFSRWidth)
+    while (true)
+    {
+        GABLE_ClockWaveChannel(p_APU, 1);
+        GABLE_UpdateBlipLevel(p_APU, GABLE_AC_WC, p_ToCycle - l_Cycles);
+        if (l_Cycles < l_Reload)
         {
-            p_Channel->m_LFSR |= (bit15 << 7);
+            l_Channel->m_PeriodTimer = l_Reload - l_Cycles;
+            break;
         }
 
-        // Shift the LFSR right by one bit, then clear the new value of bit 15 (and 7 if the LFSR width is set).
-        p_Channel->m_LFSR >>= 1;
-        p_Channel->m_LFSR &= ~(1 << 15);
-        if (p_Channel->m_FrequencyRandomness.m_LFSRWidth)
+        l_Cycles -= l_Reload;
+    }
+
+}
+
+void GABLE_TickNoiseChannel (GABLE_APU* p_APU, Uint64 p_FromCycle, Uint64 p_ToCycle)
+{
+
+    // Point to the noise channel. Don't tick it if it isn't enabled.
+    GABLE_NoiseChannel* p_Channel = &p_APU->m_NoiseChannel;
+    if (p_APU->m_MasterControl.m_NCEnable == false)
+    {
+        return;
+    }
+
+    // The channel is ticked on every cycle which is a multiple of its clock frequency. Its step
+    // timer counts down the cycles left until the next such cycle, so if the run ends before then,
+    // there's nothing more to do.
+    Uint64 l_Cycles = p_ToCycle - p_FromCycle;
+    if (l_Cycles < p_Channel->m_StepTimer)
+    {
+        p_Channel->m_StepTimer -= l_Cycles;
+        return;
+    }
+
+    // Work out how many times the LFSR is stepped over the run, when the first step happens, and
+    // how many cycles are left until the step after the run.
+    Uint64 l_Frequency = p_Channel->m_CurrentClockFrequency;
+    Uint64 l_FirstStepCycle = p_FromCycle + p_Channel->m_StepTimer;
+    Uint64 l_Steps = 1;
+    l_Cycles -= p_Channel->m_StepTimer;
+    if (l_Cycles < l_Frequency)
+    {
+        p_Channel->m_StepTimer = l_Frequency - l_Cycles;
+    }
+    else
+    {
+        l_Steps += l_Cycles / l_Frequency;
+        p_Channel->m_StepTimer = l_Frequency - (l_Cycles % l_Frequency);
+    }
+
+    // Until the LFSR can be found in its sequence tables, step it one bit at a time. This only
+    // happens for a few steps after the LFSR is switched into 7-bit mode, or if it has locked up,
+    // in which case stepping it further changes nothing.
+    Bool l_Short = p_Channel->m_FrequencyRandomness.m_LFSRWidth;
+    Uint64 l_Step = 0;
+    Uint32 l_Position = 0;
+    while (l_Step < l_Steps && GABLE_FindNoisePosition(p_Channel, &l_Position) == false)
+    {
+        Uint16 l_LFSR = GABLE_StepNoiseLFSR(p_Channel->m_LFSR, l_Short);
+        Bool l_LockedUp = (l_LFSR == p_Channel->m_LFSR);
+        p_Channel->m_LFSR = l_LFSR;
+        if (p_APU->m_BandLimited == true)
         {
-            p_Channel->m_LFSR &= ~(1 << 7);
+            GABLE_UpdateNoiseDAC(p_Channel);
+            GABLE_UpdateBlipLevel(p_APU, GABLE_AC_NC, l_FirstStepCycle + l_Step * l_Frequency);
         }
 
-        // The new value of bit 0 determines the DAC input value, which is then multiplied by the channel's current volume.
-        p_Channel->m_DACInput = (p_Channel->m_LFSR & 0b1) * p_Channel->m_CurrentVolume;
+        l_Step = (l_LockedUp == true) ? l_Steps : (l_Step + 1);
+    }
 
-        // The channel's DAC input is then translated to an analog DAC output value, by...
-        // - Dividing the input by 7.5, then subtracting 1.0.
-        p_Channel->m_DACOutput = -(((Float32) p_Channel->m_DACInput / 7.5f) - 1.0f);
+    // Then move the LFSR the rest of the way along its sequence. When point-sampling, only the
+    // LFSR's final value matters to the DAC, so it can be moved there in one go.
+    Bool l_Static = (p_APU->m_BandLimited == true) && GABLE_IsChannelStatic(p_APU, GABLE_AC_NC);
+    if (l_Step < l_Steps)
+    {
+        if (p_APU->m_BandLimited == true)
+        {
 
+            // When band-limiting, every change in the LFSR's output matters, so move it from one
+            // change to the next, using the output bit table. The first step is always recorded,
+            // in case the channel's volume has changed since the last one. If the channel's
+            // contribution to the mix can't change over the run, then that's the only one.
+            Uint64 l_Run = (l_Step == 0) ? 1 : GABLE_GetNoiseRunLength(l_Short, l_Position);
+            while (l_Step + l_Run <= l_Steps && (l_Static == false || l_Step == 0))
+            {
+                l_Position = GABLE_AdvanceNoisePosition(l_Short, l_Position, l_Run);
+                p_Channel->m_LFSR = GABLE_GetNoiseState(l_Short, l_Position);
+                GABLE_UpdateNoiseDAC(p_Channel);
+                GABLE_UpdateBlipLevel(p_APU, GABLE_AC_NC, l_FirstStepCycle + (l_Step + l_Run - 1) * l_Frequency);
+                l_Step += l_Run;
+                l_Run = GABLE_GetNoiseRunLength(l_Short, l_Position);
+            }
+
+        }
+
+        l_Position = GABLE_AdvanceNoisePosition(l_Short, l_Position, l_Steps - l_Step);
+        p_Channel->m_LFSR = GABLE_GetNoiseState(l_Short, l_Position);
+    }
+
+    if (p_APU->m_BandLimited == false || l_Static == true)
+    {
+        GABLE_UpdateNoiseDAC(p_Channel);
     }
 
 }
@@ -611,7 +1321,7 @@ void GABLE_TickFrequencySweep (GABLE_APU* p_APU)
             }
 
             // Update the period divider with the new period value.
-            p_Channel->m_PeriodDivider = p_Channel->m_CurrentPeriod;
+            GABLE_ResetChannelTimer(p_APU, GABLE_AC_PULSE_1);
             
         }
 
@@ -709,96 +1419,340 @@ void GABLE_TickEnvelopeSweeps (GABLE_APU* p_APU)
 
 }
 
-void GABLE_UpdateAudioSample (GABLE_Engine* p_Engine, GABLE_APU* p_APU)
+void GABLE_TickDividerAPU (GABLE_APU* p_APU, GABLE_Engine* p_Engine)
+{
+
+    // Increment the APU's internal divider.
+    p_APU->m_Divider++;
+
+    // Tick...
+    // - ...the length timers every 2 DIV-APU ticks.
+    // . ...`PC1`'s frequency sweep unit every 4 DIV-APU ticks.
+    // - ...the envelope sweeps every 8 DIV-APU ticks.
+    if (p_APU->m_Divider % 2 == 0) 
+        { GABLE_TickLengthTimers(p_APU); }
+    if (p_APU->m_Divider % 4 == 0) 
+        { GABLE_TickFrequencySweep(p_APU); }
+    if (p_APU->m_Divider % 8 == 0) 
+        { GABLE_TickEnvelopeSweeps(p_APU); }
+
+    // Tick the music sequencer, which writes the APU's registers just as the program would. The
+    // sequencer pushes out the mix block itself, before it changes the panning.
+    GABLE_Sequencer* l_Sequencer = GABLE_GetSequencer(p_Engine);
+    if (GABLE_IsSequencerPlaying(l_Sequencer) == true)
+    {
+        GABLE_TickSequencer(l_Sequencer, p_Engine);
+    }
+
+    // A length timer running out switches its channel off, and the sequencer's writes can change
+    // any channel's output, which the band-limited mix needs to record as a step (unless audio is
+    // disabled, in which case nothing is being mixed).
+    if (p_APU->m_AudioEnabled == true && p_APU->m_BandLimited == true)
+    {
+        GABLE_UpdateBlipLevels(p_APU, p_APU->m_SyncedCycles);
+    }
+
+}
+
+void GABLE_TickChannels (GABLE_APU* p_APU, Uint64 p_FromCycle, Uint64 p_ToCycle)
+{
+
+    // Tick the channels over the cycles after `p_FromCycle`, up to and including `p_ToCycle`:
+    // - Wave channel on every second cycle.
+    // - Pulse channels on every fourth cycle.
+    // - Noise channel on every cycle which is a multiple of the channel's clock frequency.
+    // Each channel's timer counts down to its next event, so channels which won't change over
+    // the run are skipped after a single comparison.
+    GABLE_TickWaveChannel(p_APU, p_FromCycle, p_ToCycle);
+    GABLE_TickPulseChannel(p_APU, GABLE_AC_PC1, p_FromCycle, p_ToCycle);
+    GABLE_TickPulseChannel(p_APU, GABLE_AC_PC2, p_FromCycle, p_ToCycle);
+    GABLE_TickNoiseChannel(p_APU, p_FromCycle, p_ToCycle);
+
+}
+
+void GABLE_CapturePointSample (GABLE_APU* p_APU, Index p_Slot)
+{
+
+    // Record each channel's DAC output, if the channel and its DAC are enabled. Panning and the
+    // master volume are left to the block's mix: they can only be changed by register writes,
+    // which sync the APU, and so flush the block, first.
+    p_APU->m_MixBlockChannels[GABLE_AC_PC1][p_Slot] =
+        (p_APU->m_MasterControl.m_PC1Enable && p_APU->m_PulseChannel1.m_DACEnabled) ?
+        p_APU->m_PulseChannel1.m_DACOutput : 0.0f;
+    p_APU->m_MixBlockChannels[GABLE_AC_PC2][p_Slot] =
+        (p_APU->m_MasterControl.m_PC2Enable && p_APU->m_PulseChannel2.m_DACEnabled) ?
+        p_APU->m_PulseChannel2.m_DACOutput : 0.0f;
+    p_APU->m_MixBlockChannels[GABLE_AC_WC][p_Slot] =
+        (p_APU->m_MasterControl.m_WCEnable && p_APU->m_WaveChannel.m_DACEnable.m_DACPower) ?
+        p_APU->m_WaveChannel.m_DACOutput : 0.0f;
+    p_APU->m_MixBlockChannels[GABLE_AC_NC][p_Slot] =
+        (p_APU->m_MasterControl.m_NCEnable && p_APU->m_NoiseChannel.m_DACEnabled) ?
+        p_APU->m_NoiseChannel.m_DACOutput : 0.0f;
+
+}
+
+void GABLE_MixBlockScalar (GABLE_APU* p_APU, Index p_From, Index p_To)
+{
+
+    const GABLE_SoundPanning* l_Panning = &p_APU->m_SoundPanning;
+    const Float32 l_LeftVolume = p_APU->m_MasterVolumeControl.m_LeftVolume / 7.5f;
+    const Float32 l_RightVolume = p_APU->m_MasterVolumeControl.m_RightVolume / 7.5f;
+
+    for (Index i = p_From; i < p_To; ++i)
+    {
+
+        // Add each channel's output to the speakers it is panned to...
+        Float32 l_Left = 0.0f, l_Right = 0.0f;
+        if (l_Panning->m_PC1Left)   { l_Left += p_APU->m_MixBlockChannels[GABLE_AC_PC1][i]; }
+        if (l_Panning->m_PC1Right)  { l_Right += p_APU->m_MixBlockChannels[GABLE_AC_PC1][i]; }
+        if (l_Panning->m_PC2Left)   { l_Left += p_APU->m_MixBlockChannels[GABLE_AC_PC2][i]; }
+        if (l_Panning->m_PC2Right)  { l_Right += p_APU->m_MixBlockChannels[GABLE_AC_PC2][i]; }
+        if (l_Panning->m_WCLeft)    { l_Left += p_APU->m_MixBlockChannels[GABLE_AC_WC][i]; }
+        if (l_Panning->m_WCRight)   { l_Right += p_APU->m_MixBlockChannels[GABLE_AC_WC][i]; }
+        if (l_Panning->m_NCLeft)    { l_Left += p_APU->m_MixBlockChannels[GABLE_AC_NC][i]; }
+        if (l_Panning->m_NCRight)   { l_Right += p_APU->m_MixBlockChannels[GABLE_AC_NC][i]; }
+
+        // ...then affect the total by the master volume control.
+        p_APU->m_MixBlockLeft[i] = l_Left * l_LeftVolume;
+        p_APU->m_MixBlockRight[i] = l_Right * l_RightVolume;
+
+    }
+
+}
+
+void GABLE_MixBlockVector (GABLE_APU* p_APU)
 {
 
-    // Reset the audio sample.
-    p_APU->m_AudioSample.m_Left = 0.0f;
-    p_APU->m_AudioSample.m_Right = 0.0f;
-
-    // For each channel, if the channel and its DAC are enabled, then add the channel's DAC output
-    // to the audio sample.
-    if (p_APU->m_MasterControl.m_PC1Enable && p_APU->m_PulseChannel1.m_DACEnabled)
+    Index l_Vectored = 0;
+
+#if defined(__SSE2__)
+
+    // Four samples are mixed at a time. Panning is applied by masking each channel's outputs to
+    // zero, rather than skipping them, and the channels are added in the same order as the scalar
+    // mix does, so the results are exactly the same.
+    const GABLE_SoundPanning* l_Panning = &p_APU->m_SoundPanning;
+    #define GABLE_PAN_MASK(p_Panned) _mm_castsi128_ps(_mm_set1_epi32((p_Panned) ? -1 : 0))
+    const __m128 l_LeftMasks[4] = {
+        GABLE_PAN_MASK(l_Panning->m_PC1Left), GABLE_PAN_MASK(l_Panning->m_PC2Left),
+        GABLE_PAN_MASK(l_Panning->m_WCLeft), GABLE_PAN_MASK(l_Panning->m_NCLeft)
+    };
+    const __m128 l_RightMasks[4] = {
+        GABLE_PAN_MASK(l_Panning->m_PC1Right), GABLE_PAN_MASK(l_Panning->m_PC2Right),
+        GABLE_PAN_MASK(l_Panning->m_WCRight), GABLE_PAN_MASK(l_Panning->m_NCRight)
+    };
+    #undef GABLE_PAN_MASK
+
+    const __m128 l_LeftVolume = _mm_set1_ps(p_APU->m_MasterVolumeControl.m_LeftVolume / 7.5f);
+    const __m128 l_RightVolume = _mm_set1_ps(p_APU->m_MasterVolumeControl.m_RightVolume / 7.5f);
+
+    for (; l_Vectored + 4 <= p_APU->m_MixBlockCount; l_Vectored += 4)
     {
-        if (p_APU->m_SoundPanning.m_PC1Left)
+        __m128 l_Left = _mm_setzero_ps(), l_Right = _mm_setzero_ps();
+        for (Index c = 0; c < 4; ++c)
         {
-            p_APU->m_AudioSample.m_Left += p_APU->m_PulseChannel1.m_DACOutput;
+            __m128 l_Outputs = _mm_loadu_ps(&p_APU->m_MixBlockChannels[c][l_Vectored]);
+            l_Left = _mm_add_ps(l_Left, _mm_and_ps(l_Outputs, l_LeftMasks[c]));
+            l_Right = _mm_add_ps(l_Right, _mm_and_ps(l_Outputs, l_RightMasks[c]));
         }
 
-        if (p_APU->m_SoundPanning.m_PC1Right)
-        {
-            p_APU->m_AudioSample.m_Right += p_APU->m_PulseChannel1.m_DACOutput;
-        }
+        _mm_storeu_ps(&p_APU->m_MixBlockLeft[l_Vectored], _mm_mul_ps(l_Left, l_LeftVolume));
+        _mm_storeu_ps(&p_APU->m_MixBlockRight[l_Vectored], _mm_mul_ps(l_Right, l_RightVolume));
     }
 
-    if (p_APU->m_MasterControl.m_PC2Enable && p_APU->m_PulseChannel2.m_DACEnabled)
+#endif
+
+    // Whatever is left over (or the whole block, without SSE2) is mixed one sample at a time.
+    GABLE_MixBlockScalar(p_APU, l_Vectored, p_APU->m_MixBlockCount);
+
+}
+
+void GABLE_FilterBlockScalar (GABLE_APU* p_APU, Index p_From, Index p_To)
+{
+
+    // Apply a high-pass filter to each audio sample to remove DC offset. The filter coefficient
+    // alpha is chosen to match the Game Boy APU hardware's behavior. Then divide the output by the
+    // number of channels mixed to bring the overall output between -1.0 and 1.0.
+    const Float32 L_ALPHA = p_APU->m_HighPassAlpha;
+    for (Index i = p_From; i < p_To; ++i)
     {
-        if (p_APU->m_SoundPanning.m_PC2Left)
-        {
-            p_APU->m_AudioSample.m_Left += p_APU->m_PulseChannel2.m_DACOutput;
-        }
+        Float32 l_LeftInput = p_APU->m_MixBlockLeft[i];
+        Float32 l_RightInput = p_APU->m_MixBlockRight[i];
 
-        if (p_APU->m_SoundPanning.m_PC2Right)
-        {
-            p_APU->m_AudioSample.m_Right += p_APU->m_PulseChannel2.m_DACOutput;
-        }
+        Float32 l_NewLeftOutput = l_LeftInput - p_APU->m_PreviousLeftInput + L_ALPHA * p_APU->m_PreviousLeftOutput;
+        Float32 l_NewRightOutput = l_RightInput - p_APU->m_PreviousRightInput + L_ALPHA * p_APU->m_PreviousRightOutput;
+
+        p_APU->m_PreviousLeftInput = l_LeftInput;
+        p_APU->m_PreviousRightInput = l_RightInput;
+        p_APU->m_PreviousLeftOutput = l_NewLeftOutput;
+        p_APU->m_PreviousRightOutput = l_NewRightOutput;
+
+        p_APU->m_MixBlockLeft[i] = l_NewLeftOutput / 4.0f;
+        p_APU->m_MixBlockRight[i] = l_NewRightOutput / 4.0f;
     }
 
-    if (p_APU->m_MasterControl.m_WCEnable && p_APU->m_WaveChannel.m_DACEnable.m_DACPower)
+}
+
+void GABLE_FilterBlockVector (GABLE_APU* p_APU)
+{
+
+    Index l_Vectored = 0;
+
+#if defined(__SSE2__)
+
+    // The filter's recurrence, `y[n] = x[n] - x[n - 1] + a * y[n - 1]`, is run four samples at a
+    // time. The input differences `d[n] = x[n] - x[n - 1]` are independent of one another, and
+    // the recurrence over them is unrolled with a two-step prefix scan:
+    //
+    //     y[n + k] = d[n + k] + a * d[n + k - 1] + ... + a^k * d[n] + a^(k + 1) * y[n - 1]
+    //
+    // This sums the same terms as the scalar filter, but in a different order, so the two round
+    // slightly differently. The filter is stable, so the difference stays bounded, rather than
+    // building up.
+    #define GABLE_SHIFT_LANES(p_Vector, p_Bytes) \
+        _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(p_Vector), p_Bytes))
+    #define GABLE_LAST_LANE(p_Vector) \
+        _mm_cvtss_f32(_mm_shuffle_ps(p_Vector, p_Vector, _MM_SHUFFLE(3, 3, 3, 3)))
+
+    const Float32 l_Alpha = p_APU->m_HighPassAlpha;
+    const Float32 l_Alpha2 = l_Alpha * l_Alpha;
+    const __m128 l_Alpha1x4 = _mm_set1_ps(l_Alpha);
+    const __m128 l_Alpha2x4 = _mm_set1_ps(l_Alpha2);
+    const __m128 l_AlphaPowers = _mm_setr_ps(l_Alpha, l_Alpha2, l_Alpha2 * l_Alpha, l_Alpha2 * l_Alpha2);
+    const __m128 l_Quarter = _mm_set1_ps(0.25f);
+
+    Float32* l_Samples[2] = { p_APU->m_MixBlockLeft, p_APU->m_MixBlockRight };
+    Float32* l_PreviousInputs[2] = { &p_APU->m_PreviousLeftInput, &p_APU->m_PreviousRightInput };
+    Float32* l_PreviousOutputs[2] = { &p_APU->m_PreviousLeftOutput, &p_APU->m_PreviousRightOutput };
+    Count l_Count = p_APU->m_MixBlockCount & ~(Count) 3;
+
+    for (Index s = 0; s < 2; ++s)
     {
-        if (p_APU->m_SoundPanning.m_WCLeft)
+        Float32 l_PreviousInput = *l_PreviousInputs[s];
+        Float32 l_PreviousOutput = *l_PreviousOutputs[s];
+        for (Index i = 0; i < l_Count; i += 4)
         {
-            p_APU->m_AudioSample.m_Left += p_APU->m_WaveChannel.m_DACOutput;
+            __m128 l_Input = _mm_loadu_ps(&l_Samples[s][i]);
+            __m128 l_Delayed = _mm_or_ps(GABLE_SHIFT_LANES(l_Input, 4), _mm_set_ss(l_PreviousInput));
+            __m128 l_Scan = _mm_sub_ps(l_Input, l_Delayed);
+            l_Scan = _mm_add_ps(l_Scan, _mm_mul_ps(l_Alpha1x4, GABLE_SHIFT_LANES(l_Scan, 4)));
+            l_Scan = _mm_add_ps(l_Scan, _mm_mul_ps(l_Alpha2x4, GABLE_SHIFT_LANES(l_Scan, 8)));
+            __m128 l_Output = _mm_add_ps(l_Scan, _mm_mul_ps(l_AlphaPowers, _mm_set1_ps(l_PreviousOutput)));
+
+            l_PreviousInput = GABLE_LAST_LANE(l_Input);
+            l_PreviousOutput = GABLE_LAST_LANE(l_Output);
+            _mm_storeu_ps(&l_Samples[s][i], _mm_mul_ps(l_Output, l_Quarter));
         }
 
-        if (p_APU->m_SoundPanning.m_WCRight)
-        {
-            p_APU->m_AudioSample.m_Right += p_APU->m_WaveChannel.m_DACOutput;
-        }
+        *l_PreviousInputs[s] = l_PreviousInput;
+        *l_PreviousOutputs[s] = l_PreviousOutput;
     }
 
-    if (p_APU->m_MasterControl.m_NCEnable && p_APU->m_NoiseChannel.m_DACEnabled)
+    l_Vectored = l_Count;
+    #undef GABLE_SHIFT_LANES
+    #undef GABLE_LAST_LANE
+
+#endif
+
+    // Whatever is left over (or the whole block, without SSE2) is filtered one sample at a time.
+    GABLE_FilterBlockScalar(p_APU, l_Vectored, p_APU->m_MixBlockCount);
+
+}
+
+void GABLE_FlushMixBlock (GABLE_Engine* p_Engine, GABLE_APU* p_APU)
+{
+
+    Count l_Count = p_APU->m_MixBlockCount;
+    if (l_Count == 0)
     {
-        if (p_APU->m_SoundPanning.m_NCLeft)
-        {
-            p_APU->m_AudioSample.m_Left += p_APU->m_NoiseChannel.m_DACOutput;
-        }
+        return;
+    }
 
-        if (p_APU->m_SoundPanning.m_NCRight)
-        {
-            p_APU->m_AudioSample.m_Right += p_APU->m_NoiseChannel.m_DACOutput;
-        }
+    // Mix the block's samples, if they were point-sampled; band-limited samples are read out of
+    // the step buffer already mixed, with the master volume applied. Then filter them.
+    if (p_APU->m_Vectorized == true)
+    {
+        if (p_APU->m_BandLimited == false) { GABLE_MixBlockVector(p_APU); }
+        GABLE_FilterBlockVector(p_APU);
+    }
+    else
+    {
+        if (p_APU->m_BandLimited == false) { GABLE_MixBlockScalar(p_APU, 0, l_Count); }
+        GABLE_FilterBlockScalar(p_APU, 0, l_Count);
     }
 
-    // Affect the total DAC output by the master volume control.
-    p_APU->m_AudioSample.m_Left *= p_APU->m_MasterVolumeControl.m_LeftVolume / 7.5f;
-    p_APU->m_AudioSample.m_Right *= p_APU->m_MasterVolumeControl.m_RightVolume / 7.5f;
+    p_APU->m_MixBlockCount = 0;
+    p_APU->m_AudioSample.m_Left = p_APU->m_MixBlockLeft[l_Count - 1];
+    p_APU->m_AudioSample.m_Right = p_APU->m_MixBlockRight[l_Count - 1];
 
-    // Apply a high-pass filter to the audio sample to remove DC offset.
-    // The filter coefficient alpha is chosen to match the Game Boy APU hardware's behavior.
-    static const Float32 L_ALPHA = 0.999958f; // Example value, adjust as needed
+    // Hand the block's samples to the audio capture in progress, if any, along with the channels'
+    // outputs, if it's writing stems.
+    if (p_APU->m_AudioCapture != NULL)
+    {
+        const Float32* l_Channels[4] = {
+            p_APU->m_MixBlockChannels[GABLE_AC_PC1], p_APU->m_MixBlockChannels[GABLE_AC_PC2],
+            p_APU->m_MixBlockChannels[GABLE_AC_WC], p_APU->m_MixBlockChannels[GABLE_AC_NC]
+        };
+        GABLE_CaptureAudioBlock(p_APU->m_AudioCapture, p_APU->m_MixBlockLeft, p_APU->m_MixBlockRight,
+            (p_APU->m_AudioCaptureStems == true) ? l_Channels : NULL, l_Count);
+    }
 
-    float l_NewLeftOutput = p_APU->m_AudioSample.m_Left - p_APU->m_PreviousLeftInput + L_ALPHA * p_APU->m_PreviousLeftOutput;
-    float l_NewRightOutput = p_APU->m_AudioSample.m_Right - p_APU->m_PreviousRightInput + L_ALPHA * p_APU->m_PreviousRightOutput;
+    // Push the block's samples into the ring. This thread is the ring's only producer, and only
+    // ever advances the write counter, so no lock is needed; the samples are stored before the
+    // counter is released, so that the reader never sees the counter without them. Samples which
+    // don't fit in the ring are dropped, rather than overwriting samples the reader may be
+    // copying.
+    Uint64 l_Written = p_APU->m_SamplesWritten;
+    Uint64 l_Read = __atomic_load_n(&p_APU->m_SamplesRead, __ATOMIC_ACQUIRE);
+    Count l_Free = p_APU->m_SampleRingCapacity - (Count) (l_Written - l_Read);
+    Count l_Pushed = (l_Count < l_Free) ? l_Count : l_Free;
+    for (Index i = 0; i < l_Pushed; ++i)
+    {
+        GABLE_AudioSample* l_Slot = &p_APU->m_SampleRing[(l_Written + i) & (p_APU->m_SampleRingCapacity - 1)];
+        l_Slot->m_Left = p_APU->m_MixBlockLeft[i];
+        l_Slot->m_Right = p_APU->m_MixBlockRight[i];
+    }
 
-    p_APU->m_PreviousLeftInput = p_APU->m_AudioSample.m_Left;
-    p_APU->m_PreviousRightInput = p_APU->m_AudioSample.m_Right;
+    __atomic_store_n(&p_APU->m_SamplesWritten, l_Written + l_Pushed, __ATOMIC_RELEASE);
+    if (l_Pushed < l_Count)
+    {
+        __atomic_store_n(&p_APU->m_Overruns, p_APU->m_Overruns + (l_Count - l_Pushed), __ATOMIC_RELAXED);
+    }
 
-    p_APU->m_AudioSample.m_Left = l_NewLeftOutput;
-    p_APU->m_AudioSample.m_Right = l_NewRightOutput;
+    // If the mix callback is set, then call it with each of the block's samples.
+    if (p_APU->m_MixCallback != NULL)
+    {
+        for (Index i = 0; i < l_Count; ++i)
+        {
+            GABLE_AudioSample l_Sample = { p_APU->m_MixBlockLeft[i], p_APU->m_MixBlockRight[i] };
+            p_APU->m_MixCallback(p_Engine, &l_Sample);
+        }
+    }
 
-    p_APU->m_PreviousLeftOutput = l_NewLeftOutput;
-    p_APU->m_PreviousRightOutput = l_NewRightOutput;
+}
 
-    // Divide the output by the number of channels mixed to bring the overall output between
-    // -1.0 and 1.0.
-    p_APU->m_AudioSample.m_Left /= 4.0f;
-    p_APU->m_AudioSample.m_Right /= 4.0f;
+void GABLE_UpdateAudioSample (GABLE_Engine* p_Engine, GABLE_APU* p_APU)
+{
 
-    // If the mix callback is set, then call it with the audio sample.
-    if (p_APU->m_MixCallback != NULL)
+    // Add the next sample to the mix block. When band-limiting, the sample is read out of the
+    // band-limited step buffer; otherwise, the channels' DAC outputs are point-sampled. Once the
+    // block is full, it is mixed, filtered and pushed out. The channels' DAC outputs are also
+    // point-sampled when band-limiting, if they are being captured as stems.
+    if (p_APU->m_BandLimited == true)
+    {
+        GABLE_ReadBlipSample(p_APU, p_APU->m_MixBlockCount);
+        if (p_APU->m_AudioCaptureStems == true)
+        {
+            GABLE_CapturePointSample(p_APU, p_APU->m_MixBlockCount);
+        }
+    }
+    else
     {
-        p_APU->m_MixCallback(p_Engine, &p_APU->m_AudioSample);
+        GABLE_CapturePointSample(p_APU, p_APU->m_MixBlockCount);
+    }
+
+    if (++p_APU->m_MixBlockCount == GABLE_MIX_BLOCK_SIZE)
+    {
+        GABLE_FlushMixBlock(p_Engine, p_APU);
     }
 
 }
@@ -808,11 +1762,24 @@ void GABLE_UpdateAudioSample (GABLE_Engine* p_Engine, GABLE_APU* p_APU)
 GABLE_APU* GABLE_CreateAPU ()
 {
 
+    // Build the noise channel's LFSR sequence tables, if they haven't been built already.
+    GABLE_BuildNoiseTables();
+
     // Allocate the GABLE APU instance.
     GABLE_APU* l_APU = GABLE_calloc(1, GABLE_APU);
     GABLE_pexpect(l_APU != NULL, "Failed to allocate GABLE APU instance");
     GABLE_ResetAPU(l_APU);
 
+    // Allocate the audio sample ring.
+    l_APU->m_SampleRing = GABLE_calloc(GABLE_AUDIO_RING_DEFAULT_CAPACITY, GABLE_AudioSample);
+    GABLE_pexpect(l_APU->m_SampleRing != NULL, "Failed to allocate APU audio sample ring");
+    l_APU->m_SampleRingCapacity = GABLE_AUDIO_RING_DEFAULT_CAPACITY;
+
+    // Audio, band-limited synthesis and the vector mix kernels are enabled by default.
+    l_APU->m_AudioEnabled = true;
+    l_APU->m_BandLimited = true;
+    l_APU->m_Vectorized = true;
+
     // Return the APU instance.
     return l_APU;
 
@@ -822,8 +1789,28 @@ void GABLE_ResetAPU (GABLE_APU* p_APU)
 {
     GABLE_expect(p_APU != NULL, "APU context is NULL!");
 
-    // Reset the APU structure's memory.
-    memset(p_APU, 0, sizeof(GABLE_APU));
+    // Hold on to the audio capture, the audio, band-limiting and vectorizing settings, the sample
+    // rate, and the engine cycle the APU has been rendered up to. The audio sample ring isn't
+    // touched at all: its read counter belongs to the host's audio thread, and any samples still
+    // waiting in it can still be read out.
+    GABLE_AudioCapture* l_AudioCapture = p_APU->m_AudioCapture;
+    Bool l_AudioCaptureStems = p_APU->m_AudioCaptureStems;
+    Bool l_AudioEnabled = p_APU->m_AudioEnabled;
+    Bool l_BandLimited = p_APU->m_BandLimited;
+    Bool l_Vectorized = p_APU->m_Vectorized;
+    Uint32 l_SampleRate = p_APU->m_SampleRate;
+    Uint64 l_SyncedCycles = p_APU->m_SyncedCycles;
+
+    // Reset the APU structure's memory, up to the audio sample ring.
+    memset(p_APU, 0, offsetof(GABLE_APU, m_SampleRing));
+    p_APU->m_SyncedCycles = l_SyncedCycles;
+    p_APU->m_AudioCapture = l_AudioCapture;
+    p_APU->m_AudioCaptureStems = l_AudioCaptureStems;
+    p_APU->m_AudioEnabled = l_AudioEnabled;
+    p_APU->m_BandLimited = l_BandLimited;
+    p_APU->m_Vectorized = l_Vectorized;
+    p_APU->m_SampleRate = (l_SampleRate != 0) ? l_SampleRate : GABLE_AUDIO_SAMPLE_RATE;
+    GABLE_BuildBlipKernel(p_APU);
 
     // Reset the APU's hardware registers.
     //
@@ -858,84 +1845,149 @@ void GABLE_ResetAPU (GABLE_APU* p_APU)
     /* NR43 = 0x00 */   p_APU->m_NoiseChannel.m_FrequencyRandomness.m_Register = 0x00;
     /* NR44 = 0xBF */   p_APU->m_NoiseChannel.m_Control.m_Register = 0xBF;
 
-    // Reset the APU's mix clock frequency and the noise channel's current clock frequency.
-    p_APU->m_MixClockFrequency = (4194304 / GABLE_AUDIO_SAMPLE_RATE);
-    if (p_APU->m_NoiseChannel.m_FrequencyRandomness.m_ClockDivider == 0)
-    {
-        p_APU->m_NoiseChannel.m_CurrentClockFrequency = 
-            262144 / (0.5 * pow(2, p_APU->m_NoiseChannel.m_FrequencyRandomness.m_ClockShift));
-    }
-    else
-    {
-        p_APU->m_NoiseChannel.m_CurrentClockFrequency = 
-            262144 / (p_APU->m_NoiseChannel.m_FrequencyRandomness.m_ClockDivider 
-                << p_APU->m_NoiseChannel.m_FrequencyRandomness.m_ClockShift);
-    }
+    // Restart the APU's mix clock from the cycle it has been rendered up to, so that the next sync
+    // only renders the cycles since then, reset the noise channel's current clock frequency, then
+    // start the channels' timers.
+    GABLE_StartMixClock(p_APU, p_APU->m_SyncedCycles);
+    p_APU->m_NoiseChannel.m_CurrentClockFrequency = GABLE_NOISE_CLOCK_FREQUENCY_TABLE
+        [p_APU->m_NoiseChannel.m_FrequencyRandomness.m_ClockDivider]
+        [p_APU->m_NoiseChannel.m_FrequencyRandomness.m_ClockShift];
+
+    GABLE_ResetChannelTimer(p_APU, GABLE_AC_PULSE_1);
+    GABLE_ResetChannelTimer(p_APU, GABLE_AC_PULSE_2);
+    GABLE_ResetChannelTimer(p_APU, GABLE_AC_WAVE);
+    GABLE_ResetChannelTimer(p_APU, GABLE_AC_NOISE);
 }
 
 void GABLE_DestroyAPU (GABLE_APU* p_APU)
 {
     if (p_APU != NULL)
     {
+        GABLE_DestroyAudioCapture(p_APU->m_AudioCapture);
+        GABLE_free(p_APU->m_SampleRing);
         GABLE_free(p_APU);
     }
 }
 
-void GABLE_TickAPU (GABLE_APU* p_APU, GABLE_Engine* p_Engine)
+void GABLE_SyncAPU (GABLE_APU* p_APU, GABLE_Engine* p_Engine)
 {
 
     GABLE_expect(p_APU != NULL, "APU context is NULL!");
     GABLE_expect(p_Engine != NULL, "Engine context is NULL!");
 
-    // Don't tick the APU if it's disabled.
+    // If the host has fed back a new buffer fill level since the last sync, then carry on at the
+    // adjusted rate from here. The mix clock's phase is kept, so that the change is seamless.
+    Float64 l_Adjustment;
+    __atomic_load(&p_APU->m_RequestedRateAdjustment, &l_Adjustment, __ATOMIC_RELAXED);
+    if (l_Adjustment != p_APU->m_RateAdjustment)
+    {
+        p_APU->m_RateAdjustment = l_Adjustment;
+        GABLE_UpdateMixPeriod(p_APU);
+    }
+
+    // Get the engine's tick count. Nothing needs to be rendered if the APU is already up to date.
+    Uint64 l_TargetCycles = GABLE_GetCycleCount(p_Engine);
+    if (p_APU->m_SyncedCycles >= l_TargetCycles)
+    {
+        return;
+    }
+
+    // Don't tick the APU if it's disabled. The APU can only be re-enabled by a write to `NR52`,
+    // which syncs the APU first, so the cycles elapsed until then can just be skipped. No samples
+    // are mixed in the meantime, but the mix clock is kept running.
     if (p_APU->m_MasterControl.m_Enable == false)
     {
+        p_APU->m_SyncedCycles = l_TargetCycles;
+        while (p_APU->m_NextMixCycle <= l_TargetCycles)
+        {
+            GABLE_AdvanceMixClock(p_APU);
+        }
         return;
     }
 
-    // Get the engine's tick count and timer instance.
-    Uint64 l_TickCycles = GABLE_GetCycleCount(p_Engine);
-    GABLE_Timer* l_Timer = GABLE_GetTimer(p_Engine);
-
-    // Tick the channels:
-    // - Wave channel every two ticks.
-    // - Pulse channels every four ticks.
-    // - Noise channel at a rate of ticks dictated by the channel's clock frequency.
-    if (l_TickCycles % 2 == 0) 
-        { GABLE_TickWaveChannel(p_APU); }
-    if (l_TickCycles % 4 == 0) 
-        { GABLE_TickPulseChannels(p_APU); }
-    if (l_TickCycles % p_APU->m_NoiseChannel.m_CurrentClockFrequency == 0) 
-        { GABLE_TickNoiseChannel(p_APU); }
-
-    // Check bit 12 of the timer's divider register. If it just changed from high to low, then a
-    // "DIV-APU" tick has elapsed. This is used to tick the length timers and sweep units.
-    if (GABLE_CheckTimerDividerBit(l_Timer, 12) == true)
-    {
-
-        // Increment the APU's internal divider.
-        p_APU->m_Divider++;
-
-        // Tick...
-        // - ...the length timers every 2 DIV-APU ticks.
-        // . ...`PC1`'s frequency sweep unit every 4 DIV-APU ticks.
-        // - ...the envelope sweeps every 8 DIV-APU ticks.
-        if (p_APU->m_Divider % 2 == 0) 
-            { GABLE_TickLengthTimers(p_APU); }
-        if (p_APU->m_Divider % 4 == 0) 
-            { GABLE_TickFrequencySweep(p_APU); }
-        if (p_APU->m_Divider % 8 == 0) 
-            { GABLE_TickEnvelopeSweeps(p_APU); }
-        
+    // Work out what the timer's divider read at the last synced cycle. The divider counts up once
+    // per cycle, and the APU is synced before any write to `DIV` resets it, so the divider has
+    // counted up steadily since then.
+    Uint16 l_Divider = GABLE_GetTimerDivider(GABLE_GetTimer(p_Engine)) -
+        (Uint16) (l_TargetCycles - p_APU->m_SyncedCycles);
+
+    // If the host has disabled audio, then only the "DIV-APU" ticks are run. These keep everything
+    // the registers show up to date - the length timers, and the channels' status bits in `NR52`,
+    // which the length timers and the frequency sweep can clear - without ticking the channels or
+    // mixing any samples.
+    if (p_APU->m_AudioEnabled == false)
+    {
+        Uint64 l_NextDividerTick = p_APU->m_SyncedCycles + (0x2000 - (l_Divider & 0x1FFF));
+        while (l_NextDividerTick <= l_TargetCycles)
+        {
+            p_APU->m_SyncedCycles = l_NextDividerTick;
+            GABLE_TickDividerAPU(p_APU, p_Engine);
+            l_NextDividerTick += 0x2000;
+        }
+
+        p_APU->m_SyncedCycles = l_TargetCycles;
+        while (p_APU->m_NextMixCycle <= l_TargetCycles)
+        {
+            GABLE_AdvanceMixClock(p_APU);
+        }
+        return;
     }
 
-    // If the engine's tick count is a multiple of the APU's mix clock frequency, then update the
-    // audio sample.
-    if (l_TickCycles % p_APU->m_MixClockFrequency == 0)
+    // The APU is always synced before its registers are written to, so any writes made since the
+    // last sync were made on the last synced cycle. When band-limiting, record any steps those
+    // writes made in the channels' outputs there.
+    if (p_APU->m_BandLimited == true)
     {
-        GABLE_UpdateAudioSample(p_Engine, p_APU);
+        GABLE_UpdateBlipLevels(p_APU, p_APU->m_SyncedCycles);
     }
 
+    // Render the elapsed cycles in runs. Each run ends at the next cycle on which the APU has more
+    // to do than tick its channels: a "DIV-APU" tick, a mix, or the end of the elapsed cycles.
+    while (p_APU->m_SyncedCycles < l_TargetCycles)
+    {
+
+        // A "DIV-APU" tick happens whenever bit 12 of the timer's divider changes from high to
+        // low; that is, whenever the divider's lower 13 bits wrap around to zero.
+        Uint64 l_NextDividerTick = p_APU->m_SyncedCycles + (0x2000 - (l_Divider & 0x1FFF));
+        Uint64 l_NextMix = p_APU->m_NextMixCycle;
+        Uint64 l_RunEnd = l_TargetCycles;
+        if (l_NextDividerTick < l_RunEnd) { l_RunEnd = l_NextDividerTick; }
+        if (l_NextMix < l_RunEnd) { l_RunEnd = l_NextMix; }
+
+        // Tick the channels up to the end of the run.
+        GABLE_TickChannels(p_APU, p_APU->m_SyncedCycles, l_RunEnd);
+        l_Divider += (Uint16) (l_RunEnd - p_APU->m_SyncedCycles);
+        p_APU->m_SyncedCycles = l_RunEnd;
+
+        // On a "DIV-APU" tick, tick the length timers and sweep units.
+        if (l_RunEnd == l_NextDividerTick)
+        {
+            GABLE_TickDividerAPU(p_APU, p_Engine);
+        }
+
+        // If the next audio sample is due, then update the audio sample and work out when the one
+        // after it is due.
+        if (l_RunEnd == l_NextMix)
+        {
+            GABLE_UpdateAudioSample(p_Engine, p_APU);
+            GABLE_AdvanceMixClock(p_APU);
+            p_APU->m_MixCount++;
+        }
+
+    }
+
+    // Push out whatever is left in the mix block, so that every sample mixed over the sync is in
+    // the ring by the time the sync returns.
+    GABLE_FlushMixBlock(p_Engine, p_APU);
+
+}
+
+void GABLE_FlushAPUMixBlock (GABLE_APU* p_APU, GABLE_Engine* p_Engine)
+{
+    GABLE_expect(p_APU != NULL, "APU context is NULL!");
+    GABLE_expect(p_Engine != NULL, "Engine context is NULL!");
+
+    GABLE_FlushMixBlock(p_Engine, p_APU);
 }
 
 // Public Functions - Memory Access ////////////////////////////////////////////////////////////////
@@ -1188,7 +2240,7 @@ void GABLE_WriteNR13 (GABLE_APU* p_APU, Uint8 p_Value)
     p_APU->m_PulseChannel1.m_CurrentPeriod =
         (p_APU->m_PulseChannel1.m_PeriodHighControl.m_PeriodHigh << 8) |
         p_APU->m_PulseChannel1.m_PeriodLow.m_PeriodLow;
-    p_APU->m_PulseChannel1.m_PeriodDivider = p_APU->m_PulseChannel1.m_CurrentPeriod;
+    GABLE_ResetChannelTimer(p_APU, GABLE_AC_PULSE_1);
 }
 
 void GABLE_WriteNR14 (GABLE_APU* p_APU, Uint8 p_Value)
@@ -1205,7 +2257,7 @@ void GABLE_WriteNR14 (GABLE_APU* p_APU, Uint8 p_Value)
     p_APU->m_PulseChannel1.m_CurrentPeriod =
         (p_APU->m_PulseChannel1.m_PeriodHighControl.m_PeriodHigh << 8) |
         p_APU->m_PulseChannel1.m_PeriodLow.m_PeriodLow;
-    p_APU->m_PulseChannel1.m_PeriodDivider = p_APU->m_PulseChannel1.m_CurrentPeriod;
+    GABLE_ResetChannelTimer(p_APU, GABLE_AC_PULSE_1);
 
     // If the trigger bit is set, then trigger the channel.
     if (p_APU->m_PulseChannel1.m_PeriodHighControl.m_Trigger)
@@ -1267,7 +2319,7 @@ void GABLE_WriteNR23 (GABLE_APU* p_APU, Uint8 p_Value)
     p_APU->m_PulseChannel2.m_CurrentPeriod =
         (p_APU->m_PulseChannel2.m_PeriodHighControl.m_PeriodHigh << 8) |
         p_APU->m_PulseChannel2.m_PeriodLow.m_PeriodLow;
-    p_APU->m_PulseChannel2.m_PeriodDivider = p_APU->m_PulseChannel2.m_CurrentPeriod;
+    GABLE_ResetChannelTimer(p_APU, GABLE_AC_PULSE_2);
 }
 
 void GABLE_WriteNR24 (GABLE_APU* p_APU, Uint8 p_Value)
@@ -1284,7 +2336,7 @@ void GABLE_WriteNR24 (GABLE_APU* p_APU, Uint8 p_Value)
     p_APU->m_PulseChannel2.m_CurrentPeriod =
         (p_APU->m_PulseChannel2.m_PeriodHighControl.m_PeriodHigh << 8) |
         p_APU->m_PulseChannel2.m_PeriodLow.m_PeriodLow;
-    p_APU->m_PulseChannel2.m_PeriodDivider = p_APU->m_PulseChannel2.m_CurrentPeriod;
+    GABLE_ResetChannelTimer(p_APU, GABLE_AC_PULSE_2);
 
     // If the trigger bit is set, then trigger the channel.
     if (p_APU->m_PulseChannel2.m_PeriodHighControl.m_Trigger)
@@ -1352,7 +2404,7 @@ void GABLE_WriteNR33 (GABLE_APU* p_APU, Uint8 p_Value)
     p_APU->m_WaveChannel.m_CurrentPeriod =
         (p_APU->m_WaveChannel.m_PeriodHighControl.m_PeriodHigh << 8) |
         p_APU->m_WaveChannel.m_PeriodLow.m_PeriodLow;
-    p_APU->m_WaveChannel.m_PeriodDivider = p_APU->m_WaveChannel.m_CurrentPeriod;
+    GABLE_ResetChannelTimer(p_APU, GABLE_AC_WAVE);
 }
 
 void GABLE_WriteNR34 (GABLE_APU* p_APU, Uint8 p_Value)
@@ -1369,7 +2421,7 @@ void GABLE_WriteNR34 (GABLE_APU* p_APU, Uint8 p_Value)
     p_APU->m_WaveChannel.m_CurrentPeriod =
         (p_APU->m_WaveChannel.m_PeriodHighControl.m_PeriodHigh << 8) |
         p_APU->m_WaveChannel.m_PeriodLow.m_PeriodLow;
-    p_APU->m_WaveChannel.m_PeriodDivider = p_APU->m_WaveChannel.m_CurrentPeriod;
+    GABLE_ResetChannelTimer(p_APU, GABLE_AC_WAVE);
 
     // If the trigger bit is set, then trigger the channel.
     if (p_APU->m_WaveChannel.m_PeriodHighControl.m_Trigger)
@@ -1430,17 +2482,11 @@ void GABLE_WriteNR43 (GABLE_APU* p_APU, Uint8 p_Value)
     p_APU->m_NoiseChannel.m_FrequencyRandomness.m_Register = p_Value;
 
     // Update the noise channel's clock frequency.
-    if (p_APU->m_NoiseChannel.m_FrequencyRandomness.m_ClockDivider == 0)
-    {
-        p_APU->m_NoiseChannel.m_CurrentClockFrequency = 
-            262144 / (0.5 * pow(2, p_APU->m_NoiseChannel.m_FrequencyRandomness.m_ClockShift));
-    }
-    else
-    {
-        p_APU->m_NoiseChannel.m_CurrentClockFrequency = 
-            262144 / (p_APU->m_NoiseChannel.m_FrequencyRandomness.m_ClockDivider 
-                << p_APU->m_NoiseChannel.m_FrequencyRandomness.m_ClockShift);
-    }
+    p_APU->m_NoiseChannel.m_CurrentClockFrequency = GABLE_NOISE_CLOCK_FREQUENCY_TABLE
+        [p_APU->m_NoiseChannel.m_FrequencyRandomness.m_ClockDivider]
+        [p_APU->m_NoiseChannel.m_FrequencyRandomness.m_ClockShift];
+
+    GABLE_ResetChannelTimer(p_APU, GABLE_AC_NOISE);
 }
 
 void GABLE_WriteNR44 (GABLE_APU* p_APU, Uint8 p_Value)
@@ -1471,9 +2517,282 @@ void GABLE_SetAudioMixCallback (GABLE_Engine* p_Engine, GABLE_AudioMixCallback p
     l_APU->m_MixCallback = p_Callback;
 }
 
+Bool GABLE_StartAudioCapture (GABLE_Engine* p_Engine, const Char* p_Path,
+    GABLE_AudioCaptureFormat p_Format, Bool p_Stems)
+{
+    GABLE_expect(p_Engine != NULL, "Engine context is NULL!");
+    GABLE_APU* l_APU = GABLE_GetAPU(p_Engine);
+
+    // Stop the capture in progress, if any, and bring the APU up to now, then start the new capture
+    // from here, so that it picks up with the next sample mixed.
+    GABLE_StopAudioCapture(p_Engine);
+    GABLE_SyncAPU(l_APU, p_Engine);
+    l_APU->m_AudioCapture = GABLE_CreateAudioCapture(p_Path, p_Format, l_APU->m_SampleRate, p_Stems);
+    l_APU->m_AudioCaptureStems = (l_APU->m_AudioCapture != NULL) && p_Stems;
+    return l_APU->m_AudioCapture != NULL;
+}
+
+void GABLE_StopAudioCapture (GABLE_Engine* p_Engine)
+{
+    GABLE_expect(p_Engine != NULL, "Engine context is NULL!");
+    GABLE_APU* l_APU = GABLE_GetAPU(p_Engine);
+    if (l_APU->m_AudioCapture == NULL)
+    {
+        return;
+    }
+
+    // Mix everything up to now into the capture, then finish it off.
+    GABLE_SyncAPU(l_APU, p_Engine);
+    GABLE_DestroyAudioCapture(l_APU->m_AudioCapture);
+    l_APU->m_AudioCapture = NULL;
+    l_APU->m_AudioCaptureStems = false;
+}
+
+GABLE_AudioCapture* GABLE_GetAudioCapture (GABLE_Engine* p_Engine)
+{
+    GABLE_expect(p_Engine != NULL, "Engine context is NULL!");
+    GABLE_APU* l_APU = GABLE_GetAPU(p_Engine);
+    return l_APU->m_AudioCapture;
+}
+
+void GABLE_SetAudioEnabled (GABLE_Engine* p_Engine, Bool p_Enabled)
+{
+    GABLE_expect(p_Engine != NULL, "Engine context is NULL!");
+    GABLE_APU* l_APU = GABLE_GetAPU(p_Engine);
+    if (l_APU->m_AudioEnabled == p_Enabled)
+    {
+        return;
+    }
+
+    // Bring the APU up to now in the old mode. If audio is being re-enabled, then the channels
+    // haven't been ticked in the meantime, so restart their timers from here, and start the
+    // band-limited step buffer afresh, in the same manner as `GABLE_SetBandLimitedAudio` does.
+    GABLE_SyncAPU(l_APU, p_Engine);
+    if (p_Enabled == true)
+    {
+        GABLE_ResetChannelTimer(l_APU, GABLE_AC_PULSE_1);
+        GABLE_ResetChannelTimer(l_APU, GABLE_AC_PULSE_2);
+        GABLE_ResetChannelTimer(l_APU, GABLE_AC_WAVE);
+        GABLE_ResetChannelTimer(l_APU, GABLE_AC_NOISE);
+        memset(l_APU->m_BlipLeft, 0, sizeof(l_APU->m_BlipLeft));
+        memset(l_APU->m_BlipRight, 0, sizeof(l_APU->m_BlipRight));
+        memset(l_APU->m_BlipLeftLevels, 0, sizeof(l_APU->m_BlipLeftLevels));
+        memset(l_APU->m_BlipRightLevels, 0, sizeof(l_APU->m_BlipRightLevels));
+        l_APU->m_BlipLeftSum = 0;
+        l_APU->m_BlipRightSum = 0;
+    }
+
+    l_APU->m_AudioEnabled = p_Enabled;
+}
+
+Bool GABLE_IsAudioEnabled (GABLE_Engine* p_Engine)
+{
+    GABLE_expect(p_Engine != NULL, "Engine context is NULL!");
+    GABLE_APU* l_APU = GABLE_GetAPU(p_Engine);
+    return l_APU->m_AudioEnabled;
+}
+
+void GABLE_SetBandLimitedAudio (GABLE_Engine* p_Engine, Bool p_Enabled)
+{
+    GABLE_expect(p_Engine != NULL, "Engine context is NULL!");
+    GABLE_APU* l_APU = GABLE_GetAPU(p_Engine);
+    if (l_APU->m_BandLimited == p_Enabled)
+    {
+        return;
+    }
+
+    // Render everything up to now in the old mode, then start the band-limited step buffer afresh.
+    // Its running sums start out at zero, so the channels' current outputs are recorded as steps
+    // at the next sync.
+    GABLE_SyncAPU(l_APU, p_Engine);
+    memset(l_APU->m_BlipLeft, 0, sizeof(l_APU->m_BlipLeft));
+    memset(l_APU->m_BlipRight, 0, sizeof(l_APU->m_BlipRight));
+    memset(l_APU->m_BlipLeftLevels, 0, sizeof(l_APU->m_BlipLeftLevels));
+    memset(l_APU->m_BlipRightLevels, 0, sizeof(l_APU->m_BlipRightLevels));
+    l_APU->m_BlipLeftSum = 0;
+    l_APU->m_BlipRightSum = 0;
+    l_APU->m_BandLimited = p_Enabled;
+}
+
+Bool GABLE_IsBandLimitedAudio (GABLE_Engine* p_Engine)
+{
+    GABLE_expect(p_Engine != NULL, "Engine context is NULL!");
+    GABLE_APU* l_APU = GABLE_GetAPU(p_Engine);
+    return l_APU->m_BandLimited;
+}
+
+void GABLE_SetVectorizedAudio (GABLE_Engine* p_Engine, Bool p_Enabled)
+{
+    GABLE_expect(p_Engine != NULL, "Engine context is NULL!");
+    GABLE_APU* l_APU = GABLE_GetAPU(p_Engine);
+
+    // Render everything up to now with the old kernels. Both sets of kernels keep the filter's
+    // state in the same place, so they can be swapped between blocks.
+    GABLE_SyncAPU(l_APU, p_Engine);
+    l_APU->m_Vectorized = p_Enabled;
+}
+
+Bool GABLE_IsVectorizedAudio (GABLE_Engine* p_Engine)
+{
+    GABLE_expect(p_Engine != NULL, "Engine context is NULL!");
+    GABLE_APU* l_APU = GABLE_GetAPU(p_Engine);
+    return l_APU->m_Vectorized;
+}
+
+void GABLE_SetAudioSampleRate (GABLE_Engine* p_Engine, Uint32 p_SampleRate)
+{
+    GABLE_expect(p_Engine != NULL, "Engine context is NULL!");
+    GABLE_APU* l_APU = GABLE_GetAPU(p_Engine);
+
+    // Clamp the sample rate.
+    if (p_SampleRate < GABLE_AUDIO_MIN_SAMPLE_RATE) { p_SampleRate = GABLE_AUDIO_MIN_SAMPLE_RATE; }
+    if (p_SampleRate > GABLE_AUDIO_MAX_SAMPLE_RATE) { p_SampleRate = GABLE_AUDIO_MAX_SAMPLE_RATE; }
+    if (l_APU->m_SampleRate == p_SampleRate)
+    {
+        return;
+    }
+
+    // Render everything up to now at the old rate, then restart the mix clock from here. The
+    // band-limited step buffer is kept, so that the change doesn't cause a click.
+    GABLE_SyncAPU(l_APU, p_Engine);
+    l_APU->m_SampleRate = p_SampleRate;
+    GABLE_StartMixClock(l_APU, l_APU->m_SyncedCycles);
+}
+
+Uint32 GABLE_GetAudioSampleRate (GABLE_Engine* p_Engine)
+{
+    GABLE_expect(p_Engine != NULL, "Engine context is NULL!");
+    GABLE_APU* l_APU = GABLE_GetAPU(p_Engine);
+    return l_APU->m_SampleRate;
+}
+
+void GABLE_SetAudioBufferFill (GABLE_Engine* p_Engine, Float32 p_Fill)
+{
+    GABLE_expect(p_Engine != NULL, "Engine context is NULL!");
+    GABLE_APU* l_APU = GABLE_GetAPU(p_Engine);
+
+    // Clamp the fill level, then work out the adjustment to the sample rate: the full adjustment
+    // upwards when the host's buffer is empty, none when it is half full, and the full adjustment
+    // downwards when it is full.
+    if (p_Fill < 0.0f || p_Fill != p_Fill) { p_Fill = 0.0f; }
+    if (p_Fill > 1.0f) { p_Fill = 1.0f; }
+    //
+    // This may be called from the host's audio thread, so the adjustment is only handed over here.
+    // The engine's thread takes it up the next time it syncs the APU.
+    Float64 l_Adjustment = (1.0 - 2.0 * (Float64) p_Fill) * GABLE_AUDIO_RATE_CONTROL_MAX_DELTA;
+    __atomic_store(&l_APU->m_RequestedRateAdjustment, &l_Adjustment, __ATOMIC_RELAXED);
+}
+
+Float64 GABLE_GetEffectiveAudioSampleRate (GABLE_Engine* p_Engine)
+{
+    GABLE_expect(p_Engine != NULL, "Engine context is NULL!");
+    GABLE_APU* l_APU = GABLE_GetAPU(p_Engine);
+    return (Float64) l_APU->m_SampleRate * (1.0 + l_APU->m_RateAdjustment);
+}
+
 const GABLE_AudioSample* GABLE_GetLatestAudioSample (GABLE_Engine* p_Engine)
 {
     GABLE_expect(p_Engine != NULL, "Engine context is NULL!");
     GABLE_APU* l_APU = GABLE_GetAPU(p_Engine);
+    GABLE_SyncAPU(l_APU, p_Engine);
     return &l_APU->m_AudioSample;
 }
+
+void GABLE_SetAudioRingCapacity (GABLE_Engine* p_Engine, Count p_Capacity)
+{
+    GABLE_expect(p_Engine != NULL, "Engine context is NULL!");
+    GABLE_APU* l_APU = GABLE_GetAPU(p_Engine);
+
+    // Round the capacity up to the next power of two, so that ring positions can be found with a
+    // mask, then clamp it.
+    Count l_Capacity = GABLE_AUDIO_RING_MIN_CAPACITY;
+    while (l_Capacity < p_Capacity && l_Capacity < GABLE_AUDIO_RING_MAX_CAPACITY)
+    {
+        l_Capacity <<= 1;
+    }
+
+    // Replace the ring, discarding any samples still waiting in it.
+    GABLE_AudioSample* l_SampleRing = GABLE_calloc(l_Capacity, GABLE_AudioSample);
+    GABLE_pexpect(l_SampleRing != NULL, "Failed to allocate APU audio sample ring");
+    GABLE_free(l_APU->m_SampleRing);
+    l_APU->m_SampleRing = l_SampleRing;
+    l_APU->m_SampleRingCapacity = l_Capacity;
+    __atomic_store_n(&l_APU->m_SamplesWritten, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&l_APU->m_SamplesRead, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&l_APU->m_Underruns, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&l_APU->m_Overruns, 0, __ATOMIC_RELAXED);
+}
+
+Count GABLE_GetAudioRingCapacity (GABLE_Engine* p_Engine)
+{
+    GABLE_expect(p_Engine != NULL, "Engine context is NULL!");
+    GABLE_APU* l_APU = GABLE_GetAPU(p_Engine);
+    return l_APU->m_SampleRingCapacity;
+}
+
+Count GABLE_GetQueuedAudioSampleCount (GABLE_Engine* p_Engine)
+{
+    GABLE_expect(p_Engine != NULL, "Engine context is NULL!");
+    GABLE_APU* l_APU = GABLE_GetAPU(p_Engine);
+    Uint64 l_Read = __atomic_load_n(&l_APU->m_SamplesRead, __ATOMIC_ACQUIRE);
+    Uint64 l_Written = __atomic_load_n(&l_APU->m_SamplesWritten, __ATOMIC_ACQUIRE);
+    return (Count) (l_Written - l_Read);
+}
+
+Count GABLE_ReadAudioSamples (GABLE_Engine* p_Engine, GABLE_AudioSample* p_Samples, Count p_Count)
+{
+    GABLE_expect(p_Engine != NULL, "Engine context is NULL!");
+    GABLE_expect(p_Samples != NULL || p_Count == 0, "Sample buffer is NULL!");
+    GABLE_APU* l_APU = GABLE_GetAPU(p_Engine);
+
+    // This thread is the ring's only consumer, so only it ever advances the read counter. Acquire
+    // the write counter, so that every sample it counts is visible here.
+    Uint64 l_Read = l_APU->m_SamplesRead;
+    Uint64 l_Written = __atomic_load_n(&l_APU->m_SamplesWritten, __ATOMIC_ACQUIRE);
+
+    // Copy out as many samples as were asked for, or as are waiting, whichever is fewer, and
+    // count any shortfall as an underrun.
+    Count l_Count = (Count) (l_Written - l_Read);
+    if (l_Count >= p_Count)
+    {
+        l_Count = p_Count;
+    }
+    else
+    {
+        __atomic_store_n(&l_APU->m_Underruns, l_APU->m_Underruns + (p_Count - l_Count), __ATOMIC_RELAXED);
+    }
+
+    // The samples may wrap around the end of the ring, so copy them in up to two runs.
+    Count l_Copied = 0;
+    while (l_Copied < l_Count)
+    {
+        Index l_Start = (l_Read + l_Copied) & (l_APU->m_SampleRingCapacity - 1);
+        Count l_Run = l_APU->m_SampleRingCapacity - l_Start;
+        if (l_Run > l_Count - l_Copied)
+        {
+            l_Run = l_Count - l_Copied;
+        }
+
+        memcpy(&p_Samples[l_Copied], &l_APU->m_SampleRing[l_Start], l_Run * sizeof(GABLE_AudioSample));
+        l_Copied += l_Run;
+    }
+
+    // Release the read counter only once the samples have been copied out, so that the engine
+    // never overwrites a sample which is still being copied.
+    __atomic_store_n(&l_APU->m_SamplesRead, l_Read + l_Copied, __ATOMIC_RELEASE);
+    return l_Copied;
+}
+
+Uint64 GABLE_GetAudioUnderrunCount (GABLE_Engine* p_Engine)
+{
+    GABLE_expect(p_Engine != NULL, "Engine context is NULL!");
+    GABLE_APU* l_APU = GABLE_GetAPU(p_Engine);
+    return __atomic_load_n(&l_APU->m_Underruns, __ATOMIC_RELAXED);
+}
+
+Uint64 GABLE_GetAudioOverrunCount (GABLE_Engine* p_Engine)
+{
+    GABLE_expect(p_Engine != NULL, "Engine context is NULL!");
+    GABLE_APU* l_APU = GABLE_GetAPU(p_Engine);
+    return __atomic_load_n(&l_APU->m_Overruns, __ATOMIC_RELAXED);
+}
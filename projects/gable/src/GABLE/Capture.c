@@ -0,0 +1,1081 @@
+/**
+ * @file GABLE/Capture.c
+ */
+
+#include <GABLE/Engine.h>
+#include <GABLE/APU.h>
+#include <GABLE/PPU.h>
+#include <GABLE/Capture.h>
+
+// Platform-Specific ///////////////////////////////////////////////////////////////////////////////
+
+#if defined(GABLE_LINUX)
+    #include <pthread.h>
+    #include <stdatomic.h>
+#else
+    #error "The GABLE Engine's capture writer thread is not yet implemented for this platform."
+#endif
+
+// Private Constants ///////////////////////////////////////////////////////////////////////////////
+
+#define GABLE_CAPTURE_CLOCK_RATE 4194304
+#define GABLE_CAPTURE_RLE_VERSION 1
+#define GABLE_CAPTURE_RLE_HEADER_SIZE 32
+#define GABLE_CAPTURE_RLE_FRAME_COUNT_OFFSET 28
+#define GABLE_CAPTURE_RLE_RUN_FLAG 0x8000
+#define GABLE_CAPTURE_RLE_MAX_LENGTH 0x8000
+#define GABLE_CAPTURE_WAV_HEADER_SIZE 44
+#define GABLE_CAPTURE_AUDIO_CHUNK_SIZE 1024
+#define GABLE_CAPTURE_WAV_FORMAT_PCM 1
+#define GABLE_CAPTURE_WAV_FORMAT_FLOAT 3
+#define GABLE_AUDIO_CAPTURE_STEM_COUNT 4
+#define GABLE_AUDIO_CAPTURE_MAX_TRACKS (2 + GABLE_AUDIO_CAPTURE_STEM_COUNT)
+
+// GABLE Capture Writer Structure //////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Writes out the queue entry with the given index, on the writer thread. Returns `false` if
+ *        a write to the output files fails.
+ */
+typedef Bool (*GABLE_CaptureWriteCallback) (void* p_Capture, Uint64 p_Entry);
+
+typedef struct GABLE_CaptureWriter
+{
+    pthread_t                   m_Thread;           ///< @brief The writer thread's handle.
+    pthread_mutex_t             m_Mutex;            ///< @brief Guards the writer thread going to sleep.
+    pthread_cond_t              m_WakeCondition;    ///< @brief Signalled when an entry is queued, or when stopping.
+    GABLE_CaptureWriteCallback  m_Write;            ///< @brief Writes out each entry in the queue.
+    void*                       m_Capture;          ///< @brief The capture passed to the callback.
+    Count                       m_QueueLength;      ///< @brief The number of entries in the queue.
+    atomic_uint_fast64_t        m_QueueHead;        ///< @brief The number of entries written by the writer thread.
+    atomic_uint_fast64_t        m_QueueTail;        ///< @brief The number of entries queued by the emulation thread.
+    atomic_bool                 m_Sleeping;         ///< @brief Set while the writer thread is waiting to be woken.
+    atomic_bool                 m_Stopping;         ///< @brief Set when the writer thread is being stopped.
+    atomic_bool                 m_Failed;           ///< @brief Set when a write to the output files fails.
+} GABLE_CaptureWriter;
+
+// GABLE Capture Entry Structure ///////////////////////////////////////////////////////////////////
+
+typedef struct GABLE_CaptureEntry
+{
+    Uint32              m_Frame[GABLE_PPU_SCREEN_BUFFER_SIZE];          ///< @brief The frame's pixels.
+    GABLE_AudioSample   m_Samples[GABLE_CAPTURE_MAX_FRAME_SAMPLES];     ///< @brief The frame's audio samples.
+    Count               m_SampleCount;      ///< @brief The number of audio samples carried with the frame.
+    Count               m_FrameSpan;        ///< @brief The number of frames this entry spans, including dropped frames.
+} GABLE_CaptureEntry;
+
+// GABLE Capture Structure /////////////////////////////////////////////////////////////////////////
+
+typedef struct GABLE_Capture
+{
+
+    // Output Files
+    GABLE_CaptureFormat     m_Format;           ///< @brief The output format being written.
+    FILE*                   m_VideoFile;        ///< @brief The Y4M file, or the delta-RLE container.
+    FILE*                   m_AudioFile;        ///< @brief The WAV file, if writing Y4M + WAV.
+
+    // Writer Thread and Queue
+    GABLE_CaptureWriter     m_Writer;           ///< @brief The writer thread, and the state of its queue.
+    GABLE_CaptureEntry*     m_Queue;            ///< @brief The queue of frames waiting to be written.
+
+    // Emulation Thread State
+    GABLE_AudioSample       m_PendingSamples[GABLE_CAPTURE_MAX_FRAME_SAMPLES];  ///< @brief Samples submitted since the last queued frame.
+    Count                   m_PendingSampleCount;   ///< @brief The number of pending audio samples.
+    Count                   m_PendingFrameSpan;     ///< @brief The number of frames dropped since the last queued frame.
+    Count                   m_FrameCount;           ///< @brief The number of frames submitted.
+    Count                   m_DroppedFrameCount;    ///< @brief The number of frames dropped.
+    Count                   m_DroppedSampleCount;   ///< @brief The number of audio samples dropped.
+
+    // Writer Thread State
+    Uint32                  m_PreviousFrame[GABLE_PPU_SCREEN_BUFFER_SIZE];      ///< @brief The last frame written.
+    Uint8                   m_Planes[GABLE_PPU_SCREEN_BUFFER_SIZE * 3];         ///< @brief The last frame written, as Y4M planes.
+    Uint8                   m_EncodeBuffer[GABLE_PPU_SCREEN_BUFFER_SIZE * 6];   ///< @brief Holds an encoded frame.
+    Uint8                   m_AudioBuffer[GABLE_CAPTURE_AUDIO_CHUNK_SIZE * 4];  ///< @brief Holds a chunk of encoded audio.
+    Uint64                  m_FramesWritten;        ///< @brief The number of frames written, including repeats.
+    Uint64                  m_SamplesWritten;       ///< @brief The number of audio samples written.
+
+} GABLE_Capture;
+
+// GABLE Audio Capture Structure ///////////////////////////////////////////////////////////////////
+
+typedef struct GABLE_AudioCapture
+{
+
+    // Output Files
+    GABLE_AudioCaptureFormat    m_Format;       ///< @brief The sample format being written.
+    Uint32                      m_SampleRate;   ///< @brief The sample rate recorded in the files.
+    Bool                        m_Stems;        ///< @brief Whether per-channel stem files are being written.
+    FILE*                       m_MixFile;      ///< @brief The stereo WAV file.
+    FILE*                       m_StemFiles[GABLE_AUDIO_CAPTURE_STEM_COUNT];  ///< @brief The channels' mono stem files, if any.
+
+    // Writer Thread and Queue - Each block holds its samples as one array per track: the left and
+    // right speakers, then the four channels' stems, if any.
+    GABLE_CaptureWriter         m_Writer;           ///< @brief The writer thread, and the state of its queue.
+    Float32*                    m_Blocks;           ///< @brief The queue of blocks waiting to be written.
+    Count                       m_BlockSampleCounts[GABLE_AUDIO_CAPTURE_QUEUE_LENGTH];   ///< @brief The number of samples in each queued block.
+    Count                       m_TrackCount;       ///< @brief The number of tracks in each block.
+
+    // Emulation Thread State
+    Count                       m_BlockFill;            ///< @brief The number of samples in the block at the tail of the queue.
+    Count                       m_DroppedSampleCount;   ///< @brief The number of audio samples dropped.
+
+    // Writer Thread State
+    Uint8                       m_EncodeBuffer[GABLE_AUDIO_CAPTURE_BLOCK_SAMPLES * 2 * 4];  ///< @brief Holds an encoded block.
+    Uint64                      m_SamplesWritten;   ///< @brief The number of audio samples written to each file.
+
+} GABLE_AudioCapture;
+
+// Static Function Prototypes - Encoding ///////////////////////////////////////////////////////////
+
+static void GABLE_PutLE16 (Uint8* p_Buffer, Uint16 p_Value);
+static void GABLE_PutLE32 (Uint8* p_Buffer, Uint32 p_Value);
+static void GABLE_ConvertFrameToPlanes (const Uint32* p_Frame, Uint8* p_Planes);
+static Size GABLE_EncodeDeltaFrame (const Uint32* p_Frame, const Uint32* p_PreviousFrame, Uint8* p_Buffer);
+static void GABLE_EncodeAudioChunk (const GABLE_CaptureEntry* p_Entry, Uint64 p_First, Uint64 p_Count,
+    Uint64 p_Total, Uint8* p_Buffer);
+static Size GABLE_EncodeAudioTracks (const Float32* const* p_Tracks, Count p_TrackCount, Count p_Count,
+    GABLE_AudioCaptureFormat p_Format, Uint8* p_Buffer);
+static Bool GABLE_WriteWAVHeader (FILE* p_File, GABLE_AudioCaptureFormat p_Format, Uint16 p_ChannelCount,
+    Uint32 p_SampleRate, Uint64 p_SampleCount);
+
+// Static Function Prototypes - Capture Writer /////////////////////////////////////////////////////
+
+static void GABLE_StartCaptureWriter (GABLE_CaptureWriter* p_Writer, Count p_QueueLength,
+    GABLE_CaptureWriteCallback p_Write, void* p_Capture);
+static void GABLE_StopCaptureWriter (GABLE_CaptureWriter* p_Writer);
+static Bool GABLE_IsCaptureQueueFull (GABLE_CaptureWriter* p_Writer);
+static Uint64 GABLE_GetCaptureQueueTail (GABLE_CaptureWriter* p_Writer);
+static void GABLE_QueueCaptureEntry (GABLE_CaptureWriter* p_Writer);
+static void* GABLE_CaptureWriterMain (void* p_Argument);
+
+// Static Function Prototypes - Writer Thread //////////////////////////////////////////////////////
+
+static Bool GABLE_WriteCaptureHeaders (GABLE_Capture* p_Capture);
+static Bool GABLE_FinalizeCaptureHeaders (GABLE_Capture* p_Capture);
+static Bool GABLE_WriteCaptureVideo (GABLE_Capture* p_Capture, const Uint32* p_Frame, Uint32 p_SampleCount);
+static Bool GABLE_WriteCaptureAudio (GABLE_Capture* p_Capture, const GABLE_CaptureEntry* p_Entry, Uint64 p_Count);
+static Bool GABLE_WriteCaptureEntry (GABLE_Capture* p_Capture, const GABLE_CaptureEntry* p_Entry);
+static Bool GABLE_WriteQueuedCaptureEntry (void* p_Capture, Uint64 p_Entry);
+
+// Static Function Prototypes - Audio Capture Writer Thread ////////////////////////////////////////
+
+static Float32* GABLE_GetAudioCaptureTrack (GABLE_AudioCapture* p_Capture, Uint64 p_Block, Index p_Track);
+static Bool GABLE_WriteAudioCaptureBlock (GABLE_AudioCapture* p_Capture, Uint64 p_Block);
+static Bool GABLE_WriteQueuedAudioCaptureBlock (void* p_Capture, Uint64 p_Block);
+static void GABLE_QueueAudioCaptureBlock (GABLE_AudioCapture* p_Capture);
+
+// Static Functions - Encoding /////////////////////////////////////////////////////////////////////
+
+void GABLE_PutLE16 (Uint8* p_Buffer, Uint16 p_Value)
+{
+    p_Buffer[0] = (Uint8) (p_Value & 0xFF);
+    p_Buffer[1] = (Uint8) (p_Value >> 8);
+}
+
+void GABLE_PutLE32 (Uint8* p_Buffer, Uint32 p_Value)
+{
+    GABLE_PutLE16(p_Buffer, (Uint16) (p_Value & 0xFFFF));
+    GABLE_PutLE16(p_Buffer + 2, (Uint16) (p_Value >> 16));
+}
+
+void GABLE_ConvertFrameToPlanes (const Uint32* p_Frame, Uint8* p_Planes)
+{
+
+    Uint8* l_Y = p_Planes;
+    Uint8* l_Cb = p_Planes + GABLE_PPU_SCREEN_BUFFER_SIZE;
+    Uint8* l_Cr = p_Planes + (GABLE_PPU_SCREEN_BUFFER_SIZE * 2);
+
+    // Convert each RGBA8888 pixel to studio-range BT.601 YCbCr, in integer arithmetic.
+    for (Index i = 0; i < GABLE_PPU_SCREEN_BUFFER_SIZE; ++i)
+    {
+        Int32 l_Red = (p_Frame[i] >> 24) & 0xFF;
+        Int32 l_Green = (p_Frame[i] >> 16) & 0xFF;
+        Int32 l_Blue = (p_Frame[i] >> 8) & 0xFF;
+
+        l_Y[i]  = (Uint8) ((((  66 * l_Red) + (129 * l_Green) + ( 25 * l_Blue) + 128) >> 8) +  16);
+        l_Cb[i] = (Uint8) ((((- 38 * l_Red) - ( 74 * l_Green) + (112 * l_Blue) + 128) >> 8) + 128);
+        l_Cr[i] = (Uint8) (((( 112 * l_Red) - ( 94 * l_Green) - ( 18 * l_Blue) + 128) >> 8) + 128);
+    }
+
+}
+
+Size GABLE_EncodeDeltaFrame (const Uint32* p_Frame, const Uint32* p_PreviousFrame, Uint8* p_Buffer)
+{
+
+    Uint8* l_Output = p_Buffer;
+    Index i = 0;
+
+    // Run-length encode the XOR of the two frames. Pixels which didn't change come out as zero, so
+    // unchanged areas of the screen collapse into long runs.
+    #define GABLE_DELTA(p_Index) (p_Frame[p_Index] ^ p_PreviousFrame[p_Index])
+    while (i < GABLE_PPU_SCREEN_BUFFER_SIZE)
+    {
+        // Measure the run starting at this pixel. Runs of two or more pixels are worth encoding.
+        Uint32 l_Value = GABLE_DELTA(i);
+        Count l_Length = 1;
+        while (
+            i + l_Length < GABLE_PPU_SCREEN_BUFFER_SIZE &&
+            l_Length < GABLE_CAPTURE_RLE_MAX_LENGTH &&
+            GABLE_DELTA(i + l_Length) == l_Value
+        )
+        {
+            l_Length++;
+        }
+
+        if (l_Length >= 2)
+        {
+            GABLE_PutLE16(l_Output, (Uint16) (GABLE_CAPTURE_RLE_RUN_FLAG | (l_Length - 1)));
+            GABLE_PutLE32(l_Output + 2, l_Value);
+            l_Output += 6;
+            i += l_Length;
+            continue;
+        }
+
+        // Otherwise, gather up literal pixels until the next run begins.
+        Index l_Start = i;
+        l_Length = 0;
+        while (i < GABLE_PPU_SCREEN_BUFFER_SIZE && l_Length < GABLE_CAPTURE_RLE_MAX_LENGTH)
+        {
+            if (i + 1 < GABLE_PPU_SCREEN_BUFFER_SIZE && GABLE_DELTA(i + 1) == GABLE_DELTA(i))
+            {
+                break;
+            }
+
+            i++;
+            l_Length++;
+        }
+
+        GABLE_PutLE16(l_Output, (Uint16) (l_Length - 1));
+        l_Output += 2;
+        for (Index j = l_Start; j < l_Start + l_Length; ++j)
+        {
+            GABLE_PutLE32(l_Output, GABLE_DELTA(j));
+            l_Output += 4;
+        }
+    }
+    #undef GABLE_DELTA
+
+    return (Size) (l_Output - p_Buffer);
+
+}
+
+void GABLE_EncodeAudioChunk (const GABLE_CaptureEntry* p_Entry, Uint64 p_First, Uint64 p_Count,
+    Uint64 p_Total, Uint8* p_Buffer)
+{
+
+    for (Uint64 i = 0; i < p_Count; ++i)
+    {
+        Float32 l_Left = 0.0f, l_Right = 0.0f;
+
+        // Pick the captured sample nearest to this output sample. If no audio was captured at all,
+        // then write silence.
+        if (p_Entry->m_SampleCount > 0)
+        {
+            const GABLE_AudioSample* l_Sample =
+                &p_Entry->m_Samples[((p_First + i) * p_Entry->m_SampleCount) / p_Total];
+            l_Left = fminf(fmaxf(l_Sample->m_Left, -1.0f), 1.0f);
+            l_Right = fminf(fmaxf(l_Sample->m_Right, -1.0f), 1.0f);
+        }
+
+        GABLE_PutLE16(&p_Buffer[i * 4], (Uint16) (Int16) (l_Left * 32767.0f));
+        GABLE_PutLE16(&p_Buffer[i * 4 + 2], (Uint16) (Int16) (l_Right * 32767.0f));
+    }
+
+}
+
+Size GABLE_EncodeAudioTracks (const Float32* const* p_Tracks, Count p_TrackCount, Count p_Count,
+    GABLE_AudioCaptureFormat p_Format, Uint8* p_Buffer)
+{
+
+    // Interleave the tracks' samples, in the manner WAV files expect.
+    Uint8* l_Output = p_Buffer;
+    for (Index i = 0; i < p_Count; ++i)
+    {
+        for (Index t = 0; t < p_TrackCount; ++t)
+        {
+            Float32 l_Sample = p_Tracks[t][i];
+            if (p_Format == GABLE_ACF_FLOAT32)
+            {
+                Uint32 l_Bits = 0;
+                memcpy(&l_Bits, &l_Sample, sizeof(l_Bits));
+                GABLE_PutLE32(l_Output, l_Bits);
+                l_Output += 4;
+            }
+            else
+            {
+                l_Sample = fminf(fmaxf(l_Sample, -1.0f), 1.0f);
+                GABLE_PutLE16(l_Output, (Uint16) (Int16) (l_Sample * 32767.0f));
+                l_Output += 2;
+            }
+        }
+    }
+
+    return (Size) (l_Output - p_Buffer);
+
+}
+
+Bool GABLE_WriteWAVHeader (FILE* p_File, GABLE_AudioCaptureFormat p_Format, Uint16 p_ChannelCount,
+    Uint32 p_SampleRate, Uint64 p_SampleCount)
+{
+
+    // The header is written with its sizes left at zero when the file is opened, then written again
+    // over the top once the number of samples is known. Sizes too large for the header's 32-bit
+    // fields are clamped, as most readers then read up to the end of the file.
+    Uint16 l_SampleSize = (p_Format == GABLE_ACF_FLOAT32) ? 4 : 2;
+    Uint16 l_BlockAlign = l_SampleSize * p_ChannelCount;
+    Uint64 l_DataSize = p_SampleCount * l_BlockAlign;
+    if (l_DataSize > 0xFFFFFFFF - GABLE_CAPTURE_WAV_HEADER_SIZE)
+    {
+        l_DataSize = 0xFFFFFFFF - GABLE_CAPTURE_WAV_HEADER_SIZE;
+    }
+
+    Uint8 l_Header[GABLE_CAPTURE_WAV_HEADER_SIZE] = {
+        'R', 'I', 'F', 'F', 0, 0, 0, 0, 'W', 'A', 'V', 'E',
+        'f', 'm', 't', ' ', 16, 0, 0, 0
+    };
+    GABLE_PutLE32(&l_Header[4], (Uint32) l_DataSize + GABLE_CAPTURE_WAV_HEADER_SIZE - 8);
+    GABLE_PutLE16(&l_Header[20], (p_Format == GABLE_ACF_FLOAT32) ?
+        GABLE_CAPTURE_WAV_FORMAT_FLOAT : GABLE_CAPTURE_WAV_FORMAT_PCM);
+    GABLE_PutLE16(&l_Header[22], p_ChannelCount);
+    GABLE_PutLE32(&l_Header[24], p_SampleRate);
+    GABLE_PutLE32(&l_Header[28], p_SampleRate * l_BlockAlign);
+    GABLE_PutLE16(&l_Header[32], l_BlockAlign);
+    GABLE_PutLE16(&l_Header[34], l_SampleSize * 8);
+    memcpy(&l_Header[36], "data", 4);
+    GABLE_PutLE32(&l_Header[40], (Uint32) l_DataSize);
+
+    return
+        fseek(p_File, 0, SEEK_SET) == 0 &&
+        fwrite(l_Header, 1, sizeof(l_Header), p_File) == sizeof(l_Header);
+
+}
+
+// Static Functions - Capture Writer ///////////////////////////////////////////////////////////////
+
+void GABLE_StartCaptureWriter (GABLE_CaptureWriter* p_Writer, Count p_QueueLength,
+    GABLE_CaptureWriteCallback p_Write, void* p_Capture)
+{
+
+    pthread_mutex_init(&p_Writer->m_Mutex, NULL);
+    pthread_cond_init(&p_Writer->m_WakeCondition, NULL);
+    p_Writer->m_Write = p_Write;
+    p_Writer->m_Capture = p_Capture;
+    p_Writer->m_QueueLength = p_QueueLength;
+    atomic_init(&p_Writer->m_QueueHead, 0);
+    atomic_init(&p_Writer->m_QueueTail, 0);
+    atomic_init(&p_Writer->m_Sleeping, false);
+    atomic_init(&p_Writer->m_Stopping, false);
+    atomic_init(&p_Writer->m_Failed, false);
+
+    GABLE_pexpect(pthread_create(&p_Writer->m_Thread, NULL, GABLE_CaptureWriterMain, p_Writer) == 0,
+        "Failed to start capture writer thread");
+
+}
+
+void GABLE_StopCaptureWriter (GABLE_CaptureWriter* p_Writer)
+{
+
+    // Wake the writer thread up, and wait for it to finish writing out the queue.
+    pthread_mutex_lock(&p_Writer->m_Mutex);
+    atomic_store(&p_Writer->m_Stopping, true);
+    pthread_cond_signal(&p_Writer->m_WakeCondition);
+    pthread_mutex_unlock(&p_Writer->m_Mutex);
+    pthread_join(p_Writer->m_Thread, NULL);
+
+    pthread_cond_destroy(&p_Writer->m_WakeCondition);
+    pthread_mutex_destroy(&p_Writer->m_Mutex);
+
+}
+
+Bool GABLE_IsCaptureQueueFull (GABLE_CaptureWriter* p_Writer)
+{
+    Uint64 l_Tail = atomic_load_explicit(&p_Writer->m_QueueTail, memory_order_relaxed);
+    Uint64 l_Head = atomic_load_explicit(&p_Writer->m_QueueHead, memory_order_acquire);
+    return l_Tail - l_Head >= p_Writer->m_QueueLength;
+}
+
+Uint64 GABLE_GetCaptureQueueTail (GABLE_CaptureWriter* p_Writer)
+{
+    return atomic_load_explicit(&p_Writer->m_QueueTail, memory_order_relaxed);
+}
+
+void GABLE_QueueCaptureEntry (GABLE_CaptureWriter* p_Writer)
+{
+
+    // Hand the entry at the tail of the queue off to the writer thread.
+    Uint64 l_Tail = atomic_load_explicit(&p_Writer->m_QueueTail, memory_order_relaxed);
+    atomic_store_explicit(&p_Writer->m_QueueTail, l_Tail + 1, memory_order_release);
+
+    // Make sure the writer thread sees the newly-queued entry before checking whether it is
+    // asleep. Otherwise, it could fall asleep having missed the entry.
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load(&p_Writer->m_Sleeping) == true)
+    {
+        pthread_mutex_lock(&p_Writer->m_Mutex);
+        pthread_cond_signal(&p_Writer->m_WakeCondition);
+        pthread_mutex_unlock(&p_Writer->m_Mutex);
+    }
+
+}
+
+void* GABLE_CaptureWriterMain (void* p_Argument)
+{
+
+    GABLE_CaptureWriter* l_Writer = (GABLE_CaptureWriter*) p_Argument;
+    Uint64 l_Head = 0;
+
+    while (true)
+    {
+        // If the queue is empty, then either exit (if the capture is being destroyed) or go to sleep
+        // until the emulation thread queues another entry.
+        if (atomic_load_explicit(&l_Writer->m_QueueTail, memory_order_acquire) == l_Head)
+        {
+            if (atomic_load(&l_Writer->m_Stopping) == true)
+            {
+                break;
+            }
+
+            pthread_mutex_lock(&l_Writer->m_Mutex);
+            atomic_store(&l_Writer->m_Sleeping, true);
+            while (
+                atomic_load(&l_Writer->m_QueueTail) == l_Head &&
+                atomic_load(&l_Writer->m_Stopping) == false
+            )
+            {
+                pthread_cond_wait(&l_Writer->m_WakeCondition, &l_Writer->m_Mutex);
+            }
+            atomic_store(&l_Writer->m_Sleeping, false);
+            pthread_mutex_unlock(&l_Writer->m_Mutex);
+
+            continue;
+        }
+
+        // Write the entry at the head of the queue. Once a write fails, stop writing, but keep on
+        // draining the queue so the emulation thread isn't left dropping frames or samples.
+        if (
+            atomic_load(&l_Writer->m_Failed) == false &&
+            l_Writer->m_Write(l_Writer->m_Capture, l_Head) == false
+        )
+        {
+            atomic_store(&l_Writer->m_Failed, true);
+        }
+
+        atomic_store_explicit(&l_Writer->m_QueueHead, ++l_Head, memory_order_release);
+    }
+
+    return NULL;
+
+}
+
+// Static Functions - Writer Thread ////////////////////////////////////////////////////////////////
+
+Bool GABLE_WriteCaptureHeaders (GABLE_Capture* p_Capture)
+{
+
+    if (p_Capture->m_Format == GABLE_CF_DELTA_RLE)
+    {
+        Uint8 l_Header[GABLE_CAPTURE_RLE_HEADER_SIZE] = { 'G', 'A', 'B', 'L', 'E', 'C', 'A', 'P' };
+        GABLE_PutLE16(&l_Header[8], GABLE_CAPTURE_RLE_VERSION);
+        GABLE_PutLE16(&l_Header[10], GABLE_PPU_SCREEN_WIDTH);
+        GABLE_PutLE16(&l_Header[12], GABLE_PPU_SCREEN_HEIGHT);
+        GABLE_PutLE32(&l_Header[16], GABLE_CAPTURE_CLOCK_RATE);
+        GABLE_PutLE32(&l_Header[20], GABLE_DOTS_PER_FRAME);
+        GABLE_PutLE32(&l_Header[24], GABLE_AUDIO_SAMPLE_RATE);
+
+        return fwrite(l_Header, 1, sizeof(l_Header), p_Capture->m_VideoFile) == sizeof(l_Header);
+    }
+
+    // Y4M: The frame rate is given as an exact fraction of the Game Boy's clock rate.
+    if (fprintf(p_Capture->m_VideoFile, "YUV4MPEG2 W%u H%u F%u:%u Ip A1:1 C444\n",
+        GABLE_PPU_SCREEN_WIDTH, GABLE_PPU_SCREEN_HEIGHT, GABLE_CAPTURE_CLOCK_RATE,
+        GABLE_DOTS_PER_FRAME) < 0)
+    {
+        return false;
+    }
+
+    // WAV: 16-bit stereo PCM. The chunk sizes are filled in once the capture is finished.
+    return GABLE_WriteWAVHeader(p_Capture->m_AudioFile, GABLE_ACF_PCM16, 2, GABLE_AUDIO_SAMPLE_RATE, 0);
+
+}
+
+Bool GABLE_FinalizeCaptureHeaders (GABLE_Capture* p_Capture)
+{
+
+    Uint8 l_Value[4];
+
+    if (p_Capture->m_Format == GABLE_CF_DELTA_RLE)
+    {
+        GABLE_PutLE32(l_Value, (Uint32) p_Capture->m_FramesWritten);
+        return
+            fseek(p_Capture->m_VideoFile, GABLE_CAPTURE_RLE_FRAME_COUNT_OFFSET, SEEK_SET) == 0 &&
+            fwrite(l_Value, 1, 4, p_Capture->m_VideoFile) == 4;
+    }
+
+    return GABLE_WriteWAVHeader(p_Capture->m_AudioFile, GABLE_ACF_PCM16, 2, GABLE_AUDIO_SAMPLE_RATE,
+        p_Capture->m_SamplesWritten);
+
+}
+
+Bool GABLE_WriteCaptureVideo (GABLE_Capture* p_Capture, const Uint32* p_Frame, Uint32 p_SampleCount)
+{
+
+    // A `NULL` frame repeats the last frame written, in place of a dropped frame.
+    if (p_Capture->m_Format == GABLE_CF_DELTA_RLE)
+    {
+        Size l_EncodedSize = 0;
+        if (p_Frame != NULL)
+        {
+            l_EncodedSize = GABLE_EncodeDeltaFrame(p_Frame, p_Capture->m_PreviousFrame,
+                p_Capture->m_EncodeBuffer);
+            memcpy(p_Capture->m_PreviousFrame, p_Frame, sizeof(p_Capture->m_PreviousFrame));
+        }
+        else
+        {
+            l_EncodedSize = GABLE_EncodeDeltaFrame(p_Capture->m_PreviousFrame,
+                p_Capture->m_PreviousFrame, p_Capture->m_EncodeBuffer);
+        }
+
+        Uint8 l_Record[8];
+        GABLE_PutLE32(&l_Record[0], (Uint32) l_EncodedSize);
+        GABLE_PutLE32(&l_Record[4], p_SampleCount);
+        return
+            fwrite(l_Record, 1, sizeof(l_Record), p_Capture->m_VideoFile) == sizeof(l_Record) &&
+            fwrite(p_Capture->m_EncodeBuffer, 1, l_EncodedSize, p_Capture->m_VideoFile) == l_EncodedSize;
+    }
+
+    if (p_Frame != NULL)
+    {
+        GABLE_ConvertFrameToPlanes(p_Frame, p_Capture->m_Planes);
+        memcpy(p_Capture->m_PreviousFrame, p_Frame, sizeof(p_Capture->m_PreviousFrame));
+    }
+
+    return
+        fputs("FRAME\n", p_Capture->m_VideoFile) >= 0 &&
+        fwrite(p_Capture->m_Planes, 1, sizeof(p_Capture->m_Planes), p_Capture->m_VideoFile) ==
+            sizeof(p_Capture->m_Planes);
+
+}
+
+Bool GABLE_WriteCaptureAudio (GABLE_Capture* p_Capture, const GABLE_CaptureEntry* p_Entry, Uint64 p_Count)
+{
+
+    // Audio goes into the WAV file, or straight after the frame's record in the container.
+    FILE* l_File = (p_Capture->m_Format == GABLE_CF_DELTA_RLE) ?
+        p_Capture->m_VideoFile : p_Capture->m_AudioFile;
+
+    for (Uint64 l_First = 0; l_First < p_Count; l_First += GABLE_CAPTURE_AUDIO_CHUNK_SIZE)
+    {
+        Uint64 l_ChunkSize = p_Count - l_First;
+        if (l_ChunkSize > GABLE_CAPTURE_AUDIO_CHUNK_SIZE)
+        {
+            l_ChunkSize = GABLE_CAPTURE_AUDIO_CHUNK_SIZE;
+        }
+
+        GABLE_EncodeAudioChunk(p_Entry, l_First, l_ChunkSize, p_Count, p_Capture->m_AudioBuffer);
+        if (fwrite(p_Capture->m_AudioBuffer, 4, l_ChunkSize, l_File) != l_ChunkSize)
+        {
+            return false;
+        }
+    }
+
+    p_Capture->m_SamplesWritten += p_Count;
+    return true;
+
+}
+
+Bool GABLE_WriteCaptureEntry (GABLE_Capture* p_Capture, const GABLE_CaptureEntry* p_Entry)
+{
+
+    // Work out how many samples the audio should have reached by the end of this entry's frames, at
+    // the nominal sample rate. The entry's audio is resampled to exactly that many samples, so the
+    // audio never drifts away from the video.
+    Uint64 l_FramesWritten = p_Capture->m_FramesWritten + p_Entry->m_FrameSpan;
+    Uint64 l_TargetSamples = (l_FramesWritten * GABLE_DOTS_PER_FRAME * GABLE_AUDIO_SAMPLE_RATE) /
+        GABLE_CAPTURE_CLOCK_RATE;
+    Uint64 l_SampleCount = l_TargetSamples - p_Capture->m_SamplesWritten;
+
+    // Repeat the last frame written in place of each dropped frame, then write the entry's frame,
+    // which carries all of the entry's audio.
+    for (Index i = 0; i + 1 < p_Entry->m_FrameSpan; ++i)
+    {
+        if (GABLE_WriteCaptureVideo(p_Capture, NULL, 0) == false)
+        {
+            return false;
+        }
+    }
+
+    if (
+        GABLE_WriteCaptureVideo(p_Capture, p_Entry->m_Frame, (Uint32) l_SampleCount) == false ||
+        GABLE_WriteCaptureAudio(p_Capture, p_Entry, l_SampleCount) == false
+    )
+    {
+        return false;
+    }
+
+    p_Capture->m_FramesWritten = l_FramesWritten;
+    return true;
+
+}
+
+Bool GABLE_WriteQueuedCaptureEntry (void* p_Capture, Uint64 p_Entry)
+{
+
+    GABLE_Capture* l_Capture = (GABLE_Capture*) p_Capture;
+    if (GABLE_WriteCaptureEntry(l_Capture, &l_Capture->m_Queue[p_Entry % l_Capture->m_Writer.m_QueueLength]) == false)
+    {
+        GABLE_perror("Failed to write captured frame %llu", (unsigned long long) l_Capture->m_FramesWritten);
+        return false;
+    }
+
+    return true;
+
+}
+
+// Static Functions - Audio Capture Writer Thread //////////////////////////////////////////////////
+
+Float32* GABLE_GetAudioCaptureTrack (GABLE_AudioCapture* p_Capture, Uint64 p_Block, Index p_Track)
+{
+    Index l_Slot = p_Block % GABLE_AUDIO_CAPTURE_QUEUE_LENGTH;
+    return &p_Capture->m_Blocks[((l_Slot * p_Capture->m_TrackCount) + p_Track) * GABLE_AUDIO_CAPTURE_BLOCK_SAMPLES];
+}
+
+Bool GABLE_WriteAudioCaptureBlock (GABLE_AudioCapture* p_Capture, Uint64 p_Block)
+{
+
+    Count l_Count = p_Capture->m_BlockSampleCounts[p_Block % GABLE_AUDIO_CAPTURE_QUEUE_LENGTH];
+
+    // Write the left and right speakers' samples, interleaved, into the mix file...
+    const Float32* l_Tracks[2] = {
+        GABLE_GetAudioCaptureTrack(p_Capture, p_Block, 0),
+        GABLE_GetAudioCaptureTrack(p_Capture, p_Block, 1)
+    };
+    Size l_Size = GABLE_EncodeAudioTracks(l_Tracks, 2, l_Count, p_Capture->m_Format,
+        p_Capture->m_EncodeBuffer);
+    if (fwrite(p_Capture->m_EncodeBuffer, 1, l_Size, p_Capture->m_MixFile) != l_Size)
+    {
+        return false;
+    }
+
+    // ...then each channel's samples into its stem file, if any.
+    for (Index c = 0; c < GABLE_AUDIO_CAPTURE_STEM_COUNT && p_Capture->m_Stems == true; ++c)
+    {
+        const Float32* l_Stem = GABLE_GetAudioCaptureTrack(p_Capture, p_Block, 2 + c);
+        l_Size = GABLE_EncodeAudioTracks(&l_Stem, 1, l_Count, p_Capture->m_Format,
+            p_Capture->m_EncodeBuffer);
+        if (fwrite(p_Capture->m_EncodeBuffer, 1, l_Size, p_Capture->m_StemFiles[c]) != l_Size)
+        {
+            return false;
+        }
+    }
+
+    p_Capture->m_SamplesWritten += l_Count;
+    return true;
+
+}
+
+Bool GABLE_WriteQueuedAudioCaptureBlock (void* p_Capture, Uint64 p_Block)
+{
+
+    GABLE_AudioCapture* l_Capture = (GABLE_AudioCapture*) p_Capture;
+    if (GABLE_WriteAudioCaptureBlock(l_Capture, p_Block) == false)
+    {
+        GABLE_perror("Failed to write captured audio at sample %llu",
+            (unsigned long long) l_Capture->m_SamplesWritten);
+        return false;
+    }
+
+    return true;
+
+}
+
+void GABLE_QueueAudioCaptureBlock (GABLE_AudioCapture* p_Capture)
+{
+
+    // Record how many samples the block at the tail of the queue holds, then hand it off to the
+    // writer thread.
+    Uint64 l_Tail = GABLE_GetCaptureQueueTail(&p_Capture->m_Writer);
+    p_Capture->m_BlockSampleCounts[l_Tail % GABLE_AUDIO_CAPTURE_QUEUE_LENGTH] = p_Capture->m_BlockFill;
+    p_Capture->m_BlockFill = 0;
+    GABLE_QueueCaptureEntry(&p_Capture->m_Writer);
+
+}
+
+// Public Functions ////////////////////////////////////////////////////////////////////////////////
+
+GABLE_Capture* GABLE_CreateCapture (const Char* p_BasePath, GABLE_CaptureFormat p_Format,
+    Count p_QueueLength)
+{
+
+    GABLE_expect(p_BasePath != NULL, "Base path is NULL!");
+    GABLE_vcheck(p_BasePath[0] != '\0', NULL, "Base path is empty!");
+    GABLE_vcheck(p_Format == GABLE_CF_Y4M_WAV || p_Format == GABLE_CF_DELTA_RLE, NULL,
+        "Unknown capture format %d!", p_Format);
+
+    // Allocate the capture and its queue.
+    GABLE_Capture* l_Capture = GABLE_calloc(1, GABLE_Capture);
+    GABLE_pexpect(l_Capture != NULL, "Failed to allocate capture");
+
+    if (p_QueueLength == 0)
+    {
+        p_QueueLength = GABLE_CAPTURE_DEFAULT_QUEUE_LENGTH;
+    }
+    else if (p_QueueLength > GABLE_CAPTURE_MAX_QUEUE_LENGTH)
+    {
+        p_QueueLength = GABLE_CAPTURE_MAX_QUEUE_LENGTH;
+    }
+
+    l_Capture->m_Queue = GABLE_calloc(p_QueueLength, GABLE_CaptureEntry);
+    GABLE_pexpect(l_Capture->m_Queue != NULL, "Failed to allocate capture queue");
+    l_Capture->m_Format = p_Format;
+
+    // Open the output files.
+    Char l_Path[FILENAME_MAX];
+    if (p_Format == GABLE_CF_DELTA_RLE)
+    {
+        snprintf(l_Path, sizeof(l_Path), "%s.gcap", p_BasePath);
+        l_Capture->m_VideoFile = fopen(l_Path, "wb");
+    }
+    else
+    {
+        snprintf(l_Path, sizeof(l_Path), "%s.wav", p_BasePath);
+        l_Capture->m_AudioFile = fopen(l_Path, "wb");
+        snprintf(l_Path, sizeof(l_Path), "%s.y4m", p_BasePath);
+        l_Capture->m_VideoFile = fopen(l_Path, "wb");
+    }
+
+    if (
+        l_Capture->m_VideoFile == NULL ||
+        (p_Format == GABLE_CF_Y4M_WAV && l_Capture->m_AudioFile == NULL) ||
+        GABLE_WriteCaptureHeaders(l_Capture) == false
+    )
+    {
+        GABLE_perror("Failed to open capture file '%s'", l_Path);
+        if (l_Capture->m_VideoFile != NULL) { fclose(l_Capture->m_VideoFile); }
+        if (l_Capture->m_AudioFile != NULL) { fclose(l_Capture->m_AudioFile); }
+        GABLE_free(l_Capture->m_Queue);
+        GABLE_free(l_Capture);
+        return NULL;
+    }
+
+    // Start the writer thread.
+    GABLE_StartCaptureWriter(&l_Capture->m_Writer, p_QueueLength, GABLE_WriteQueuedCaptureEntry, l_Capture);
+
+    // Return the capture.
+    return l_Capture;
+
+}
+
+void GABLE_DestroyCapture (GABLE_Capture* p_Capture)
+{
+
+    if (p_Capture != NULL)
+    {
+        // Wait for the writer thread to finish writing out the queue.
+        GABLE_StopCaptureWriter(&p_Capture->m_Writer);
+
+        // If frames were dropped after the last frame to make it into the queue, then write them
+        // out now, as repeats of the last frame written, so the video is as long as the audio.
+        if (p_Capture->m_PendingFrameSpan > 0 && atomic_load(&p_Capture->m_Writer.m_Failed) == false)
+        {
+            GABLE_CaptureEntry* l_Entry = &p_Capture->m_Queue[0];
+            memcpy(l_Entry->m_Frame, p_Capture->m_PreviousFrame, sizeof(l_Entry->m_Frame));
+            memcpy(l_Entry->m_Samples, p_Capture->m_PendingSamples,
+                p_Capture->m_PendingSampleCount * sizeof(GABLE_AudioSample));
+            l_Entry->m_SampleCount = p_Capture->m_PendingSampleCount;
+            l_Entry->m_FrameSpan = p_Capture->m_PendingFrameSpan;
+            if (GABLE_WriteCaptureEntry(p_Capture, l_Entry) == false)
+            {
+                GABLE_perror("Failed to write dropped frames at the end of the capture");
+                atomic_store(&p_Capture->m_Writer.m_Failed, true);
+            }
+        }
+
+        // Fill in the sizes left blank in the output files' headers, then close them.
+        if (atomic_load(&p_Capture->m_Writer.m_Failed) == false && GABLE_FinalizeCaptureHeaders(p_Capture) == false)
+        {
+            GABLE_perror("Failed to finalize capture files");
+        }
+
+        fclose(p_Capture->m_VideoFile);
+        if (p_Capture->m_AudioFile != NULL)
+        {
+            fclose(p_Capture->m_AudioFile);
+        }
+
+        GABLE_free(p_Capture->m_Queue);
+        GABLE_free(p_Capture);
+    }
+
+}
+
+Bool GABLE_CaptureFrame (GABLE_Capture* p_Capture, const Uint32* p_Frame)
+{
+
+    GABLE_expect(p_Capture != NULL, "Capture is NULL!");
+    GABLE_vcheck(p_Frame != NULL, false, "Frame is NULL!");
+
+    p_Capture->m_FrameCount++;
+
+    // If the queue is full, then drop the frame. Its audio stays pending, and goes out along with
+    // the next frame to make it into the queue.
+    if (GABLE_IsCaptureQueueFull(&p_Capture->m_Writer) == true)
+    {
+        p_Capture->m_DroppedFrameCount++;
+        p_Capture->m_PendingFrameSpan++;
+        return false;
+    }
+
+    // Fill in the entry at the tail of the queue...
+    Uint64 l_Tail = GABLE_GetCaptureQueueTail(&p_Capture->m_Writer);
+    GABLE_CaptureEntry* l_Entry = &p_Capture->m_Queue[l_Tail % p_Capture->m_Writer.m_QueueLength];
+    memcpy(l_Entry->m_Frame, p_Frame, sizeof(l_Entry->m_Frame));
+    memcpy(l_Entry->m_Samples, p_Capture->m_PendingSamples,
+        p_Capture->m_PendingSampleCount * sizeof(GABLE_AudioSample));
+    l_Entry->m_SampleCount = p_Capture->m_PendingSampleCount;
+    l_Entry->m_FrameSpan = p_Capture->m_PendingFrameSpan + 1;
+    p_Capture->m_PendingSampleCount = 0;
+    p_Capture->m_PendingFrameSpan = 0;
+
+    // ...then hand it off to the writer thread.
+    GABLE_QueueCaptureEntry(&p_Capture->m_Writer);
+
+    return true;
+
+}
+
+void GABLE_CaptureAudioSample (GABLE_Capture* p_Capture, const GABLE_AudioSample* p_Sample)
+{
+
+    GABLE_expect(p_Capture != NULL, "Capture is NULL!");
+    GABLE_expect(p_Sample != NULL, "Audio sample is NULL!");
+
+    if (p_Capture->m_PendingSampleCount < GABLE_CAPTURE_MAX_FRAME_SAMPLES)
+    {
+        p_Capture->m_PendingSamples[p_Capture->m_PendingSampleCount++] = *p_Sample;
+    }
+    else
+    {
+        p_Capture->m_DroppedSampleCount++;
+    }
+
+}
+
+Count GABLE_GetCaptureFrameCount (const GABLE_Capture* p_Capture)
+{
+    GABLE_expect(p_Capture != NULL, "Capture is NULL!");
+    return p_Capture->m_FrameCount;
+}
+
+Count GABLE_GetDroppedCaptureFrameCount (const GABLE_Capture* p_Capture)
+{
+    GABLE_expect(p_Capture != NULL, "Capture is NULL!");
+    return p_Capture->m_DroppedFrameCount;
+}
+
+Count GABLE_GetDroppedCaptureSampleCount (const GABLE_Capture* p_Capture)
+{
+    GABLE_expect(p_Capture != NULL, "Capture is NULL!");
+    return p_Capture->m_DroppedSampleCount;
+}
+
+Bool GABLE_HasCaptureFailed (const GABLE_Capture* p_Capture)
+{
+    GABLE_expect(p_Capture != NULL, "Capture is NULL!");
+    return atomic_load(&p_Capture->m_Writer.m_Failed);
+}
+
+// Public Functions - Audio Capture ////////////////////////////////////////////////////////////////
+
+GABLE_AudioCapture* GABLE_CreateAudioCapture (const Char* p_Path, GABLE_AudioCaptureFormat p_Format,
+    Uint32 p_SampleRate, Bool p_Stems)
+{
+
+    GABLE_expect(p_Path != NULL, "Path is NULL!");
+    GABLE_vcheck(p_Path[0] != '\0', NULL, "Path is empty!");
+    GABLE_vcheck(p_Format == GABLE_ACF_PCM16 || p_Format == GABLE_ACF_FLOAT32, NULL,
+        "Unknown audio capture format %d!", p_Format);
+
+    // Allocate the capture and its queue of blocks.
+    GABLE_AudioCapture* l_Capture = GABLE_calloc(1, GABLE_AudioCapture);
+    GABLE_pexpect(l_Capture != NULL, "Failed to allocate audio capture");
+
+    l_Capture->m_Format = p_Format;
+    l_Capture->m_SampleRate = p_SampleRate;
+    l_Capture->m_Stems = p_Stems;
+    l_Capture->m_TrackCount = (p_Stems == true) ? GABLE_AUDIO_CAPTURE_MAX_TRACKS : 2;
+    l_Capture->m_Blocks = GABLE_calloc(GABLE_AUDIO_CAPTURE_QUEUE_LENGTH * l_Capture->m_TrackCount *
+        GABLE_AUDIO_CAPTURE_BLOCK_SAMPLES, Float32);
+    GABLE_pexpect(l_Capture->m_Blocks != NULL, "Failed to allocate audio capture queue");
+
+    // Open the mix file, then the stem files, if any. The stems are named after the mix file, less
+    // its `.wav` extension.
+    static const Char* L_STEM_SUFFIXES[GABLE_AUDIO_CAPTURE_STEM_COUNT] = {
+        ".pc1.wav", ".pc2.wav", ".wc.wav", ".nc.wav"
+    };
+
+    Char l_Path[FILENAME_MAX];
+    Bool l_Opened = false;
+    snprintf(l_Path, sizeof(l_Path), "%s", p_Path);
+    l_Capture->m_MixFile = fopen(l_Path, "wb");
+    if (l_Capture->m_MixFile != NULL &&
+        GABLE_WriteWAVHeader(l_Capture->m_MixFile, p_Format, 2, p_SampleRate, 0) == true)
+    {
+        l_Opened = true;
+        Size l_BaseLength = strlen(p_Path);
+        if (l_BaseLength >= 4 && strcmp(&p_Path[l_BaseLength - 4], ".wav") == 0)
+        {
+            l_BaseLength -= 4;
+        }
+
+        for (Index c = 0; c < GABLE_AUDIO_CAPTURE_STEM_COUNT && p_Stems == true && l_Opened == true; ++c)
+        {
+            snprintf(l_Path, sizeof(l_Path), "%.*s%s", (int) l_BaseLength, p_Path, L_STEM_SUFFIXES[c]);
+            l_Capture->m_StemFiles[c] = fopen(l_Path, "wb");
+            l_Opened = l_Capture->m_StemFiles[c] != NULL &&
+                GABLE_WriteWAVHeader(l_Capture->m_StemFiles[c], p_Format, 1, p_SampleRate, 0) == true;
+        }
+    }
+
+    if (l_Opened == false)
+    {
+        GABLE_perror("Failed to open audio capture file '%s'", l_Path);
+        if (l_Capture->m_MixFile != NULL) { fclose(l_Capture->m_MixFile); }
+        for (Index c = 0; c < GABLE_AUDIO_CAPTURE_STEM_COUNT; ++c)
+        {
+            if (l_Capture->m_StemFiles[c] != NULL) { fclose(l_Capture->m_StemFiles[c]); }
+        }
+
+        GABLE_free(l_Capture->m_Blocks);
+        GABLE_free(l_Capture);
+        return NULL;
+    }
+
+    // Start the writer thread.
+    GABLE_StartCaptureWriter(&l_Capture->m_Writer, GABLE_AUDIO_CAPTURE_QUEUE_LENGTH,
+        GABLE_WriteQueuedAudioCaptureBlock, l_Capture);
+
+    // Return the capture.
+    return l_Capture;
+
+}
+
+void GABLE_DestroyAudioCapture (GABLE_AudioCapture* p_Capture)
+{
+
+    if (p_Capture != NULL)
+    {
+        // Queue up the partly-filled block, if there is one. There's always room for it, since the
+        // block was only started once there was room in the queue.
+        if (p_Capture->m_BlockFill > 0)
+        {
+            GABLE_QueueAudioCaptureBlock(p_Capture);
+        }
+
+        // Wait for the writer thread to finish writing out the queue.
+        GABLE_StopCaptureWriter(&p_Capture->m_Writer);
+
+        // Fill in the sizes left blank in the files' headers, then close them.
+        Bool l_Finalized = (atomic_load(&p_Capture->m_Writer.m_Failed) == false) &&
+            GABLE_WriteWAVHeader(p_Capture->m_MixFile, p_Capture->m_Format, 2, p_Capture->m_SampleRate,
+                p_Capture->m_SamplesWritten);
+        fclose(p_Capture->m_MixFile);
+        for (Index c = 0; c < GABLE_AUDIO_CAPTURE_STEM_COUNT && p_Capture->m_Stems == true; ++c)
+        {
+            l_Finalized = l_Finalized &&
+                GABLE_WriteWAVHeader(p_Capture->m_StemFiles[c], p_Capture->m_Format, 1,
+                    p_Capture->m_SampleRate, p_Capture->m_SamplesWritten);
+            fclose(p_Capture->m_StemFiles[c]);
+        }
+
+        if (atomic_load(&p_Capture->m_Writer.m_Failed) == false && l_Finalized == false)
+        {
+            GABLE_perror("Failed to finalize audio capture files");
+        }
+
+        GABLE_free(p_Capture->m_Blocks);
+        GABLE_free(p_Capture);
+    }
+
+}
+
+void GABLE_CaptureAudioBlock (GABLE_AudioCapture* p_Capture, const Float32* p_Left,
+    const Float32* p_Right, const Float32* const* p_Channels, Count p_Count)
+{
+
+    GABLE_expect(p_Capture != NULL, "Audio capture is NULL!");
+    GABLE_expect(p_Left != NULL && p_Right != NULL, "Audio samples are NULL!");
+
+    Index i = 0;
+    while (i < p_Count)
+    {
+
+        // A new block can only be started if there's room for it in the queue. If there isn't,
+        // then drop the rest of the samples.
+        if (p_Capture->m_BlockFill == 0 && GABLE_IsCaptureQueueFull(&p_Capture->m_Writer) == true)
+        {
+            p_Capture->m_DroppedSampleCount += p_Count - i;
+            return;
+        }
+
+        // Copy as many samples as fit into the block at the tail of the queue...
+        Uint64 l_Tail = GABLE_GetCaptureQueueTail(&p_Capture->m_Writer);
+        Count l_Copied = GABLE_AUDIO_CAPTURE_BLOCK_SAMPLES - p_Capture->m_BlockFill;
+        if (l_Copied > p_Count - i)
+        {
+            l_Copied = p_Count - i;
+        }
+
+        Index l_Fill = p_Capture->m_BlockFill;
+        memcpy(&GABLE_GetAudioCaptureTrack(p_Capture, l_Tail, 0)[l_Fill], &p_Left[i], l_Copied * sizeof(Float32));
+        memcpy(&GABLE_GetAudioCaptureTrack(p_Capture, l_Tail, 1)[l_Fill], &p_Right[i], l_Copied * sizeof(Float32));
+        for (Index c = 0; c < GABLE_AUDIO_CAPTURE_STEM_COUNT && p_Capture->m_Stems == true; ++c)
+        {
+            Float32* l_Stem = &GABLE_GetAudioCaptureTrack(p_Capture, l_Tail, 2 + c)[l_Fill];
+            if (p_Channels != NULL)
+            {
+                memcpy(l_Stem, &p_Channels[c][i], l_Copied * sizeof(Float32));
+            }
+            else
+            {
+                memset(l_Stem, 0, l_Copied * sizeof(Float32));
+            }
+        }
+
+        p_Capture->m_BlockFill += l_Copied;
+        i += l_Copied;
+
+        // ...then, once the block is full, hand it off to the writer thread.
+        if (p_Capture->m_BlockFill == GABLE_AUDIO_CAPTURE_BLOCK_SAMPLES)
+        {
+            GABLE_QueueAudioCaptureBlock(p_Capture);
+        }
+
+    }
+
+}
+
+Bool GABLE_HasAudioCaptureStems (const GABLE_AudioCapture* p_Capture)
+{
+    GABLE_expect(p_Capture != NULL, "Audio capture is NULL!");
+    return p_Capture->m_Stems;
+}
+
+Count GABLE_GetDroppedAudioCaptureSampleCount (const GABLE_AudioCapture* p_Capture)
+{
+    GABLE_expect(p_Capture != NULL, "Audio capture is NULL!");
+    return p_Capture->m_DroppedSampleCount;
+}
+
+Bool GABLE_HasAudioCaptureFailed (const GABLE_AudioCapture* p_Capture)
+{
+    GABLE_expect(p_Capture != NULL, "Audio capture is NULL!");
+    return atomic_load(&p_Capture->m_Writer.m_Failed);
+}
+
+// Public Functions - High-Level Functions /////////////////////////////////////////////////////////
+
+Bool GABLE_CaptureScreenBuffer (GABLE_Engine* p_Engine, GABLE_Capture* p_Capture)
+{
+    GABLE_expect(p_Engine != NULL, "Engine context is NULL!");
+    return GABLE_CaptureFrame(p_Capture, GABLE_GetScreenBuffer(p_Engine));
+}
@@ -118,6 +118,69 @@ Bool GABLE_ReadDataStoreByte (const GABLE_DataStore* p_DataStore, Uint16 p_Addre
     return true;
 }
 
+Bool GABLE_ReadDataStoreBlock (const GABLE_DataStore* p_DataStore, Uint16 p_Address, Uint8* p_Buffer,
+    Size p_Length)
+{
+    // Validate the data store instance and buffer.
+    GABLE_expect(p_DataStore != NULL, "Data store context is NULL!");
+    GABLE_expect(p_Buffer != NULL, "Buffer pointer is NULL!");
+
+    // Validate the address range.
+    if ((Size) p_Address + p_Length > GABLE_GB_ROM_SIZE)
+    {
+        GABLE_error("Data store block at %u of length %zu is out of bounds.", p_Address, p_Length);
+        return false;
+    }
+
+    // Copy the part of the block which lies in bank 0...
+    if (p_Address < GABLE_DS_BANK_SIZE)
+    {
+        Size l_Length = GABLE_DS_BANK_SIZE - p_Address;
+        if (l_Length > p_Length)
+        {
+            l_Length = p_Length;
+        }
+
+        memcpy(p_Buffer, &p_DataStore->m_Data[p_Address], l_Length);
+        p_Buffer += l_Length;
+        p_Address += l_Length;
+        p_Length -= l_Length;
+    }
+
+    // ...then the part which lies in the current bank.
+    if (p_Length > 0)
+    {
+        Uint16 l_BankNumber = p_DataStore->m_CurrentBank;
+        memcpy(p_Buffer, &p_DataStore->m_Data[(l_BankNumber * GABLE_DS_BANK_SIZE) + (p_Address - GABLE_DS_BANK_SIZE)], p_Length);
+    }
+
+    return true;
+}
+
+Bool GABLE_ReadDataStoreBankBlock (const GABLE_DataStore* p_DataStore, Uint16 p_BankNumber,
+    Uint16 p_Offset, Uint8* p_Buffer, Size p_Length)
+{
+    // Validate the data store instance and buffer.
+    GABLE_expect(p_DataStore != NULL, "Data store context is NULL!");
+    GABLE_expect(p_Buffer != NULL, "Buffer pointer is NULL!");
+
+    // Validate the bank number and the block's range within the bank.
+    if (p_BankNumber >= p_DataStore->m_BankCount)
+    {
+        GABLE_error("Data store bank number %u is out of bounds.", p_BankNumber);
+        return false;
+    }
+    else if ((Size) p_Offset + p_Length > GABLE_DS_BANK_SIZE)
+    {
+        GABLE_error("Data store block at %u of length %zu runs past the end of bank %u.", p_Offset,
+            p_Length, p_BankNumber);
+        return false;
+    }
+
+    memcpy(p_Buffer, &p_DataStore->m_Data[(p_BankNumber * GABLE_DS_BANK_SIZE) + p_Offset], p_Length);
+    return true;
+}
+
 // Public Functions - Hardware Register Getters ////////////////////////////////////////////////////
 
 Uint8 GABLE_ReadDSBKH (const GABLE_DataStore* p_DataStore)
@@ -8,6 +8,7 @@
 #include <GABLE/DataStore.h>
 #include <GABLE/RAM.h>
 #include <GABLE/APU.h>
+#include <GABLE/Sequencer.h>
 #include <GABLE/PPU.h>
 #include <GABLE/Joypad.h>
 #include <GABLE/Network.h>
@@ -30,6 +31,7 @@ typedef struct GABLE_Engine
     GABLE_PPU*              m_PPU;          ///< @brief The engine's PPU.
     GABLE_Joypad*           m_Joypad;       ///< @brief The engine's joypad.
     GABLE_NetworkContext*   m_Network;      ///< @brief The engine's network interface.
+    GABLE_Sequencer*        m_Sequencer;    ///< @brief The engine's music sequencer.
     void*                   m_Userdata;     ///< @brief User data associated with the engine.
 } GABLE_Engine;
 
@@ -67,6 +69,7 @@ GABLE_Engine* GABLE_CreateEngine ()
     l_Engine->m_PPU = GABLE_CreatePPU();
     l_Engine->m_Joypad = GABLE_CreateJoypad(l_Engine);
     l_Engine->m_Network = GABLE_CreateNetworkContext();
+    l_Engine->m_Sequencer = GABLE_CreateSequencer();
 
     // Initialize the engine's properties.
     l_Engine->m_Cycles = 0;
@@ -104,6 +107,7 @@ void GABLE_DestroyEngine (GABLE_Engine* p_Engine)
         GABLE_DestroyAPU(p_Engine->m_APU);
         GABLE_DestroyPPU(p_Engine->m_PPU);
         GABLE_DestroyJoypad(p_Engine->m_Joypad);
+        GABLE_DestroySequencer(p_Engine->m_Sequencer);
 
         // Free the engine instance.
         GABLE_free(p_Engine);
@@ -139,7 +143,6 @@ Bool GABLE_CycleEngine (GABLE_Engine* p_Engine, Count p_Cycles)
 
             // Tick the engine's components.
             GABLE_TickTimer(p_Engine->m_Timer, p_Engine);
-            GABLE_TickAPU(p_Engine->m_APU, p_Engine);
             GABLE_TickPPU(p_Engine->m_PPU, p_Engine);
             GABLE_TickNetworkContext(p_Engine->m_Network, p_Engine);
 
@@ -171,6 +174,10 @@ Bool GABLE_CycleEngine (GABLE_Engine* p_Engine, Count p_Cycles)
         GABLE_TickODMA(p_Engine->m_PPU, p_Engine);
     }
 
+    // The APU renders its audio in blocks, rather than being ticked above, so bring it up to date
+    // with the cycles just elapsed.
+    GABLE_SyncAPU(p_Engine->m_APU, p_Engine);
+
     // Return success.
     return true;
 }
@@ -235,6 +242,14 @@ Bool GABLE_ReadByte (GABLE_Engine* p_Engine, Uint16 p_Address, Uint8* p_Value)
         return GABLE_ReadHRAMByte(p_Engine->m_RAM, p_Address - GABLE_GB_HRAM_START, p_Value);
     }
 
+    // `0xFF10` - `0xFF2B`: The APU renders its audio in blocks, so bring it up to date before
+    // reading its registers. This includes the music sequencer's registers, since the sequencer is
+    // ticked by the APU.
+    if (p_Address >= GABLE_HP_NR10 && p_Address <= GABLE_HP_SQM)
+    {
+        GABLE_SyncAPU(p_Engine->m_APU, p_Engine);
+    }
+
     // If we reach this point, then we must be reading from a hardware port.
     switch (p_Address)
     {
@@ -273,6 +288,11 @@ Bool GABLE_ReadByte (GABLE_Engine* p_Engine, Uint16 p_Address, Uint8* p_Value)
         case GABLE_HP_NR50:     *p_Value = GABLE_ReadNR50(p_Engine->m_APU); break;
         case GABLE_HP_NR51:     *p_Value = GABLE_ReadNR51(p_Engine->m_APU); break;
         case GABLE_HP_NR52:     *p_Value = GABLE_ReadNR52(p_Engine->m_APU); break;
+        case GABLE_HP_SQAH:     *p_Value = GABLE_ReadSQAH(p_Engine->m_Sequencer); break;
+        case GABLE_HP_SQAL:     *p_Value = GABLE_ReadSQAL(p_Engine->m_Sequencer); break;
+        case GABLE_HP_SQC:      *p_Value = GABLE_ReadSQC(p_Engine->m_Sequencer); break;
+        case GABLE_HP_SQT:      *p_Value = GABLE_ReadSQT(p_Engine->m_Sequencer); break;
+        case GABLE_HP_SQM:      *p_Value = GABLE_ReadSQM(p_Engine->m_Sequencer); break;
         case GABLE_HP_LCDC:     *p_Value = GABLE_ReadLCDC(p_Engine->m_PPU); break;
         case GABLE_HP_STAT:     *p_Value = GABLE_ReadSTAT(p_Engine->m_PPU); break;
         case GABLE_HP_SCY:      *p_Value = GABLE_ReadSCY(p_Engine->m_PPU); break;
@@ -296,6 +316,9 @@ Bool GABLE_ReadByte (GABLE_Engine* p_Engine, Uint16 p_Address, Uint8* p_Value)
         case GABLE_HP_OBPD:     *p_Value = GABLE_ReadOBPD(p_Engine->m_PPU); break;
         case GABLE_HP_OPRI:     *p_Value = GABLE_ReadOPRI(p_Engine->m_PPU); break;
         case GABLE_HP_GRPM:     *p_Value = GABLE_ReadGRPM(p_Engine->m_PPU); break;
+        case GABLE_HP_LTAH:     *p_Value = GABLE_ReadLTAH(p_Engine->m_PPU); break;
+        case GABLE_HP_LTAL:     *p_Value = GABLE_ReadLTAL(p_Engine->m_PPU); break;
+        case GABLE_HP_LTC:      *p_Value = GABLE_ReadLTC(p_Engine->m_PPU); break;
         case GABLE_HP_SVBK:     *p_Value = GABLE_ReadSVBK(p_Engine->m_RAM); break;
         case GABLE_HP_SSBK:     *p_Value = GABLE_ReadSSBK(p_Engine->m_RAM); break;
         case GABLE_HP_DSBKH:    *p_Value = GABLE_ReadDSBKH(p_Engine->m_DataStore); break;
@@ -309,6 +332,63 @@ Bool GABLE_ReadByte (GABLE_Engine* p_Engine, Uint16 p_Address, Uint8* p_Value)
     return true;
 }
 
+Bool GABLE_ReadBlock (GABLE_Engine* p_Engine, Uint16 p_Address, Uint8* p_Buffer, Size p_Length)
+{
+    // Validate the engine instance and buffer pointer.
+    GABLE_expect(p_Engine != NULL, "Engine context is NULL!");
+    GABLE_expect(p_Buffer != NULL, "Buffer pointer is NULL!");
+
+    if (p_Length == 0)
+    {
+        return true;
+    }
+
+    // Resolve the region the block lies in once, and copy the whole block out of it.
+    Uint32 l_End = (Uint32) p_Address + p_Length - 1;
+
+    // `0x0000` - `0x7FFF`: Read from the data store.
+    if (l_End <= GABLE_GB_ROM_END)
+    {
+        return GABLE_ReadDataStoreBlock(p_Engine->m_DataStore, p_Address, p_Buffer, p_Length);
+    }
+
+    // `0x8000` - `0x9FFF`: Read from the video RAM.
+    if (p_Address >= GABLE_GB_VRAM_START && l_End <= GABLE_GB_VRAM_END)
+    {
+        return GABLE_ReadVRAMBlock(p_Engine->m_PPU, p_Address - GABLE_GB_VRAM_START, p_Buffer, p_Length);
+    }
+
+    // `0xA000` - `0xBFFF`: Read from the static RAM.
+    if (p_Address >= GABLE_GB_SRAM_START && l_End <= GABLE_GB_SRAM_END)
+    {
+        return GABLE_ReadSRAMBlock(p_Engine->m_RAM, p_Address - GABLE_GB_SRAM_START, p_Buffer, p_Length);
+    }
+
+    // `0xC000` - `0xDFFF`: Read from the working RAM.
+    if (p_Address >= GABLE_GB_WRAM_START && l_End <= GABLE_GB_WRAM_END)
+    {
+        return GABLE_ReadWRAMBlock(p_Engine->m_RAM, p_Address - GABLE_GB_WRAM_START, p_Buffer, p_Length);
+    }
+
+    // `0xE100` - `0xFDFF`: Read from the working RAM (echo).
+    if (p_Address >= GABLE_GB_ECHO_START && l_End <= GABLE_GB_ECHO_END)
+    {
+        return GABLE_ReadWRAMBlock(p_Engine->m_RAM, p_Address - GABLE_GB_ECHO_START, p_Buffer, p_Length);
+    }
+
+    // If the block spans more than one region, or lies somewhere reads can have side effects, then
+    // read it one byte at a time.
+    for (Size i = 0; i < p_Length; ++i)
+    {
+        if (GABLE_ReadByte(p_Engine, p_Address + i, &p_Buffer[i]) == false)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 Bool GABLE_ReadWord (GABLE_Engine* p_Engine, Uint16 p_Address, Uint16* p_Value)
 {
     // Validate the engine instance and value pointer.
@@ -368,6 +448,15 @@ Bool GABLE_WriteByte (GABLE_Engine* p_Engine, Uint16 p_Address, Uint8 p_Value)
         return GABLE_WriteOAMByte(p_Engine->m_PPU, p_Address - GABLE_GB_OAM_START, p_Value);
     }
 
+    // `0xFF04`, `0xFF10` - `0xFF3F`: The APU renders its audio in blocks, so bring it up to date
+    // before writing to anything it renders from. This includes `DIV`, which clocks the APU's
+    // length timers and sweep units, and the music sequencer's registers, since the sequencer is
+    // ticked by the APU.
+    if (p_Address == GABLE_HP_DIV || (p_Address >= GABLE_HP_NR10 && p_Address <= GABLE_GB_WAVE_END))
+    {
+        GABLE_SyncAPU(p_Engine->m_APU, p_Engine);
+    }
+
     // `0xFF30` - `0xFF3F`: Write to the wave pattern RAM.
     if (p_Address >= GABLE_GB_WAVE_START && p_Address <= GABLE_GB_WAVE_END)
     {
@@ -418,6 +507,11 @@ Bool GABLE_WriteByte (GABLE_Engine* p_Engine, Uint16 p_Address, Uint8 p_Value)
         case GABLE_HP_NR50:     GABLE_WriteNR50(p_Engine->m_APU, p_Value); break;
         case GABLE_HP_NR51:     GABLE_WriteNR51(p_Engine->m_APU, p_Value); break;
         case GABLE_HP_NR52:     GABLE_WriteNR52(p_Engine->m_APU, p_Value); break;
+        case GABLE_HP_SQAH:     GABLE_WriteSQAH(p_Engine->m_Sequencer, p_Value); break;
+        case GABLE_HP_SQAL:     GABLE_WriteSQAL(p_Engine->m_Sequencer, p_Value); break;
+        case GABLE_HP_SQC:      GABLE_WriteSQC(p_Engine->m_Sequencer, p_Engine, p_Value); break;
+        case GABLE_HP_SQT:      GABLE_WriteSQT(p_Engine->m_Sequencer, p_Value); break;
+        case GABLE_HP_SQM:      GABLE_WriteSQM(p_Engine->m_Sequencer, p_Value); break;
         case GABLE_HP_LCDC:     GABLE_WriteLCDC(p_Engine->m_PPU, p_Value); break;
         case GABLE_HP_STAT:     GABLE_WriteSTAT(p_Engine->m_PPU, p_Value); break;
         case GABLE_HP_SCY:      GABLE_WriteSCY(p_Engine->m_PPU, p_Value); break;
@@ -442,6 +536,9 @@ Bool GABLE_WriteByte (GABLE_Engine* p_Engine, Uint16 p_Address, Uint8 p_Value)
         case GABLE_HP_OBPD:     GABLE_WriteOBPD(p_Engine->m_PPU, p_Value); break;
         case GABLE_HP_OPRI:     GABLE_WriteOPRI(p_Engine->m_PPU, p_Value); break;
         case GABLE_HP_GRPM:     GABLE_WriteGRPM(p_Engine->m_PPU, p_Value); break;
+        case GABLE_HP_LTAH:     GABLE_WriteLTAH(p_Engine->m_PPU, p_Value); break;
+        case GABLE_HP_LTAL:     GABLE_WriteLTAL(p_Engine->m_PPU, p_Value); break;
+        case GABLE_HP_LTC:      GABLE_WriteLTC(p_Engine->m_PPU, p_Value); break;
         case GABLE_HP_SVBK:     GABLE_WriteSVBK(p_Engine->m_RAM, p_Value); break;
         case GABLE_HP_SSBK:     GABLE_WriteSSBK(p_Engine->m_RAM, p_Value); break;
         case GABLE_HP_DSBKH:    GABLE_WriteDSBKH(p_Engine->m_DataStore, p_Value); break;
@@ -781,6 +878,15 @@ GABLE_NetworkContext* GABLE_GetNetwork (GABLE_Engine* p_Engine)
     return p_Engine->m_Network;
 }
 
+GABLE_Sequencer* GABLE_GetSequencer (GABLE_Engine* p_Engine)
+{
+    // Validate the engine instance.
+    GABLE_expect(p_Engine != NULL, "Engine context is NULL!");
+
+    // Return the engine's music sequencer.
+    return p_Engine->m_Sequencer;
+}
+
 // Public Functions - User Data ////////////////////////////////////////////////////////////////////
 
 void* GABLE_GetUserdata (GABLE_Engine* p_Engine)
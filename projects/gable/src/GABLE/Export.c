@@ -0,0 +1,430 @@
+/**
+ * @file GABLE/Export.c
+ */
+
+#include <GABLE/Engine.h>
+#include <GABLE/APU.h>
+#include <GABLE/PPU.h>
+#include <GABLE/Export.h>
+
+// Platform-Specific ///////////////////////////////////////////////////////////////////////////////
+
+#if defined(GABLE_LINUX)
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#else
+    #error "The GABLE Engine's shared-memory export is not yet implemented for this platform."
+#endif
+
+// Private Constants ///////////////////////////////////////////////////////////////////////////////
+
+#define GABLE_EXPORT_MAX_NAME_LENGTH 255
+
+// GABLE Export Structure //////////////////////////////////////////////////////////////////////////
+
+typedef struct GABLE_Export
+{
+
+    // Shared-Memory Object
+    Char                        m_Name[GABLE_EXPORT_MAX_NAME_LENGTH + 1];   ///< @brief The shared-memory object's name.
+    Int32                       m_Descriptor;       ///< @brief The shared-memory object's file descriptor.
+    Uint8*                      m_Mapping;          ///< @brief The shared-memory object, mapped into memory.
+    Size                        m_MappingSize;      ///< @brief The size of the mapping, in bytes.
+    Bool                        m_Writer;           ///< @brief Is this the engine side of the export?
+
+    // Layout
+    GABLE_ExportHeader*         m_Header;           ///< @brief The shared-memory object's header.
+    GABLE_ExportFrameSlot*      m_FrameSlots;       ///< @brief The ring of frame slots.
+    GABLE_ExportAudioBlock*     m_AudioBlocks;      ///< @brief The ring of audio blocks.
+
+    // Engine Side State
+    Float32                     m_PendingSamples[GABLE_EXPORT_AUDIO_BLOCK_SAMPLES * 2];     ///< @brief The audio block being filled.
+    Count                       m_PendingSampleCount;   ///< @brief The number of samples in the audio block being filled.
+    Uint64                      m_FrameCount;           ///< @brief The number of frames published.
+    Uint64                      m_AudioBlockCount;      ///< @brief The number of audio blocks published.
+
+} GABLE_Export;
+
+// Static Function Prototypes //////////////////////////////////////////////////////////////////////
+
+static Size GABLE_GetExportMappingSize (Count p_FrameSlotCount);
+static void GABLE_LocateExportLayout (GABLE_Export* p_Export);
+static void GABLE_BeginExportWrite (Uint64* p_Sequence);
+static void GABLE_EndExportWrite (Uint64* p_Sequence);
+static void GABLE_PublishAudioBlock (GABLE_Export* p_Export);
+
+// Static Functions ////////////////////////////////////////////////////////////////////////////////
+
+Size GABLE_GetExportMappingSize (Count p_FrameSlotCount)
+{
+    return sizeof(GABLE_ExportHeader) +
+        (p_FrameSlotCount * sizeof(GABLE_ExportFrameSlot)) +
+        (GABLE_EXPORT_AUDIO_BLOCK_COUNT * sizeof(GABLE_ExportAudioBlock));
+}
+
+void GABLE_LocateExportLayout (GABLE_Export* p_Export)
+{
+    p_Export->m_Header = (GABLE_ExportHeader*) p_Export->m_Mapping;
+    p_Export->m_FrameSlots = (GABLE_ExportFrameSlot*) (p_Export->m_Mapping + p_Export->m_Header->m_FrameOffset);
+    p_Export->m_AudioBlocks = (GABLE_ExportAudioBlock*) (p_Export->m_Mapping + p_Export->m_Header->m_AudioOffset);
+}
+
+void GABLE_BeginExportWrite (Uint64* p_Sequence)
+{
+
+    // Make the sequence counter odd, so that readers know the slot is being written. The fence
+    // keeps the writes which follow from being seen before the counter is.
+    Uint64 l_Sequence = __atomic_load_n(p_Sequence, __ATOMIC_RELAXED);
+    __atomic_store_n(p_Sequence, l_Sequence + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+}
+
+void GABLE_EndExportWrite (Uint64* p_Sequence)
+{
+
+    // Make the sequence counter even again, once every write to the slot can be seen.
+    Uint64 l_Sequence = __atomic_load_n(p_Sequence, __ATOMIC_RELAXED);
+    __atomic_store_n(p_Sequence, l_Sequence + 1, __ATOMIC_RELEASE);
+
+}
+
+void GABLE_PublishAudioBlock (GABLE_Export* p_Export)
+{
+
+    Uint64 l_BlockNumber = ++p_Export->m_AudioBlockCount;
+    GABLE_ExportAudioBlock* l_Block =
+        &p_Export->m_AudioBlocks[(l_BlockNumber - 1) % GABLE_EXPORT_AUDIO_BLOCK_COUNT];
+
+    GABLE_BeginExportWrite(&l_Block->m_Sequence);
+    __atomic_store_n(&l_Block->m_BlockNumber, l_BlockNumber, __ATOMIC_RELAXED);
+    memcpy(l_Block->m_Samples, p_Export->m_PendingSamples, sizeof(l_Block->m_Samples));
+    GABLE_EndExportWrite(&l_Block->m_Sequence);
+
+    __atomic_store_n(&p_Export->m_Header->m_LatestAudioBlock, l_BlockNumber, __ATOMIC_RELEASE);
+    p_Export->m_PendingSampleCount = 0;
+
+}
+
+// Public Functions - Engine Side //////////////////////////////////////////////////////////////////
+
+GABLE_Export* GABLE_CreateExport (const Char* p_Name, Count p_FrameSlotCount)
+{
+
+    GABLE_expect(p_Name != NULL, "Export name is NULL!");
+    GABLE_vcheck(p_Name[0] == '/', NULL, "Export name '%s' must start with a '/'!", p_Name);
+    GABLE_vcheck(strlen(p_Name) <= GABLE_EXPORT_MAX_NAME_LENGTH, NULL, "Export name '%s' is too long!", p_Name);
+
+    if (p_FrameSlotCount == 0)
+    {
+        p_FrameSlotCount = GABLE_EXPORT_DEFAULT_FRAME_SLOTS;
+    }
+    else if (p_FrameSlotCount < 2)
+    {
+        p_FrameSlotCount = 2;
+    }
+    else if (p_FrameSlotCount > GABLE_EXPORT_MAX_FRAME_SLOTS)
+    {
+        p_FrameSlotCount = GABLE_EXPORT_MAX_FRAME_SLOTS;
+    }
+
+    // Allocate the export.
+    GABLE_Export* l_Export = GABLE_calloc(1, GABLE_Export);
+    GABLE_pexpect(l_Export != NULL, "Failed to allocate export");
+    strncpy(l_Export->m_Name, p_Name, GABLE_EXPORT_MAX_NAME_LENGTH);
+    l_Export->m_MappingSize = GABLE_GetExportMappingSize(p_FrameSlotCount);
+    l_Export->m_Writer = true;
+
+    // Create the shared-memory object, replacing any left behind by an earlier run, and map it in.
+    // A freshly-sized object is zero-filled, so every slot and block starts out empty.
+    shm_unlink(p_Name);
+    l_Export->m_Descriptor = shm_open(p_Name, O_CREAT | O_EXCL | O_RDWR, 0644);
+    if (l_Export->m_Descriptor < 0)
+    {
+        GABLE_perror("Failed to create export '%s'", p_Name);
+        GABLE_free(l_Export);
+        return NULL;
+    }
+
+    if (ftruncate(l_Export->m_Descriptor, (off_t) l_Export->m_MappingSize) < 0)
+    {
+        GABLE_perror("Failed to size export '%s'", p_Name);
+        close(l_Export->m_Descriptor);
+        shm_unlink(p_Name);
+        GABLE_free(l_Export);
+        return NULL;
+    }
+
+    void* l_Mapping = mmap(NULL, l_Export->m_MappingSize, PROT_READ | PROT_WRITE, MAP_SHARED,
+        l_Export->m_Descriptor, 0);
+    if (l_Mapping == MAP_FAILED)
+    {
+        GABLE_perror("Failed to map export '%s'", p_Name);
+        close(l_Export->m_Descriptor);
+        shm_unlink(p_Name);
+        GABLE_free(l_Export);
+        return NULL;
+    }
+
+    // Fill in the header. The magic number goes in last, so that a reader opening the export before
+    // the header is complete turns it away.
+    l_Export->m_Mapping = (Uint8*) l_Mapping;
+    GABLE_ExportHeader* l_Header = (GABLE_ExportHeader*) l_Mapping;
+    l_Header->m_Version = GABLE_EXPORT_VERSION;
+    l_Header->m_FrameWidth = GABLE_PPU_SCREEN_WIDTH;
+    l_Header->m_FrameHeight = GABLE_PPU_SCREEN_HEIGHT;
+    l_Header->m_FrameSlotCount = (Uint32) p_FrameSlotCount;
+    l_Header->m_AudioBlockCount = GABLE_EXPORT_AUDIO_BLOCK_COUNT;
+    l_Header->m_AudioBlockSamples = GABLE_EXPORT_AUDIO_BLOCK_SAMPLES;
+    l_Header->m_AudioSampleRate = GABLE_AUDIO_SAMPLE_RATE;
+    l_Header->m_FrameOffset = sizeof(GABLE_ExportHeader);
+    l_Header->m_AudioOffset = sizeof(GABLE_ExportHeader) + (p_FrameSlotCount * sizeof(GABLE_ExportFrameSlot));
+    __atomic_store_n(&l_Header->m_Magic, GABLE_EXPORT_MAGIC, __ATOMIC_RELEASE);
+
+    GABLE_LocateExportLayout(l_Export);
+    return l_Export;
+
+}
+
+void GABLE_ExportFrame (GABLE_Export* p_Export, const Uint32* p_Frame)
+{
+
+    GABLE_expect(p_Export != NULL, "Export is NULL!");
+    GABLE_check(p_Export->m_Writer == true, "Export was opened for reading!");
+    GABLE_check(p_Frame != NULL, "Frame is NULL!");
+
+    // Write the frame into the oldest slot. Any reader still using that slot will see its sequence
+    // counter change, and know to discard what it read.
+    Uint64 l_FrameNumber = ++p_Export->m_FrameCount;
+    GABLE_ExportFrameSlot* l_Slot =
+        &p_Export->m_FrameSlots[(l_FrameNumber - 1) % p_Export->m_Header->m_FrameSlotCount];
+
+    GABLE_BeginExportWrite(&l_Slot->m_Sequence);
+    __atomic_store_n(&l_Slot->m_FrameNumber, l_FrameNumber, __ATOMIC_RELAXED);
+    memcpy(l_Slot->m_Pixels, p_Frame, sizeof(l_Slot->m_Pixels));
+    GABLE_EndExportWrite(&l_Slot->m_Sequence);
+
+    __atomic_store_n(&p_Export->m_Header->m_LatestFrame, l_FrameNumber, __ATOMIC_RELEASE);
+
+}
+
+void GABLE_ExportAudioSample (GABLE_Export* p_Export, const GABLE_AudioSample* p_Sample)
+{
+
+    GABLE_expect(p_Export != NULL, "Export is NULL!");
+    GABLE_check(p_Export->m_Writer == true, "Export was opened for reading!");
+    GABLE_check(p_Sample != NULL, "Audio sample is NULL!");
+
+    p_Export->m_PendingSamples[p_Export->m_PendingSampleCount * 2] = p_Sample->m_Left;
+    p_Export->m_PendingSamples[p_Export->m_PendingSampleCount * 2 + 1] = p_Sample->m_Right;
+    if (++p_Export->m_PendingSampleCount == GABLE_EXPORT_AUDIO_BLOCK_SAMPLES)
+    {
+        GABLE_PublishAudioBlock(p_Export);
+    }
+
+}
+
+// Public Functions - Reader Side //////////////////////////////////////////////////////////////////
+
+GABLE_Export* GABLE_OpenExport (const Char* p_Name)
+{
+
+    GABLE_expect(p_Name != NULL, "Export name is NULL!");
+    GABLE_vcheck(strlen(p_Name) <= GABLE_EXPORT_MAX_NAME_LENGTH, NULL, "Export name '%s' is too long!", p_Name);
+
+    Int32 l_Descriptor = shm_open(p_Name, O_RDONLY, 0);
+    if (l_Descriptor < 0)
+    {
+        GABLE_perror("Failed to open export '%s'", p_Name);
+        return NULL;
+    }
+
+    struct stat l_Stat;
+    if (fstat(l_Descriptor, &l_Stat) < 0 || (Size) l_Stat.st_size < sizeof(GABLE_ExportHeader))
+    {
+        GABLE_error("Export '%s' is not a GABLE export.", p_Name);
+        close(l_Descriptor);
+        return NULL;
+    }
+
+    // Map the export in read-only; readers never write to shared memory, so a misbehaving reader
+    // cannot corrupt what the engine or any other reader sees.
+    void* l_Mapping = mmap(NULL, (Size) l_Stat.st_size, PROT_READ, MAP_SHARED, l_Descriptor, 0);
+    if (l_Mapping == MAP_FAILED)
+    {
+        GABLE_perror("Failed to map export '%s'", p_Name);
+        close(l_Descriptor);
+        return NULL;
+    }
+
+    // Make sure the export's layout is one this build understands, and that it fits in the object.
+    const GABLE_ExportHeader* l_Header = (const GABLE_ExportHeader*) l_Mapping;
+    if (
+        __atomic_load_n(&l_Header->m_Magic, __ATOMIC_ACQUIRE) != GABLE_EXPORT_MAGIC ||
+        l_Header->m_Version != GABLE_EXPORT_VERSION ||
+        l_Header->m_FrameWidth != GABLE_PPU_SCREEN_WIDTH ||
+        l_Header->m_FrameHeight != GABLE_PPU_SCREEN_HEIGHT ||
+        l_Header->m_FrameSlotCount < 2 ||
+        l_Header->m_FrameSlotCount > GABLE_EXPORT_MAX_FRAME_SLOTS ||
+        l_Header->m_AudioBlockCount != GABLE_EXPORT_AUDIO_BLOCK_COUNT ||
+        l_Header->m_AudioBlockSamples != GABLE_EXPORT_AUDIO_BLOCK_SAMPLES ||
+        l_Header->m_FrameOffset != sizeof(GABLE_ExportHeader) ||
+        l_Header->m_AudioOffset != sizeof(GABLE_ExportHeader) +
+            (l_Header->m_FrameSlotCount * sizeof(GABLE_ExportFrameSlot)) ||
+        (Size) l_Stat.st_size < GABLE_GetExportMappingSize(l_Header->m_FrameSlotCount)
+    )
+    {
+        GABLE_error("Export '%s' is not a GABLE export, or is from an incompatible version.", p_Name);
+        munmap(l_Mapping, (Size) l_Stat.st_size);
+        close(l_Descriptor);
+        return NULL;
+    }
+
+    GABLE_Export* l_Export = GABLE_calloc(1, GABLE_Export);
+    GABLE_pexpect(l_Export != NULL, "Failed to allocate export");
+    strncpy(l_Export->m_Name, p_Name, GABLE_EXPORT_MAX_NAME_LENGTH);
+    l_Export->m_Descriptor = l_Descriptor;
+    l_Export->m_Mapping = (Uint8*) l_Mapping;
+    l_Export->m_MappingSize = (Size) l_Stat.st_size;
+    l_Export->m_Writer = false;
+
+    GABLE_LocateExportLayout(l_Export);
+    return l_Export;
+
+}
+
+Uint64 GABLE_GetLatestExportedFrame (const GABLE_Export* p_Export)
+{
+    GABLE_expect(p_Export != NULL, "Export is NULL!");
+    return __atomic_load_n(&p_Export->m_Header->m_LatestFrame, __ATOMIC_ACQUIRE);
+}
+
+const Uint32* GABLE_BeginExportedFrameRead (const GABLE_Export* p_Export, Uint64 p_FrameNumber,
+    Uint64* p_Ticket)
+{
+
+    GABLE_expect(p_Export != NULL, "Export is NULL!");
+    GABLE_expect(p_Ticket != NULL, "Ticket is NULL!");
+
+    if (p_FrameNumber == 0)
+    {
+        return NULL;
+    }
+
+    // Note the slot's sequence counter. If it is odd, then the engine is writing to the slot right
+    // now; if the slot holds some other frame, then the requested frame is gone (or yet to come).
+    const GABLE_ExportFrameSlot* l_Slot =
+        &p_Export->m_FrameSlots[(p_FrameNumber - 1) % p_Export->m_Header->m_FrameSlotCount];
+    Uint64 l_Sequence = __atomic_load_n(&l_Slot->m_Sequence, __ATOMIC_ACQUIRE);
+    if (
+        (l_Sequence & 1) != 0 ||
+        __atomic_load_n(&l_Slot->m_FrameNumber, __ATOMIC_RELAXED) != p_FrameNumber
+    )
+    {
+        return NULL;
+    }
+
+    *p_Ticket = l_Sequence;
+    return l_Slot->m_Pixels;
+
+}
+
+Bool GABLE_EndExportedFrameRead (const GABLE_Export* p_Export, Uint64 p_FrameNumber, Uint64 p_Ticket)
+{
+
+    GABLE_expect(p_Export != NULL, "Export is NULL!");
+
+    if (p_FrameNumber == 0)
+    {
+        return false;
+    }
+
+    // The fence keeps the reads of the frame's pixels from being moved past the second look at the
+    // sequence counter. If the counter hasn't moved, then nothing was written while they were read.
+    const GABLE_ExportFrameSlot* l_Slot =
+        &p_Export->m_FrameSlots[(p_FrameNumber - 1) % p_Export->m_Header->m_FrameSlotCount];
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    return __atomic_load_n(&l_Slot->m_Sequence, __ATOMIC_RELAXED) == p_Ticket;
+
+}
+
+Uint64 GABLE_GetLatestExportedAudioBlock (const GABLE_Export* p_Export)
+{
+    GABLE_expect(p_Export != NULL, "Export is NULL!");
+    return __atomic_load_n(&p_Export->m_Header->m_LatestAudioBlock, __ATOMIC_ACQUIRE);
+}
+
+Bool GABLE_ReadExportedAudioBlock (const GABLE_Export* p_Export, Uint64 p_BlockNumber,
+    GABLE_AudioSample* p_Samples)
+{
+
+    GABLE_expect(p_Export != NULL, "Export is NULL!");
+    GABLE_expect(p_Samples != NULL, "Samples buffer is NULL!");
+
+    if (p_BlockNumber == 0)
+    {
+        return false;
+    }
+
+    const GABLE_ExportAudioBlock* l_Block =
+        &p_Export->m_AudioBlocks[(p_BlockNumber - 1) % GABLE_EXPORT_AUDIO_BLOCK_COUNT];
+    Uint64 l_Sequence = __atomic_load_n(&l_Block->m_Sequence, __ATOMIC_ACQUIRE);
+    if (
+        (l_Sequence & 1) != 0 ||
+        __atomic_load_n(&l_Block->m_BlockNumber, __ATOMIC_RELAXED) != p_BlockNumber
+    )
+    {
+        return false;
+    }
+
+    for (Index i = 0; i < GABLE_EXPORT_AUDIO_BLOCK_SAMPLES; ++i)
+    {
+        p_Samples[i].m_Left = l_Block->m_Samples[i * 2];
+        p_Samples[i].m_Right = l_Block->m_Samples[i * 2 + 1];
+    }
+
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    return __atomic_load_n(&l_Block->m_Sequence, __ATOMIC_RELAXED) == l_Sequence;
+
+}
+
+// Public Functions - Both Sides ///////////////////////////////////////////////////////////////////
+
+void GABLE_DestroyExport (GABLE_Export* p_Export)
+{
+
+    if (p_Export != NULL)
+    {
+        munmap(p_Export->m_Mapping, p_Export->m_MappingSize);
+        close(p_Export->m_Descriptor);
+
+        // Removing the object only removes its name; readers which have it mapped keep their view
+        // of it until they close it themselves.
+        if (p_Export->m_Writer == true)
+        {
+            shm_unlink(p_Export->m_Name);
+        }
+
+        GABLE_free(p_Export);
+    }
+
+}
+
+const GABLE_ExportHeader* GABLE_GetExportHeader (const GABLE_Export* p_Export)
+{
+    GABLE_expect(p_Export != NULL, "Export is NULL!");
+    return p_Export->m_Header;
+}
+
+// Public Functions - High-Level Functions /////////////////////////////////////////////////////////
+
+void GABLE_ExportScreenBuffer (GABLE_Engine* p_Engine, GABLE_Export* p_Export)
+{
+    GABLE_expect(p_Engine != NULL, "Engine context is NULL!");
+    GABLE_expect(p_Export != NULL, "Export is NULL!");
+    __atomic_store_n(&p_Export->m_Header->m_AudioSampleRate, GABLE_GetAudioSampleRate(p_Engine),
+        __ATOMIC_RELAXED);
+    GABLE_ExportFrame(p_Export, GABLE_GetScreenBuffer(p_Engine));
+}
@@ -4,8 +4,36 @@
 
 #include <GABLE/Engine.h>
 #include <GABLE/InterruptContext.h>
+#include <GABLE/APU.h>
 #include <GABLE/PPU.h>
 
+// Platform-Specific ///////////////////////////////////////////////////////////////////////////////
+
+#if defined(GABLE_LINUX)
+    #include <pthread.h>
+    #include <sched.h>
+    #include <stdatomic.h>
+#else
+    #error "The GABLE Engine's threaded renderer is not yet implemented for this platform."
+#endif
+
+// Private Constants ///////////////////////////////////////////////////////////////////////////////
+
+/** @brief The number of entries in the threaded renderer's write log. Must be a power of two. */
+#define GABLE_PPU_WRITE_LOG_SIZE 0x10000
+
+/** @brief The number of times the render worker yields while idle before going to sleep. */
+#define GABLE_PPU_WORKER_IDLE_SPINS 64
+
+/** @brief The width and height of a tilemap, in pixels. */
+#define GABLE_PPU_TILEMAP_PIXEL_SIZE 256
+
+/** @brief The number of tilemap columns the background layer can span on a single line. */
+#define GABLE_PPU_LINE_TILE_SPAN 21
+
+/** @brief The number of tilemap rows the background layer can span in a single frame. */
+#define GABLE_PPU_FRAME_TILE_SPAN 19
+
 // Static Constants ////////////////////////////////////////////////////////////////////////////////
 
 static const Uint32 GABLE_PPU_DMG_PALETTE[4] =
@@ -52,6 +80,142 @@ static const GABLE_ColorRGB555 GABLE_PRESET_COLORS[] =
     [GABLE_COLOR_BRONZE]        = { .m_Red = 15, .m_Green = 8,   .m_Blue = 0   },
 };
 
+// GABLE PPU Write Log Structures //////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Enumerates the destinations of the writes recorded in the threaded renderer's write log.
+ */
+typedef enum GABLE_PPUWriteTarget
+{
+    GABLE_PWT_VRAM0 = 0,    ///< @brief A byte in VRAM bank 0. The address is relative.
+    GABLE_PWT_VRAM1,        ///< @brief A byte in VRAM bank 1. The address is relative.
+    GABLE_PWT_OAM,          ///< @brief A byte in OAM. The address is relative.
+    GABLE_PWT_BG_CRAM,      ///< @brief A byte in background color RAM. The address is the byte index.
+    GABLE_PWT_OBJ_CRAM,     ///< @brief A byte in object color RAM. The address is the byte index.
+    GABLE_PWT_REGISTER      ///< @brief A PPU register. The address is the register's `G_*` shortform.
+} GABLE_PPUWriteTarget;
+
+/**
+ * @brief A single entry in the threaded renderer's write log.
+ */
+typedef struct GABLE_PPUWrite
+{
+    Uint64                      m_Dot;          ///< @brief The number of dots the PPU had ticked when the write was made.
+    Uint16                      m_Address;      ///< @brief The address written to. Meaning depends on `m_Target`.
+    Uint8                       m_Target;       ///< @brief The write's destination. See `GABLE_PPUWriteTarget`.
+    Uint8                       m_Value;        ///< @brief The value written.
+} GABLE_PPUWrite;
+
+/**
+ * @brief The state of the threaded renderer, owned by a PPU while threaded rendering is enabled.
+ *
+ * While threaded rendering is enabled, the PPU ticked by the engine only keeps track of display
+ * timing, and records every write which affects the rendered image into the write log, tagged with
+ * the dot at which it was made. The render worker thread owns a second, "shadow" PPU context, which
+ * it ticks through the regular pixel-fetcher state machine, applying each logged write once the
+ * shadow has reached that write's dot.
+ *
+ * The write log is a single-producer, single-consumer ring buffer: the engine's thread only ever
+ * advances the tail, and the render worker only ever advances the head.
+ */
+typedef struct GABLE_PPUWorker
+{
+    pthread_t                   m_Thread;                           ///< @brief The render worker's thread handle.
+    pthread_mutex_t             m_Mutex;                            ///< @brief Guards the render worker's sleep.
+    pthread_cond_t              m_WakeCondition;                    ///< @brief Signalled to wake the render worker.
+    GABLE_PPU*                  m_Shadow;                           ///< @brief The shadow PPU context rendered by the worker.
+    Uint64                      m_Dots;                             ///< @brief The number of dots ticked by the engine's PPU.
+    GABLE_PPUWrite              m_Log[GABLE_PPU_WRITE_LOG_SIZE];    ///< @brief The write log's ring buffer.
+    _Atomic Uint64              m_LogHead;                          ///< @brief The index of the next entry to be replayed.
+    _Atomic Uint64              m_LogTail;                          ///< @brief The index of the next entry to be recorded.
+    _Atomic Uint64              m_PublishedDots;                    ///< @brief The number of dots the shadow may tick up to.
+    _Atomic Uint64              m_RenderedDots;                     ///< @brief The number of dots the shadow has ticked.
+    _Atomic Bool                m_Sleeping;                         ///< @brief Set while the render worker is asleep.
+    _Atomic Bool                m_Stopping;                         ///< @brief Set when the render worker should exit.
+} GABLE_PPUWorker;
+
+// GABLE PPU Background Cache Structure ////////////////////////////////////////////////////////////
+
+/**
+ * @brief A pre-rendered copy of both of the PPU's 256x256 pixel tilemaps, used to skip the pixel
+ *        fetcher on scanlines which only show the background layer (plus any objects).
+ *
+ * Each 8x8 pixel cell of each tilemap is re-rendered lazily, the next time a scanline needs it,
+ * after being invalidated by a write to its tile number, its attributes, or the tile data it points
+ * to. Changes which affect every cell at once (the background palettes, the graphics mode, the
+ * current VRAM bank and the tile data addressing mode) invalidate the whole cache.
+ */
+typedef struct GABLE_BackgroundCache
+{
+    Uint32  m_Colors[2][GABLE_PPU_TILEMAP_PIXEL_SIZE * GABLE_PPU_TILEMAP_PIXEL_SIZE];         ///< @brief The RGBA color of each pixel in each tilemap.
+    Uint8   m_ColorIndices[2][GABLE_PPU_TILEMAP_PIXEL_SIZE * GABLE_PPU_TILEMAP_PIXEL_SIZE];   ///< @brief The color index of each pixel in each tilemap, used for object priority.
+    Bool    m_DirtyCells[2][GABLE_PPU_VRAM_TILEMAP_SIZE];                                       ///< @brief Which cells of each tilemap need to be re-rendered.
+    Bool    m_DirtyTiles[2][GABLE_PPU_VRAM_TILE_COUNT];                                         ///< @brief Which tiles in each VRAM bank have been written to.
+    Bool    m_TileDataDirty;                                                                    ///< @brief Set if any tile in `m_DirtyTiles` has been written to.
+    Bool    m_AllDirty;                                                                         ///< @brief Set if every cell needs to be re-rendered.
+} GABLE_BackgroundCache;
+
+// GABLE PPU Tile Animation Structure //////////////////////////////////////////////////////////////
+
+/**
+ * @brief The state of one of the PPU's tile animation slots.
+ */
+typedef struct GABLE_TileAnimation
+{
+    Uint16                      m_SourceBank;       ///< @brief The number of the data store bank holding the animation's frames.
+    Uint16                      m_SourceOffset;     ///< @brief The offset of the animation's first frame within its data store bank.
+    Uint16                      m_FirstTile;        ///< @brief The index of the first tile animated, relative to the start of its VRAM bank.
+    Uint16                      m_TileCount;        ///< @brief The number of tiles animated.
+    Uint16                      m_FrameCount;       ///< @brief The number of frames in the animation.
+    Uint16                      m_CurrentFrame;     ///< @brief The index of the frame currently held in VRAM.
+    Uint8                       m_VRAMBank;         ///< @brief The VRAM bank holding the tiles animated.
+    Uint8                       m_FramePeriod;      ///< @brief The number of frames each frame of the animation is shown for.
+    Uint8                       m_FramesLeft;       ///< @brief The number of frames left before the next frame of the animation is copied.
+    Bool                        m_Active;           ///< @brief Is the slot in use?
+} GABLE_TileAnimation;
+
+// GABLE PPU Map Streamer Structure ////////////////////////////////////////////////////////////////
+
+/**
+ * @brief The state of the PPU's map streamer.
+ *
+ * The map streamer treats one of the 32x32 tilemaps as a window onto a larger map, wrapping around
+ * at its edges. The tilemap only ever holds the part of the map around the camera which can be seen
+ * on the screen; as the camera moves, the rows and columns of the map which come into view are
+ * written over the ones which have gone out of view.
+ */
+typedef struct GABLE_MapStreamer
+{
+    Uint16                      m_TileBank;         ///< @brief The number of the data store bank holding the map's tile numbers.
+    Uint16                      m_TileOffset;       ///< @brief The offset of the map's tile numbers within their data store bank.
+    Uint16                      m_AttributeBank;    ///< @brief The number of the data store bank holding the map's tile attributes.
+    Uint16                      m_AttributeOffset;  ///< @brief The offset of the map's tile attributes within their data store bank.
+    Uint16                      m_Width;            ///< @brief The width of the map, in tiles.
+    Uint16                      m_Height;           ///< @brief The height of the map, in tiles.
+    Uint16                      m_CameraX;          ///< @brief The X-coordinate of the camera within the map, in pixels.
+    Uint16                      m_CameraY;          ///< @brief The Y-coordinate of the camera within the map, in pixels.
+    Uint16                      m_StreamedX;        ///< @brief The X-coordinate of the top-left tile last streamed into the tilemap.
+    Uint16                      m_StreamedY;        ///< @brief The Y-coordinate of the top-left tile last streamed into the tilemap.
+    Uint8                       m_Tilemap;          ///< @brief The tilemap streamed into (0 for `$9800`, 1 for `$9C00`).
+    Bool                        m_HasAttributes;    ///< @brief Does the map have tile attributes?
+    Bool                        m_Streamed;         ///< @brief Has the visible part of the map been streamed into the tilemap yet?
+    Bool                        m_Active;           ///< @brief Is the map streamer in use?
+} GABLE_MapStreamer;
+
+// GABLE PPU Palette Fade Structure ////////////////////////////////////////////////////////////////
+
+/**
+ * @brief The state of a palette fade in progress.
+ */
+typedef struct GABLE_PaletteFade
+{
+    Uint8                       m_Source[2][GABLE_PPU_CRAM_SIZE];   ///< @brief The background and object color RAM, as they were when the fade began.
+    Uint8                       m_Target[2][GABLE_PPU_CRAM_SIZE];   ///< @brief The background and object color RAM, as they will be when the fade ends.
+    Uint16                      m_FrameCount;                       ///< @brief The number of frames the fade lasts for.
+    Uint16                      m_Frame;                            ///< @brief The number of frames the fade has lasted so far.
+    Bool                        m_Active;                           ///< @brief Is the fade in progress?
+} GABLE_PaletteFade;
+
 // GABLE PPU Structure /////////////////////////////////////////////////////////////////////////////
 
 typedef struct GABLE_PPU
@@ -121,6 +285,11 @@ typedef struct GABLE_PPU
      */
     Uint8                       m_GRPM;
 
+    // Hardware Registers - Line Table
+    Uint8                       m_LTAH;                                           ///< @brief The line table address high byte register.
+    Uint8                       m_LTAL;                                           ///< @brief The line table address low byte register.
+    GABLE_LineTableControl      m_LTC;                                            ///< @brief The line table control register.
+
     // Pixel Fetcher
     GABLE_PixelFetcher          m_PixelFetcher;                                   ///< @brief The PPU's pixel-fetcher unit.
 
@@ -130,6 +299,12 @@ typedef struct GABLE_PPU
     // Internal Registers - Current Dot
     Uint16                      m_CurrentDot;                                     ///< @brief The current dot of the scanline being rendered.
 
+    // Internal Registers - Next Mode Boundary
+    Uint16                      m_NextModeDot;                                    ///< @brief The dot at which the current display mode ends, in headless mode.
+
+    // Internal Registers - LCD-Off Frame Counter
+    Uint32                      m_LCDOffDots;                                     ///< @brief The number of dots elapsed in the current virtual frame while the display is off.
+
     // Internal Registers - OAM DMA Transfer
     Uint16                      m_ODMASource;                                     ///< @brief The source address of the OAM DMA transfer.
     Uint16                      m_ODMADestination;                                ///< @brief The destination address of the OAM DMA transfer.
@@ -145,15 +320,40 @@ typedef struct GABLE_PPU
     Uint8                       m_LineObjectIndices[GABLE_PPU_OAM_OBJECT_COUNT];  ///< @brief The indices of the objects found on the current scanline.
     Uint8                       m_LineObjectCount;                                ///< @brief The number of objects found on the current scanline.
 
+    // Tile Animation Slots
+    GABLE_TileAnimation         m_TileAnimations[GABLE_PPU_TILE_ANIMATION_SLOT_COUNT]; ///< @brief The tile animation slots.
+
+    // Map Streamer
+    GABLE_MapStreamer           m_MapStreamer;                                    ///< @brief The map streamer.
+
+    // Palette Fade
+    GABLE_PaletteFade           m_PaletteFade;                                    ///< @brief The palette fade in progress, if any.
+
     // Frame Rendered Callback
     GABLE_FrameRenderedCallback m_FrameRenderedCallback;                          ///< @brief The callback function to invoke when a frame is rendered.
 
+    // Scanline Rendered Callback
+    GABLE_ScanlineRenderedCallback m_ScanlineRenderedCallback;                    ///< @brief The callback function to invoke when a scanline is rendered.
+
+    // Threaded Rendering
+    GABLE_PPUWorker*            m_Worker;                                         ///< @brief The threaded renderer's state, or `NULL` if threaded rendering is disabled.
+
+    // Background Cache
+    GABLE_BackgroundCache*      m_BackgroundCache;                                ///< @brief The background cache, or `NULL` if background caching is disabled.
+    Bool                        m_LineFromCache;                                  ///< @brief Was the current scanline rendered from the background cache?
+
+    // Headless Mode
+    Bool                        m_Headless;                                       ///< @brief Is the PPU keeping the display's timing without producing any pixels?
+    Bool                        m_CountingFetcher;                                ///< @brief Is the pixel fetcher being stepped through, without drawing, for the rest of this pixel transfer?
+
 } GABLE_PPU;
 
 // Static Function Prototypes - Misc. Helper Functions /////////////////////////////////////////////
 
 static Bool GABLE_IsWindowVisible (GABLE_PPU* p_PPU);
+static void GABLE_RequestPPUInterrupt (GABLE_Engine* p_Engine, GABLE_InterruptType p_Type);
 static void GABLE_IncrementLY (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine);
+static void GABLE_ApplyLCDC (GABLE_PPU* p_PPU, Uint8 p_Value);
 
 // Static Function Prototypes - Object Scan ////////////////////////////////////////////////////////
 
@@ -187,11 +387,58 @@ static void GABLE_TickHorizontalBlank (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine)
 static void GABLE_TickVerticalBlank (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine);
 static void GABLE_TickObjectScan (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine);
 static void GABLE_TickPixelTransfer (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine);
+static Uint16 GABLE_GetPixelTransferLength (GABLE_PPU* p_PPU);
+static void GABLE_TickTimedPixelTransfer (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine);
+static void GABLE_EnterHorizontalBlank (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine);
+static void GABLE_TickDisplayMode (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine);
+static void GABLE_ScheduleModeBoundary (GABLE_PPU* p_PPU);
+static void GABLE_TickPixelFetcherTiming (GABLE_PPU* p_PPU, GABLE_PixelFetcher* p_Fetcher, Uint16 p_Dot);
+static void GABLE_CatchUpPixelFetcher (GABLE_PPU* p_PPU);
+static void GABLE_TickCountedPixelTransfer (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine);
+static void GABLE_TickHeadlessPPU (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine);
+
+// Static Function Prototypes - Line Table /////////////////////////////////////////////////////////
+
+static void GABLE_ApplyLineTable (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine);
+
+// Static Function Prototypes - Tile Animation /////////////////////////////////////////////////////
+
+static void GABLE_CopyTileAnimationFrame (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine, const GABLE_TileAnimation* p_Animation);
+static void GABLE_TickTileAnimations (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine);
+
+// Static Function Prototypes - Map Streamer ///////////////////////////////////////////////////////
+
+static void GABLE_StreamMapRegion (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine, Uint16 p_X, Uint16 p_Y, Uint16 p_Width, Uint16 p_Height);
+static void GABLE_TickMapStreamer (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine);
+
+// Static Function Prototypes - Palettes ///////////////////////////////////////////////////////////
+
+static void GABLE_StoreCRAM (GABLE_PPU* p_PPU, Bool p_Object, Uint8 p_Index, const Uint8* p_Data, Size p_Length);
+static void GABLE_TickPaletteFade (GABLE_PPU* p_PPU);
 
 // Static Function Prototypes - HDMA Transfer //////////////////////////////////////////////////////
 
 static void GABLE_TickHDMA (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine);
 
+// Static Function Prototypes - Threaded Rendering /////////////////////////////////////////////////
+
+static void GABLE_LogPPUWrite (GABLE_PPU* p_PPU, GABLE_PPUWriteTarget p_Target, Uint16 p_Address, Uint8 p_Value);
+static void GABLE_ReplayPPUWrite (GABLE_PPU* p_Shadow, const GABLE_PPUWrite* p_Write);
+static void GABLE_WakePPUWorker (GABLE_PPUWorker* p_Worker);
+static void GABLE_SyncPPUWorker (GABLE_PPU* p_PPU);
+static void* GABLE_PPUWorkerMain (void* p_Argument);
+static void GABLE_StartPPUWorker (GABLE_PPU* p_PPU);
+static void GABLE_StopPPUWorker (GABLE_PPU* p_PPU);
+
+// Static Function Prototypes - Background Cache ///////////////////////////////////////////////////
+
+static void GABLE_InvalidateBackgroundCache (GABLE_PPU* p_PPU, Uint8 p_Bank, Uint16 p_Address);
+static void GABLE_InvalidateWholeBackgroundCache (GABLE_PPU* p_PPU);
+static void GABLE_RenderCachedCell (GABLE_PPU* p_PPU, GABLE_BackgroundCache* p_Cache, Uint8 p_Map, Uint16 p_Cell);
+static void GABLE_CompositeCachedLineObjects (GABLE_PPU* p_PPU, const Uint8* p_ColorIndices);
+static Bool GABLE_RenderCachedLine (GABLE_PPU* p_PPU);
+static void GABLE_LeaveCachedLine (GABLE_PPU* p_PPU);
+
 // Static Functions - Misc. Helper Functions ///////////////////////////////////////////////////////
 
 Bool GABLE_IsWindowVisible (GABLE_PPU* p_PPU)
@@ -201,6 +448,16 @@ Bool GABLE_IsWindowVisible (GABLE_PPU* p_PPU)
             p_PPU->m_WY < GABLE_PPU_SCREEN_HEIGHT;
 }
 
+void GABLE_RequestPPUInterrupt (GABLE_Engine* p_Engine, GABLE_InterruptType p_Type)
+{
+    // The threaded renderer's shadow PPU is ticked without an engine context, and must never
+    // request interrupts of its own.
+    if (p_Engine != NULL)
+    {
+        GABLE_RequestInterrupt(p_Engine, p_Type);
+    }
+}
+
 void GABLE_IncrementLY (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine)
 {
     
@@ -221,7 +478,49 @@ void GABLE_IncrementLY (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine)
     // interrupt.
     if (p_PPU->m_STAT.m_LineCoincidence == 1 && p_PPU->m_STAT.m_LineCoincidenceStatSource == 1)
     {
-        GABLE_RequestInterrupt(p_Engine, GABLE_INT_LCD_STAT);
+        GABLE_RequestPPUInterrupt(p_Engine, GABLE_INT_LCD_STAT);
+    }
+
+}
+
+void GABLE_ApplyLCDC (GABLE_PPU* p_PPU, Uint8 p_Value)
+{
+
+    GABLE_LeaveCachedLine(p_PPU);
+    Bool l_WasEnabled = p_PPU->m_LCDC.m_DisplayEnable;
+    Bool l_OldTileDataAddress = p_PPU->m_LCDC.m_BGWindowTileDataAddress;
+    p_PPU->m_LCDC.m_Register = p_Value;
+
+    // Changing the tile data addressing mode changes which tile every cell of the background
+    // cache points to.
+    if (l_OldTileDataAddress != p_PPU->m_LCDC.m_BGWindowTileDataAddress)
+    {
+        GABLE_InvalidateWholeBackgroundCache(p_PPU);
+    }
+
+    // If the display has just been turned off, then blank the screen buffer, reset the current
+    // line, and start counting the dots of the first virtual frame.
+    if (l_WasEnabled == true && p_PPU->m_LCDC.m_DisplayEnable == false)
+    {
+        for (Index i = 0; i < GABLE_PPU_SCREEN_BUFFER_SIZE; ++i)
+        {
+            p_PPU->m_ScreenBuffer[i] = GABLE_PPU_DMG_PALETTE[0];
+        }
+
+        p_PPU->m_LY = 0;
+        p_PPU->m_WindowLine = 0;
+        p_PPU->m_CurrentDot = 0;
+        p_PPU->m_LCDOffDots = 0;
+        p_PPU->m_STAT.m_DisplayMode = GABLE_DM_HORIZONTAL_BLANK;
+    }
+
+    // If the display has just been turned back on, then start the first frame from the top.
+    else if (l_WasEnabled == false && p_PPU->m_LCDC.m_DisplayEnable == true)
+    {
+        p_PPU->m_CurrentDot = 0;
+        p_PPU->m_LineObjectCount = 0;
+        p_PPU->m_STAT.m_DisplayMode = GABLE_DM_OBJECT_SCAN;
+        GABLE_ScheduleModeBoundary(p_PPU);
     }
 
 }
@@ -931,18 +1230,36 @@ void GABLE_TickHorizontalBlank (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine)
         {
             // Move to the vertical blank state and request the `VBLANK` interrupt.
             p_PPU->m_STAT.m_DisplayMode = GABLE_DM_VERTICAL_BLANK;
-            GABLE_RequestInterrupt(p_Engine, GABLE_INT_VBLANK);
+            GABLE_RequestPPUInterrupt(p_Engine, GABLE_INT_VBLANK);
 
             // If the `LCD_STAT` interrupt source is enabled for the vertical blank period, then
             // request the `LCD_STAT` interrupt as well.
             if (p_PPU->m_STAT.m_VerticalBlankStatSource == true)
             {
-                GABLE_RequestInterrupt(p_Engine, GABLE_INT_LCD_STAT);
+                GABLE_RequestPPUInterrupt(p_Engine, GABLE_INT_LCD_STAT);
+            }
+
+            // If threaded rendering is enabled, wait for the render worker to finish this frame,
+            // and pick up its screen buffer. The scanline rendered callback couldn't be called
+            // while the frame was being rendered, so call it for each scanline now.
+            if (p_PPU->m_Worker != NULL)
+            {
+                GABLE_SyncPPUWorker(p_PPU);
+                if (p_PPU->m_ScanlineRenderedCallback != NULL)
+                {
+                    for (Uint8 l_Line = 0; l_Line < GABLE_PPU_SCREEN_HEIGHT; ++l_Line)
+                    {
+                        p_PPU->m_ScanlineRenderedCallback(p_Engine, p_PPU, l_Line,
+                            &p_PPU->m_ScreenBuffer[l_Line * GABLE_PPU_SCREEN_WIDTH]);
+                    }
+                }
             }
 
-            // If the frame rendered callback is provided, call it here.
+            // If the frame rendered callback is provided, call it here. Bring the APU up to date
+            // first, so that the frame's audio is ready alongside it.
             if (p_PPU->m_FrameRenderedCallback != NULL)
             {
+                GABLE_SyncAPU(GABLE_GetAPU(p_Engine), p_Engine);
                 p_PPU->m_FrameRenderedCallback(p_Engine, p_PPU);
             }
         }
@@ -956,7 +1273,7 @@ void GABLE_TickHorizontalBlank (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine)
             // If its stat source is set, request the `LCD_STAT` interrupt.
             if (p_PPU->m_STAT.m_ObjectScanStatSource == true)
             {
-                GABLE_RequestInterrupt(p_Engine, GABLE_INT_LCD_STAT);
+                GABLE_RequestPPUInterrupt(p_Engine, GABLE_INT_LCD_STAT);
             }
         }
 
@@ -995,7 +1312,7 @@ void GABLE_TickVerticalBlank (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine)
             // If its stat source is set, request the `LCD_STAT` interrupt.
             if (p_PPU->m_STAT.m_ObjectScanStatSource == true)
             {
-                GABLE_RequestInterrupt(p_Engine, GABLE_INT_LCD_STAT);
+                GABLE_RequestPPUInterrupt(p_Engine, GABLE_INT_LCD_STAT);
             }
 
         }
@@ -1017,6 +1334,7 @@ void GABLE_TickObjectScan (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine)
     if (p_PPU->m_CurrentDot >= 80)
     {
         p_PPU->m_STAT.m_DisplayMode = GABLE_DM_PIXEL_TRANSFER;        
+        p_PPU->m_CountingFetcher = false;
 
         GABLE_PixelFetcher* l_Fetcher = &p_PPU->m_PixelFetcher;
         l_Fetcher->m_Mode = GABLE_PFM_TILE_NUMBER;
@@ -1024,6 +1342,14 @@ void GABLE_TickObjectScan (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine)
         l_Fetcher->m_QueueX = 0;
         l_Fetcher->m_LineX = 0;
         l_Fetcher->m_PushedX = 0;
+
+        // If the background cache is enabled, try to render this whole line from it right away.
+        // If that works, then the pixel fetcher isn't needed for this line. While threaded
+        // rendering is enabled, this is left to the render worker's shadow PPU.
+        p_PPU->m_LineFromCache =
+            p_PPU->m_Worker == NULL &&
+            p_PPU->m_BackgroundCache != NULL &&
+            GABLE_RenderCachedLine(p_PPU) == true;
     }
     else if (l_Dot % 2 == 0)
     {
@@ -1046,166 +1372,75 @@ void GABLE_TickPixelTransfer (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine)
     // the pixel transfer is complete. Move to the horizontal blank state.
     if (p_PPU->m_PixelFetcher.m_PushedX >= GABLE_PPU_SCREEN_WIDTH)
     {
-        
-        // Reset the pixel fetcher.
-        GABLE_ResetPixelFetcher(p_PPU, &p_PPU->m_PixelFetcher);
-
-        // Move to the horizontal blank state. If its stat source is set, request the `LCD_STAT`
-        // interrupt.
-        p_PPU->m_STAT.m_DisplayMode = GABLE_DM_HORIZONTAL_BLANK;
-        if (p_PPU->m_STAT.m_HorizontalBlankStatSource == true)
-        {
-            GABLE_RequestInterrupt(p_Engine, GABLE_INT_LCD_STAT);
-        }
-
-        // At the start of each H-Blank period, another block of HDMA data is transferred.
-        GABLE_TickHDMA(p_PPU, p_Engine);
-
+        GABLE_EnterHorizontalBlank(p_PPU, p_Engine);
     }
 
 }
 
-// Static Functions - HDMA Transfer ////////////////////////////////////////////////////////////////
-
-void GABLE_TickHDMA (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine)
-{
-    if (p_PPU->m_HDMABlocksLeft > 0)
-    {
-        // If the HDMA transfer is active, then decrement the number of blocks left to transfer.
-        p_PPU->m_HDMABlocksLeft--;
-
-        // Transfer the next block of data
-        for (Uint8 i = 0; i < 0x10; i++)
-        {
-            Uint8 l_Value = 0x00;
-            GABLE_ReadByte(p_Engine, p_PPU->m_HDMASource++, &l_Value);
-            GABLE_WriteVRAMByte(p_PPU, p_PPU->m_HDMADestination++, l_Value);
-        }
-    }
-}
-
-// Public Functions ////////////////////////////////////////////////////////////////////////////////
-
-GABLE_PPU* GABLE_CreatePPU ()
+Uint16 GABLE_GetPixelTransferLength (GABLE_PPU* p_PPU)
 {
 
-    // Allocate the PPU context.
-    GABLE_PPU* l_PPU = GABLE_calloc(1, GABLE_PPU);
-    GABLE_pexpect(l_PPU != NULL, "Failed to allocate PPU context");
-
-    // Initialize the PPU context.
-    GABLE_ResetPPU(l_PPU);
-
-    // Return the PPU context.
-    return l_PPU;
+    // The pixel fetcher never stalls - objects and the window are fetched alongside the background
+    // tiles - so the length of the pixel transfer only depends on how many pixels are discarded to
+    // the fine horizontal scroll: 216 dots if none are, and 218 dots plus that number otherwise.
+    Uint8 l_FineX = p_PPU->m_SCX & 0b111;
+    return (l_FineX == 0) ? 216 : 218 + l_FineX;
 
 }
 
-void GABLE_DestroyPPU (GABLE_PPU* p_PPU)
+void GABLE_TickTimedPixelTransfer (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine)
 {
 
-    if (p_PPU != NULL)
+    // While threaded rendering is enabled, the pixels are fetched by the render worker. Lines
+    // rendered from the background cache, and all lines in headless mode, aren't fetched at all.
+    // Either way, the length of the pixel transfer has to be worked out here instead.
+    //
+    // Increment the current dot. Once the pixel transfer's length has elapsed, move to the
+    // horizontal blank state.
+    p_PPU->m_CurrentDot++;
+    if (p_PPU->m_CurrentDot >= 80 + GABLE_GetPixelTransferLength(p_PPU))
     {
-        GABLE_free(p_PPU);
+        GABLE_EnterHorizontalBlank(p_PPU, p_Engine);
     }
 
 }
 
-void GABLE_ResetPPU (GABLE_PPU* p_PPU)
+void GABLE_EnterHorizontalBlank (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine)
 {
-    GABLE_expect(p_PPU, "PPU context is NULL!");
-    
-    // Reset the PPU structure's memory.
-    memset(p_PPU, 0, sizeof(GABLE_PPU));
-
-    // Also reset the pixel fetcher context's memory.
-    memset(&p_PPU->m_PixelFetcher, 0, sizeof(GABLE_PixelFetcher));
 
-    // Reset the PPU registers.
-    /* LCDC     = 0x91 */   p_PPU->m_LCDC.m_Register    = 0x91; // 0b10010001
-    /* STAT     = 0x85 */   p_PPU->m_STAT.m_Register    = 0x85; // 0b10000101
-    /* SCY      = 0x00 */   p_PPU->m_SCY                = 0x00;
-    /* SCX      = 0x00 */   p_PPU->m_SCX                = 0x00;
-    /* LY       = 0x00 */   p_PPU->m_LY                 = 0x00;
-    /* LYC      = 0x00 */   p_PPU->m_LYC                = 0x00;
-    /* BGP      = 0xFC */   p_PPU->m_BGP                = 0b00011011; // Color indices: 0, 1, 2, 3
-    /* OBP0     = 0xFF */   p_PPU->m_OBP0               = 0b00011011; // Color indices: 0, 1, 2, 3
-    /* OBP1     = 0xFF */   p_PPU->m_OBP1               = 0b00011011; // Color indices: 0, 1, 2, 3
-    /* WY       = 0x00 */   p_PPU->m_WY                 = 0x00;
-    /* WX       = 0x00 */   p_PPU->m_WX                 = 0x00;
-    /* DMA      = 0x00 */   p_PPU->m_DMA                = 0x00;
-    /* VBK      = 0x00 */   p_PPU->m_VBK                = 0x00;
-    /* HDMA1    = 0xFF */   p_PPU->m_HDMA1              = 0xFF;
-    /* HDMA2    = 0xFF */   p_PPU->m_HDMA2              = 0xFF;
-    /* HDMA3    = 0xFF */   p_PPU->m_HDMA3              = 0xFF;
-    /* HDMA4    = 0xFF */   p_PPU->m_HDMA4              = 0xFF;
-    /* HDMA5    = 0xFF */   p_PPU->m_HDMA5.m_Register   = 0xFF;
-    /* BGPI     = 0x00 */   p_PPU->m_BGPI.m_Register    = 0x00;
-    /* OBPI     = 0x00 */   p_PPU->m_OBPI.m_Register    = 0x00;
-    /* OPRI     = 0x00 */   p_PPU->m_OPRI               = 0x00;
-    /* GRPM     = 0x01 */   p_PPU->m_GRPM               = 0x01;
+    // Reset the pixel fetcher.
+    GABLE_ResetPixelFetcher(p_PPU, &p_PPU->m_PixelFetcher);
+    p_PPU->m_CountingFetcher = false;
 
-    // Prepare the color RAM buffers.
-    // Initialize each palette to a DMG style palette.
-    // - DMG Palette: White, Light Gray, Dark Gray, Black
-    for (Uint8 i = 0; i < GABLE_PPU_CRAM_SIZE; i += 8)
+    // Move to the horizontal blank state. If its stat source is set, request the `LCD_STAT`
+    // interrupt.
+    p_PPU->m_STAT.m_DisplayMode = GABLE_DM_HORIZONTAL_BLANK;
+    if (p_PPU->m_STAT.m_HorizontalBlankStatSource == true)
     {
-        p_PPU->m_BgCRAM[i + 0] = GABLE_PPU_DMG_PALETTE_RGB555[0];
-        p_PPU->m_BgCRAM[i + 1] = GABLE_PPU_DMG_PALETTE_RGB555[1];
-        p_PPU->m_BgCRAM[i + 2] = GABLE_PPU_DMG_PALETTE_RGB555[2];
-        p_PPU->m_BgCRAM[i + 3] = GABLE_PPU_DMG_PALETTE_RGB555[3];
-        p_PPU->m_BgCRAM[i + 4] = GABLE_PPU_DMG_PALETTE_RGB555[4];
-        p_PPU->m_BgCRAM[i + 5] = GABLE_PPU_DMG_PALETTE_RGB555[5];
-        p_PPU->m_BgCRAM[i + 6] = GABLE_PPU_DMG_PALETTE_RGB555[6];
-        p_PPU->m_BgCRAM[i + 7] = GABLE_PPU_DMG_PALETTE_RGB555[7];
-
-        p_PPU->m_ObjCRAM[i + 0] = GABLE_PPU_DMG_PALETTE_RGB555[0];
-        p_PPU->m_ObjCRAM[i + 1] = GABLE_PPU_DMG_PALETTE_RGB555[1];
-        p_PPU->m_ObjCRAM[i + 2] = GABLE_PPU_DMG_PALETTE_RGB555[2];
-        p_PPU->m_ObjCRAM[i + 3] = GABLE_PPU_DMG_PALETTE_RGB555[3];
-        p_PPU->m_ObjCRAM[i + 4] = GABLE_PPU_DMG_PALETTE_RGB555[4];
-        p_PPU->m_ObjCRAM[i + 5] = GABLE_PPU_DMG_PALETTE_RGB555[5];
-        p_PPU->m_ObjCRAM[i + 6] = GABLE_PPU_DMG_PALETTE_RGB555[6];
-        p_PPU->m_ObjCRAM[i + 7] = GABLE_PPU_DMG_PALETTE_RGB555[7];
+        GABLE_RequestPPUInterrupt(p_Engine, GABLE_INT_LCD_STAT);
     }
 
-    // Point the VRAM pointer to VRAM0.
-    p_PPU->m_VRAM = p_PPU->m_VRAM0;
+    // At the start of each H-Blank period, another block of HDMA data is transferred.
+    GABLE_TickHDMA(p_PPU, p_Engine);
 
-    // Reset the PPU's internal state.
-    p_PPU->m_CurrentDot = 0;
-    p_PPU->m_ODMATicks = 0xFF;
-    p_PPU->m_ODMADelay = 0;
-    p_PPU->m_ODMASource = 0;
-    p_PPU->m_ODMADestination = 0;
-    p_PPU->m_HDMABlocksLeft = 0;
-    p_PPU->m_HDMASource = 0;
-    p_PPU->m_HDMADestination = 0;
-    p_PPU->m_LineObjectCount = 0;
+    // The scanline is finished, so if the scanline rendered callback is provided, call it here. In
+    // headless mode, there's no scanline to hand over, and while threaded rendering is enabled, the
+    // scanline hasn't been drawn yet.
+    if (
+        p_PPU->m_ScanlineRenderedCallback != NULL &&
+        p_PPU->m_Headless == false &&
+        p_PPU->m_Worker == NULL
+    )
+    {
+        p_PPU->m_ScanlineRenderedCallback(p_Engine, p_PPU, p_PPU->m_LY,
+            &p_PPU->m_ScreenBuffer[p_PPU->m_LY * GABLE_PPU_SCREEN_WIDTH]);
+    }
 
-    // Reset the PPU's display mode and pixel fetch mode.
-    p_PPU->m_STAT.m_DisplayMode = GABLE_DM_OBJECT_SCAN;
-    p_PPU->m_PixelFetcher.m_Mode = GABLE_PFM_TILE_NUMBER;
 }
 
-void GABLE_TickPPU (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine)
+void GABLE_TickDisplayMode (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine)
 {
 
-    GABLE_expect(p_PPU, "PPU context is NULL!");
-    GABLE_expect(p_Engine, "Engine context is NULL!");
-
-    // Don't tick the PPU if the display is off, but still call the frame-rendered callback if
-    // one is provided.
-    if (p_PPU->m_LCDC.m_DisplayEnable == false)
-    {
-        if (p_PPU->m_FrameRenderedCallback != NULL)
-        {
-            p_PPU->m_FrameRenderedCallback(p_Engine, p_PPU);
-        }
-
-        return;
-    }
-    
     // Run the appropriate PPU state machine based on the current PPU display mode.
     switch (p_PPU->m_STAT.m_DisplayMode)
     {
@@ -1223,61 +1458,1353 @@ void GABLE_TickPPU (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine)
             break;
         case GABLE_DM_PIXEL_TRANSFER:   
             // GABLE_debug("Line: %u | Dot: %u | Mode: PIXEL_TRANSFER", p_PPU->m_LY, p_PPU->m_CurrentDot);
-            GABLE_TickPixelTransfer(p_PPU, p_Engine); 
+            if (p_PPU->m_CountingFetcher == true)
+            {
+                GABLE_TickCountedPixelTransfer(p_PPU, p_Engine);
+            }
+            else if (p_PPU->m_Worker != NULL || p_PPU->m_LineFromCache == true)
+            {
+                GABLE_TickTimedPixelTransfer(p_PPU, p_Engine);
+            }
+            else
+            {
+                GABLE_TickPixelTransfer(p_PPU, p_Engine);
+            }
             break;
     }
 
 }
 
-void GABLE_TickODMA (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine)
+void GABLE_ScheduleModeBoundary (GABLE_PPU* p_PPU)
 {
 
-    GABLE_expect(p_PPU, "PPU context is NULL!");
-    GABLE_expect(p_Engine, "Engine context is NULL!");
-
-    // Check to see if the DMA transfer is active.
-    if (p_PPU->m_ODMATicks >= 0xA0)
-    {
-        return;
-    }
-
-    // If the ODMA transfer has been initiated, check to see if there is a delay still before
-    // actually starting the transfer.
-    if (p_PPU->m_ODMADelay > 0)
+    // Work out the dot at which the current display mode ends.
+    switch (p_PPU->m_STAT.m_DisplayMode)
     {
-        p_PPU->m_ODMADelay--;
-        return;
+        case GABLE_DM_OBJECT_SCAN:
+            p_PPU->m_NextModeDot = 80;
+            break;
+        case GABLE_DM_PIXEL_TRANSFER:
+            p_PPU->m_NextModeDot = (p_PPU->m_CountingFetcher == true) ?
+                0 : 80 + GABLE_GetPixelTransferLength(p_PPU);
+            break;
+        default:
+            p_PPU->m_NextModeDot = 456;
+            break;
     }
 
-    // If the ODMA transfer is active, then transfer the next byte of data.
-    Uint8 l_Value = 0x00;
-    GABLE_ReadByte(p_Engine, p_PPU->m_ODMASource + p_PPU->m_ODMATicks, &l_Value);
-    GABLE_WriteOAMByte(p_PPU, p_PPU->m_ODMADestination + p_PPU->m_ODMATicks, l_Value);
-
-    // Increment the number of ticks.
-    p_PPU->m_ODMATicks++;
-
 }
 
-// Public Functions - Memory Access ////////////////////////////////////////////////////////////////
-
-Bool GABLE_ReadVRAMByte (const GABLE_PPU* p_PPU, Uint16 p_Address, Uint8* p_Value)
+void GABLE_TickPixelFetcherTiming (GABLE_PPU* p_PPU, GABLE_PixelFetcher* p_Fetcher, Uint16 p_Dot)
 {
 
-    GABLE_expect(p_PPU, "PPU context is NULL!");
-    GABLE_expect(p_Value, "Value pointer is NULL!");
-
-    // If, for some reason, the VRAM pointer is NULL, return `false`.
-    if (p_PPU->m_VRAM == NULL)
+    // Step through the pixel fetcher's states in the same manner as `GABLE_TickPixelFetcher`, but
+    // only keep count of the pixels passing through the FIFO, rather than fetching them.
+    if (p_Dot % 2 == 0)
     {
-        GABLE_error("Current VRAM bank pointer is NULL. Write to 'VBK' register to correct this.");
-        return false;
-    }
-    
-    // If a relative address (`0x0000` to `0x1FFF`) is provided, then it can be assumed that VRAM is
-    // being accessed from GABLE's address bus. If the PPU is currently transferring pixels to the
-    // screen buffer (i.e., in the pixel transfer state), then the VRAM buffer is locked and cannot be
-    // accessed. In this case, the byte returned is `0xFF`.
+        switch (p_Fetcher->m_Mode)
+        {
+            case GABLE_PFM_TILE_NUMBER:
+                p_Fetcher->m_FetchingX += 8;
+                p_Fetcher->m_Mode = GABLE_PFM_TILE_DATA_LOW;
+                break;
+            case GABLE_PFM_TILE_DATA_LOW:
+                p_Fetcher->m_Mode = GABLE_PFM_TILE_DATA_HIGH;
+                break;
+            case GABLE_PFM_TILE_DATA_HIGH:
+                p_Fetcher->m_Mode = GABLE_PFM_SLEEP;
+                break;
+            case GABLE_PFM_SLEEP:
+                p_Fetcher->m_Mode = GABLE_PFM_PUSH_PIXELS;
+                break;
+            case GABLE_PFM_PUSH_PIXELS:
+                if (p_Fetcher->m_PixelFIFO.m_Size <= 8)
+                {
+                    if ((Int32) p_Fetcher->m_FetchingX - (8 - (p_PPU->m_SCX % 8)) >= 0)
+                    {
+                        p_Fetcher->m_PixelFIFO.m_Tail = (p_Fetcher->m_PixelFIFO.m_Tail + 8) % GABLE_PPU_PIXEL_FIFO_SIZE;
+                        p_Fetcher->m_PixelFIFO.m_Size += 8;
+                        p_Fetcher->m_QueueX += 8;
+                    }
+
+                    p_Fetcher->m_Mode = GABLE_PFM_TILE_NUMBER;
+                }
+                break;
+        }
+    }
+
+    if (p_Fetcher->m_PixelFIFO.m_Size > 8)
+    {
+        p_Fetcher->m_PixelFIFO.m_Head = (p_Fetcher->m_PixelFIFO.m_Head + 1) % GABLE_PPU_PIXEL_FIFO_SIZE;
+        p_Fetcher->m_PixelFIFO.m_Size--;
+        if (p_Fetcher->m_LineX >= (p_PPU->m_SCX % 8))
+        {
+            p_Fetcher->m_PushedX++;
+        }
+
+        p_Fetcher->m_LineX++;
+    }
+
+}
+
+void GABLE_CatchUpPixelFetcher (GABLE_PPU* p_PPU)
+{
+
+    // Headless mode and threaded rendering skip the pixel fetcher, so step it through every dot of
+    // the pixel transfer so far, then keep on stepping it through the rest. The fine horizontal
+    // scroll can't have changed up until now, or this would already have been done.
+    GABLE_PixelFetcher* l_Fetcher = &p_PPU->m_PixelFetcher;
+    GABLE_ResetPixelFetcher(p_PPU, l_Fetcher);
+    l_Fetcher->m_Mode = GABLE_PFM_TILE_NUMBER;
+    l_Fetcher->m_FetchingX = 0;
+    l_Fetcher->m_QueueX = 0;
+    l_Fetcher->m_LineX = 0;
+    l_Fetcher->m_PushedX = 0;
+
+    for (Uint16 l_Dot = 80; l_Dot < p_PPU->m_CurrentDot; ++l_Dot)
+    {
+        GABLE_TickPixelFetcherTiming(p_PPU, l_Fetcher, l_Dot);
+    }
+
+    p_PPU->m_CountingFetcher = true;
+
+}
+
+void GABLE_TickCountedPixelTransfer (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine)
+{
+
+    // Step the pixel fetcher through the current dot, and once it has pushed out a whole line's
+    // worth of pixels, move to the horizontal blank state.
+    GABLE_TickPixelFetcherTiming(p_PPU, &p_PPU->m_PixelFetcher, p_PPU->m_CurrentDot);
+    p_PPU->m_CurrentDot++;
+    if (p_PPU->m_PixelFetcher.m_PushedX >= GABLE_PPU_SCREEN_WIDTH)
+    {
+        GABLE_EnterHorizontalBlank(p_PPU, p_Engine);
+    }
+
+}
+
+void GABLE_TickHeadlessPPU (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine)
+{
+
+    // In headless mode, nothing happens in between mode boundaries besides counting the dot.
+    if (p_PPU->m_CurrentDot + 1 < p_PPU->m_NextModeDot)
+    {
+        p_PPU->m_CurrentDot++;
+        return;
+    }
+
+    // On the last dot of the current mode, run the state machine as usual, except that the object
+    // scan and pixel transfer are skipped over, since they only matter for drawing the scanline.
+    switch (p_PPU->m_STAT.m_DisplayMode)
+    {
+        case GABLE_DM_HORIZONTAL_BLANK:
+            GABLE_TickHorizontalBlank(p_PPU, p_Engine);
+            break;
+        case GABLE_DM_VERTICAL_BLANK:
+            GABLE_TickVerticalBlank(p_PPU, p_Engine);
+            break;
+        case GABLE_DM_OBJECT_SCAN:
+            p_PPU->m_CurrentDot++;
+            p_PPU->m_STAT.m_DisplayMode = GABLE_DM_PIXEL_TRANSFER;
+            p_PPU->m_CountingFetcher = false;
+            break;
+        case GABLE_DM_PIXEL_TRANSFER:
+            if (p_PPU->m_CountingFetcher == true)
+            {
+                GABLE_TickCountedPixelTransfer(p_PPU, p_Engine);
+            }
+            else
+            {
+                GABLE_TickTimedPixelTransfer(p_PPU, p_Engine);
+            }
+            break;
+    }
+
+    // Then, work out where the next mode boundary is.
+    GABLE_ScheduleModeBoundary(p_PPU);
+
+}
+
+// Static Functions - Line Table ///////////////////////////////////////////////////////////////////
+
+void GABLE_ApplyLineTable (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine)
+{
+
+    // Each entry holds one byte for each register selected in the `LTC` register.
+    Uint8 l_EntrySize = 0;
+    for (Uint8 i = 0; i < 5; ++i)
+    {
+        l_EntrySize += GABLE_bit(p_PPU->m_LTC.m_Register, i);
+    }
+
+    if (l_EntrySize == 0)
+    {
+        return;
+    }
+
+    // Resolve the current scanline's entry once, and copy it out of the memory map.
+    Uint8 l_Entry[5];
+    Uint16 l_Address = ((p_PPU->m_LTAH << 8) | p_PPU->m_LTAL) + (p_PPU->m_LY * l_EntrySize);
+    if (GABLE_ReadBlock(p_Engine, l_Address, l_Entry, l_EntrySize) == false)
+    {
+        return;
+    }
+
+    // Write each value in the entry to its register, in order. Values which haven't changed since
+    // the last scanline are skipped, so that (for instance) an unchanging `BGP` value doesn't
+    // invalidate the whole background cache on every scanline.
+    const Uint8* l_Value = l_Entry;
+    if (p_PPU->m_LTC.m_SCYEntry == 1)
+    {
+        if (*l_Value != p_PPU->m_SCY) { GABLE_WriteSCY(p_PPU, *l_Value); }
+        l_Value++;
+    }
+    if (p_PPU->m_LTC.m_SCXEntry == 1)
+    {
+        if (*l_Value != p_PPU->m_SCX) { GABLE_WriteSCX(p_PPU, *l_Value); }
+        l_Value++;
+    }
+    if (p_PPU->m_LTC.m_WYEntry == 1)
+    {
+        if (*l_Value != p_PPU->m_WY) { GABLE_WriteWY(p_PPU, *l_Value); }
+        l_Value++;
+    }
+    if (p_PPU->m_LTC.m_WXEntry == 1)
+    {
+        if (*l_Value != p_PPU->m_WX) { GABLE_WriteWX(p_PPU, *l_Value); }
+        l_Value++;
+    }
+    if (p_PPU->m_LTC.m_BGPEntry == 1)
+    {
+        if (*l_Value != p_PPU->m_BGP) { GABLE_WriteBGP(p_PPU, *l_Value); }
+        l_Value++;
+    }
+
+}
+
+// Static Functions - Tile Animation ///////////////////////////////////////////////////////////////
+
+void GABLE_CopyTileAnimationFrame (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine, const GABLE_TileAnimation* p_Animation)
+{
+
+    // Copy the frame straight from the data store into the VRAM bank.
+    Uint8* l_VRAM = (p_Animation->m_VRAMBank == 0) ? p_PPU->m_VRAM0 : p_PPU->m_VRAM1;
+    Uint16 l_Offset = p_Animation->m_FirstTile * 16;
+    Uint16 l_Length = p_Animation->m_TileCount * 16;
+    Uint16 l_Source = p_Animation->m_SourceOffset + (p_Animation->m_CurrentFrame * l_Length);
+    if (
+        GABLE_ReadDataStoreBankBlock(GABLE_GetDataStore(p_Engine), p_Animation->m_SourceBank, l_Source,
+            &l_VRAM[l_Offset], l_Length) == false
+    )
+    {
+        return;
+    }
+
+    // Let the background cache and the render worker know about the new tile data, in the same
+    // manner as for any other write to VRAM.
+    if (p_PPU->m_BackgroundCache != NULL)
+    {
+        for (Uint16 i = 0; i < l_Length; i += 16)
+        {
+            GABLE_InvalidateBackgroundCache(p_PPU, p_Animation->m_VRAMBank, l_Offset + i);
+        }
+    }
+
+    if (p_PPU->m_Worker != NULL)
+    {
+        for (Uint16 i = 0; i < l_Length; ++i)
+        {
+            GABLE_LogPPUWrite(p_PPU, (p_Animation->m_VRAMBank == 0) ? GABLE_PWT_VRAM0 : GABLE_PWT_VRAM1,
+                l_Offset + i, l_VRAM[l_Offset + i]);
+        }
+    }
+
+}
+
+void GABLE_TickTileAnimations (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine)
+{
+
+    for (Uint8 i = 0; i < GABLE_PPU_TILE_ANIMATION_SLOT_COUNT; ++i)
+    {
+        GABLE_TileAnimation* l_Animation = &p_PPU->m_TileAnimations[i];
+        if (l_Animation->m_Active == false || l_Animation->m_FrameCount < 2)
+        {
+            continue;
+        }
+
+        // Once the current frame has been shown for its full period, move on to the next frame.
+        if (--l_Animation->m_FramesLeft == 0)
+        {
+            l_Animation->m_FramesLeft = l_Animation->m_FramePeriod;
+            l_Animation->m_CurrentFrame = (l_Animation->m_CurrentFrame + 1) % l_Animation->m_FrameCount;
+            GABLE_CopyTileAnimationFrame(p_PPU, p_Engine, l_Animation);
+        }
+    }
+
+}
+
+// Static Functions - Map Streamer /////////////////////////////////////////////////////////////////
+
+void GABLE_StreamMapRegion (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine, Uint16 p_X, Uint16 p_Y, Uint16 p_Width, Uint16 p_Height)
+{
+
+    const GABLE_MapStreamer* l_Streamer = &p_PPU->m_MapStreamer;
+    const GABLE_DataStore* l_DataStore = GABLE_GetDataStore(p_Engine);
+    Uint16 l_Tilemap = (GABLE_GB_SCRN0_START - GABLE_GB_VRAM_START) + (l_Streamer->m_Tilemap * GABLE_PPU_VRAM_TILEMAP_SIZE);
+
+    // Clip the region to the map's bounds.
+    if (p_X >= l_Streamer->m_Width || p_Y >= l_Streamer->m_Height)
+    {
+        return;
+    }
+
+    if (p_X + p_Width > l_Streamer->m_Width)
+    {
+        p_Width = l_Streamer->m_Width - p_X;
+    }
+
+    if (p_Y + p_Height > l_Streamer->m_Height)
+    {
+        p_Height = l_Streamer->m_Height - p_Y;
+    }
+
+    for (Uint16 y = p_Y; y < p_Y + p_Height; ++y)
+    {
+
+        // Each row of the region is contiguous in the map, but may wrap around the right edge of
+        // the tilemap, in which case it is copied in two pieces.
+        Uint16 x = p_X;
+        while (x < p_X + p_Width)
+        {
+            Uint16 l_Column = x % 32;
+            Uint16 l_Length = 32 - l_Column;
+            if (l_Length > (p_X + p_Width) - x)
+            {
+                l_Length = (p_X + p_Width) - x;
+            }
+
+            Uint16 l_Cell = l_Tilemap + ((y % 32) * 32) + l_Column;
+            Uint16 l_Source = (y * l_Streamer->m_Width) + x;
+            GABLE_ReadDataStoreBankBlock(l_DataStore, l_Streamer->m_TileBank, l_Streamer->m_TileOffset + l_Source,
+                &p_PPU->m_VRAM0[l_Cell], l_Length);
+            if (l_Streamer->m_HasAttributes == true)
+            {
+                GABLE_ReadDataStoreBankBlock(l_DataStore, l_Streamer->m_AttributeBank, l_Streamer->m_AttributeOffset + l_Source,
+                    &p_PPU->m_VRAM1[l_Cell], l_Length);
+            }
+
+            // Let the background cache and the render worker know about the new cells, in the same
+            // manner as for any other write to VRAM.
+            if (p_PPU->m_BackgroundCache != NULL || p_PPU->m_Worker != NULL)
+            {
+                for (Uint16 i = l_Cell; i < l_Cell + l_Length; ++i)
+                {
+                    GABLE_InvalidateBackgroundCache(p_PPU, 0, i);
+                    if (p_PPU->m_Worker != NULL)
+                    {
+                        GABLE_LogPPUWrite(p_PPU, GABLE_PWT_VRAM0, i, p_PPU->m_VRAM0[i]);
+                        if (l_Streamer->m_HasAttributes == true)
+                        {
+                            GABLE_LogPPUWrite(p_PPU, GABLE_PWT_VRAM1, i, p_PPU->m_VRAM1[i]);
+                        }
+                    }
+                }
+            }
+
+            x += l_Length;
+        }
+
+    }
+
+}
+
+void GABLE_TickMapStreamer (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine)
+{
+
+    GABLE_MapStreamer* l_Streamer = &p_PPU->m_MapStreamer;
+
+    // Work out which tile of the map is now in the screen's top-left corner.
+    Uint16 l_X = l_Streamer->m_CameraX / 8;
+    Uint16 l_Y = l_Streamer->m_CameraY / 8;
+
+    // If nothing has been streamed in yet, or the camera has moved so far that none of the tiles
+    // streamed in last time can still be seen, then stream in the whole visible region.
+    if (
+        l_Streamer->m_Streamed == false ||
+        abs(l_X - l_Streamer->m_StreamedX) >= GABLE_PPU_LINE_TILE_SPAN ||
+        abs(l_Y - l_Streamer->m_StreamedY) >= GABLE_PPU_FRAME_TILE_SPAN
+    )
+    {
+        GABLE_StreamMapRegion(p_PPU, p_Engine, l_X, l_Y, GABLE_PPU_LINE_TILE_SPAN, GABLE_PPU_FRAME_TILE_SPAN);
+    }
+
+    // Otherwise, only stream in the columns and rows which have come into view.
+    else
+    {
+        if (l_X > l_Streamer->m_StreamedX)
+        {
+            GABLE_StreamMapRegion(p_PPU, p_Engine, l_Streamer->m_StreamedX + GABLE_PPU_LINE_TILE_SPAN, l_Y,
+                l_X - l_Streamer->m_StreamedX, GABLE_PPU_FRAME_TILE_SPAN);
+        }
+        else if (l_X < l_Streamer->m_StreamedX)
+        {
+            GABLE_StreamMapRegion(p_PPU, p_Engine, l_X, l_Y, l_Streamer->m_StreamedX - l_X, GABLE_PPU_FRAME_TILE_SPAN);
+        }
+
+        if (l_Y > l_Streamer->m_StreamedY)
+        {
+            GABLE_StreamMapRegion(p_PPU, p_Engine, l_X, l_Streamer->m_StreamedY + GABLE_PPU_FRAME_TILE_SPAN,
+                GABLE_PPU_LINE_TILE_SPAN, l_Y - l_Streamer->m_StreamedY);
+        }
+        else if (l_Y < l_Streamer->m_StreamedY)
+        {
+            GABLE_StreamMapRegion(p_PPU, p_Engine, l_X, l_Y, GABLE_PPU_LINE_TILE_SPAN, l_Streamer->m_StreamedY - l_Y);
+        }
+    }
+
+    l_Streamer->m_StreamedX = l_X;
+    l_Streamer->m_StreamedY = l_Y;
+    l_Streamer->m_Streamed = true;
+
+    // Scroll the background to the camera, so that the new tiles and the new scroll position take
+    // effect on the same frame.
+    if (p_PPU->m_SCX != (l_Streamer->m_CameraX & 0xFF))
+    {
+        GABLE_WriteSCX(p_PPU, l_Streamer->m_CameraX & 0xFF);
+    }
+
+    if (p_PPU->m_SCY != (l_Streamer->m_CameraY & 0xFF))
+    {
+        GABLE_WriteSCY(p_PPU, l_Streamer->m_CameraY & 0xFF);
+    }
+
+}
+
+// Static Functions - Palettes /////////////////////////////////////////////////////////////////////
+
+void GABLE_StoreCRAM (GABLE_PPU* p_PPU, Bool p_Object, Uint8 p_Index, const Uint8* p_Data, Size p_Length)
+{
+
+    // Copy the data into the color RAM buffer in one go, then let the background cache and the
+    // render worker know about it, in the same manner as for writes through `BGPD` and `OBPD`.
+    Uint8* l_CRAM = (p_Object == true) ? p_PPU->m_ObjCRAM : p_PPU->m_BgCRAM;
+    memcpy(&l_CRAM[p_Index], p_Data, p_Length);
+
+    if (p_Object == false)
+    {
+        GABLE_InvalidateWholeBackgroundCache(p_PPU);
+    }
+
+    if (p_PPU->m_Worker != NULL)
+    {
+        for (Size i = 0; i < p_Length; ++i)
+        {
+            GABLE_LogPPUWrite(p_PPU, (p_Object == true) ? GABLE_PWT_OBJ_CRAM : GABLE_PWT_BG_CRAM, p_Index + i, p_Data[i]);
+        }
+    }
+
+}
+
+void GABLE_TickPaletteFade (GABLE_PPU* p_PPU)
+{
+
+    GABLE_PaletteFade* l_Fade = &p_PPU->m_PaletteFade;
+    l_Fade->m_Frame++;
+
+    // On the fade's last frame, the target palettes are written exactly as they were given.
+    if (l_Fade->m_Frame >= l_Fade->m_FrameCount)
+    {
+        GABLE_StoreCRAM(p_PPU, false, 0, l_Fade->m_Target[0], GABLE_PPU_CRAM_SIZE);
+        GABLE_StoreCRAM(p_PPU, true, 0, l_Fade->m_Target[1], GABLE_PPU_CRAM_SIZE);
+        l_Fade->m_Active = false;
+        return;
+    }
+
+    // Interpolate each channel of each color between its source and target values. Remember that
+    // the color data is laid out as follows: `0bRRRRRGGG` `0bGGBBBBB0`
+    Uint8 l_CRAM[2][GABLE_PPU_CRAM_SIZE];
+    for (Uint8 l_Set = 0; l_Set < 2; ++l_Set)
+    {
+        for (Uint8 i = 0; i < GABLE_PPU_CRAM_SIZE; i += 2)
+        {
+            const Uint8* l_From = &l_Fade->m_Source[l_Set][i];
+            const Uint8* l_To = &l_Fade->m_Target[l_Set][i];
+            Int32 l_Channels[3][2] =
+            {
+                { (l_From[0] & 0b11111000) >> 3, (l_To[0] & 0b11111000) >> 3 },
+                { ((l_From[0] & 0b00000111) << 2) | ((l_From[1] & 0b11000000) >> 6),
+                  ((l_To[0] & 0b00000111) << 2) | ((l_To[1] & 0b11000000) >> 6) },
+                { (l_From[1] & 0b00111110) >> 1, (l_To[1] & 0b00111110) >> 1 }
+            };
+
+            Uint8 l_Mixed[3];
+            for (Uint8 c = 0; c < 3; ++c)
+            {
+                l_Mixed[c] = l_Channels[c][0] +
+                    ((l_Channels[c][1] - l_Channels[c][0]) * l_Fade->m_Frame) / l_Fade->m_FrameCount;
+            }
+
+            l_CRAM[l_Set][i] = (l_Mixed[0] << 3) | (l_Mixed[1] >> 2);
+            l_CRAM[l_Set][i + 1] = ((l_Mixed[1] & 0b11) << 6) | (l_Mixed[2] << 1);
+        }
+    }
+
+    GABLE_StoreCRAM(p_PPU, false, 0, l_CRAM[0], GABLE_PPU_CRAM_SIZE);
+    GABLE_StoreCRAM(p_PPU, true, 0, l_CRAM[1], GABLE_PPU_CRAM_SIZE);
+
+}
+
+// Static Functions - HDMA Transfer ////////////////////////////////////////////////////////////////
+
+void GABLE_TickHDMA (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine)
+{
+    if (p_PPU->m_HDMABlocksLeft > 0)
+    {
+        // If the HDMA transfer is active, then decrement the number of blocks left to transfer.
+        p_PPU->m_HDMABlocksLeft--;
+
+        // Resolve the source region once, and copy the next block of data out of it.
+        Uint8 l_Block[0x10];
+        GABLE_ReadBlock(p_Engine, p_PPU->m_HDMASource, l_Block, sizeof(l_Block));
+
+        // If the destination block lies entirely within VRAM, then copy the block straight into the
+        // current VRAM bank. Otherwise, write it a byte at a time, so that destinations outside of
+        // VRAM are handled in the same way as single-byte writes.
+        Uint16 l_Destination = p_PPU->m_HDMADestination;
+        if (
+            p_PPU->m_VRAM != NULL &&
+            l_Destination >= GABLE_GB_VRAM_START &&
+            l_Destination + sizeof(l_Block) - 1 <= GABLE_GB_VRAM_END
+        )
+        {
+            Uint16 l_Offset = l_Destination - GABLE_GB_VRAM_START;
+            memcpy(&p_PPU->m_VRAM[l_Offset], l_Block, sizeof(l_Block));
+
+            if (p_PPU->m_BackgroundCache != NULL || p_PPU->m_Worker != NULL)
+            {
+                for (Uint16 i = 0; i < sizeof(l_Block); ++i)
+                {
+                    GABLE_InvalidateBackgroundCache(p_PPU, (p_PPU->m_VRAM == p_PPU->m_VRAM1), l_Offset + i);
+                    if (p_PPU->m_Worker != NULL)
+                    {
+                        GABLE_LogPPUWrite(p_PPU, (p_PPU->m_VRAM == p_PPU->m_VRAM0) ? GABLE_PWT_VRAM0 : GABLE_PWT_VRAM1,
+                            l_Offset + i, l_Block[i]);
+                    }
+                }
+            }
+        }
+        else
+        {
+            for (Uint16 i = 0; i < sizeof(l_Block); ++i)
+            {
+                GABLE_WriteVRAMByte(p_PPU, l_Destination + i, l_Block[i]);
+            }
+        }
+
+        p_PPU->m_HDMASource += sizeof(l_Block);
+        p_PPU->m_HDMADestination += sizeof(l_Block);
+
+        // While the transfer is active, `HDMA5` holds the number of blocks left to transfer, minus
+        // one, with bit 7 clear. Once the transfer is complete, `HDMA5` reads `0xFF`.
+        p_PPU->m_HDMA5.m_Register = (p_PPU->m_HDMABlocksLeft > 0) ? (p_PPU->m_HDMABlocksLeft - 1) : 0xFF;
+    }
+}
+
+// Static Functions - Threaded Rendering ///////////////////////////////////////////////////////////
+
+void GABLE_LogPPUWrite (GABLE_PPU* p_PPU, GABLE_PPUWriteTarget p_Target, Uint16 p_Address, Uint8 p_Value)
+{
+
+    GABLE_PPUWorker* l_Worker = p_PPU->m_Worker;
+    Uint64 l_Tail = atomic_load_explicit(&l_Worker->m_LogTail, memory_order_relaxed);
+
+    // If the write log is full, then wait for the render worker to replay some of it.
+    while (l_Tail - atomic_load_explicit(&l_Worker->m_LogHead, memory_order_acquire) >= GABLE_PPU_WRITE_LOG_SIZE)
+    {
+        GABLE_WakePPUWorker(l_Worker);
+        sched_yield();
+    }
+
+    // Record the write, tagged with the current dot, then publish it to the render worker.
+    GABLE_PPUWrite* l_Write = &l_Worker->m_Log[l_Tail & (GABLE_PPU_WRITE_LOG_SIZE - 1)];
+    l_Write->m_Dot = l_Worker->m_Dots;
+    l_Write->m_Address = p_Address;
+    l_Write->m_Target = p_Target;
+    l_Write->m_Value = p_Value;
+    atomic_store_explicit(&l_Worker->m_LogTail, l_Tail + 1, memory_order_release);
+
+}
+
+void GABLE_ReplayPPUWrite (GABLE_PPU* p_Shadow, const GABLE_PPUWrite* p_Write)
+{
+
+    // Writes to memory were already checked against the engine PPU's access rules when they were
+    // recorded, so they are applied directly here.
+    switch (p_Write->m_Target)
+    {
+        case GABLE_PWT_VRAM0:
+            p_Shadow->m_VRAM0[p_Write->m_Address] = p_Write->m_Value;
+            GABLE_InvalidateBackgroundCache(p_Shadow, 0, p_Write->m_Address);
+            break;
+        case GABLE_PWT_VRAM1:
+            p_Shadow->m_VRAM1[p_Write->m_Address] = p_Write->m_Value;
+            GABLE_InvalidateBackgroundCache(p_Shadow, 1, p_Write->m_Address);
+            break;
+        case GABLE_PWT_OAM:
+            ((Uint8*) p_Shadow->m_OAM)[p_Write->m_Address] = p_Write->m_Value;
+            break;
+        case GABLE_PWT_BG_CRAM:
+            p_Shadow->m_BgCRAM[p_Write->m_Address] = p_Write->m_Value;
+            GABLE_InvalidateWholeBackgroundCache(p_Shadow);
+            break;
+        case GABLE_PWT_OBJ_CRAM:
+            p_Shadow->m_ObjCRAM[p_Write->m_Address] = p_Write->m_Value;
+            break;
+        case GABLE_PWT_REGISTER:
+            switch (p_Write->m_Address)
+            {
+                case G_LCDC:    GABLE_ApplyLCDC(p_Shadow, p_Write->m_Value); break;
+                case G_SCY:     GABLE_WriteSCY(p_Shadow, p_Write->m_Value); break;
+                case G_SCX:     GABLE_WriteSCX(p_Shadow, p_Write->m_Value); break;
+                case G_BGP:     GABLE_WriteBGP(p_Shadow, p_Write->m_Value); break;
+                case G_OBP0:    GABLE_WriteOBP0(p_Shadow, p_Write->m_Value); break;
+                case G_OBP1:    GABLE_WriteOBP1(p_Shadow, p_Write->m_Value); break;
+                case G_WY:      GABLE_WriteWY(p_Shadow, p_Write->m_Value); break;
+                case G_WX:      GABLE_WriteWX(p_Shadow, p_Write->m_Value); break;
+                case G_VBK:     GABLE_WriteVBK(p_Shadow, p_Write->m_Value); break;
+                case G_OPRI:    GABLE_WriteOPRI(p_Shadow, p_Write->m_Value); break;
+                case G_GRPM:    GABLE_WriteGRPM(p_Shadow, p_Write->m_Value); break;
+            }
+            break;
+    }
+
+}
+
+void GABLE_WakePPUWorker (GABLE_PPUWorker* p_Worker)
+{
+
+    // Make sure the render worker sees the latest published dot before checking whether it is
+    // asleep. Otherwise, it could fall asleep having missed the update.
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load(&p_Worker->m_Sleeping) == true)
+    {
+        pthread_mutex_lock(&p_Worker->m_Mutex);
+        pthread_cond_signal(&p_Worker->m_WakeCondition);
+        pthread_mutex_unlock(&p_Worker->m_Mutex);
+    }
+
+}
+
+void GABLE_SyncPPUWorker (GABLE_PPU* p_PPU)
+{
+
+    GABLE_PPUWorker* l_Worker = p_PPU->m_Worker;
+
+    // Wait for the render worker's shadow PPU to catch up with this PPU.
+    GABLE_WakePPUWorker(l_Worker);
+    while (atomic_load_explicit(&l_Worker->m_RenderedDots, memory_order_acquire) < l_Worker->m_Dots)
+    {
+        sched_yield();
+    }
+
+    // The render worker can't tick any further until this PPU does, so its screen buffer can be
+    // copied safely.
+    memcpy(p_PPU->m_ScreenBuffer, l_Worker->m_Shadow->m_ScreenBuffer, sizeof(p_PPU->m_ScreenBuffer));
+
+}
+
+void* GABLE_PPUWorkerMain (void* p_Argument)
+{
+
+    GABLE_PPUWorker* l_Worker = (GABLE_PPUWorker*) p_Argument;
+    GABLE_PPU* l_Shadow = l_Worker->m_Shadow;
+    Uint64 l_RenderedDots = 0;
+    Uint64 l_Head = 0;
+    Count l_IdleSpins = 0;
+
+    while (atomic_load(&l_Worker->m_Stopping) == false)
+    {
+        // Check how far the engine's PPU has gotten.
+        Uint64 l_PublishedDots = atomic_load_explicit(&l_Worker->m_PublishedDots, memory_order_acquire);
+        if (l_RenderedDots >= l_PublishedDots)
+        {
+            // If the shadow PPU has caught up, then yield for a little while, then go to sleep
+            // until the engine's thread wakes us up.
+            if (++l_IdleSpins < GABLE_PPU_WORKER_IDLE_SPINS)
+            {
+                sched_yield();
+                continue;
+            }
+
+            pthread_mutex_lock(&l_Worker->m_Mutex);
+            atomic_store(&l_Worker->m_Sleeping, true);
+            while (
+                atomic_load(&l_Worker->m_PublishedDots) <= l_RenderedDots &&
+                atomic_load(&l_Worker->m_Stopping) == false
+            )
+            {
+                pthread_cond_wait(&l_Worker->m_WakeCondition, &l_Worker->m_Mutex);
+            }
+            atomic_store(&l_Worker->m_Sleeping, false);
+            pthread_mutex_unlock(&l_Worker->m_Mutex);
+
+            l_IdleSpins = 0;
+            continue;
+        }
+
+        // Every write made before the published dot has already been recorded, so take a snapshot
+        // of the write log's tail, then tick the shadow PPU up to the published dot, replaying each
+        // write just before the dot which followed it.
+        Uint64 l_Tail = atomic_load_explicit(&l_Worker->m_LogTail, memory_order_acquire);
+        while (l_RenderedDots < l_PublishedDots)
+        {
+            while (l_Head < l_Tail)
+            {
+                const GABLE_PPUWrite* l_Write = &l_Worker->m_Log[l_Head & (GABLE_PPU_WRITE_LOG_SIZE - 1)];
+                if (l_Write->m_Dot > l_RenderedDots)
+                {
+                    break;
+                }
+
+                GABLE_ReplayPPUWrite(l_Shadow, l_Write);
+                l_Head++;
+            }
+
+            if (l_Shadow->m_LCDC.m_DisplayEnable == true)
+            {
+                GABLE_TickDisplayMode(l_Shadow, NULL);
+            }
+
+            l_RenderedDots++;
+        }
+
+        atomic_store_explicit(&l_Worker->m_LogHead, l_Head, memory_order_release);
+        atomic_store_explicit(&l_Worker->m_RenderedDots, l_RenderedDots, memory_order_release);
+        l_IdleSpins = 0;
+    }
+
+    return NULL;
+
+}
+
+void GABLE_StartPPUWorker (GABLE_PPU* p_PPU)
+{
+
+    if (p_PPU->m_Worker != NULL)
+    {
+        return;
+    }
+
+    // Allocate the render worker.
+    GABLE_PPUWorker* l_Worker = GABLE_calloc(1, GABLE_PPUWorker);
+    GABLE_pexpect(l_Worker != NULL, "Failed to allocate render worker");
+
+    // The shadow PPU starts out as a copy of this PPU. It never transfers DMA data, nor does it
+    // call the frame-rendered callback; the engine's PPU does both of those.
+    GABLE_PPU* l_Shadow = GABLE_calloc(1, GABLE_PPU);
+    GABLE_pexpect(l_Shadow != NULL, "Failed to allocate shadow PPU context");
+    memcpy(l_Shadow, p_PPU, sizeof(GABLE_PPU));
+    l_Shadow->m_VRAM = (p_PPU->m_VRAM == p_PPU->m_VRAM1) ? l_Shadow->m_VRAM1 : l_Shadow->m_VRAM0;
+    l_Shadow->m_ODMATicks = 0xFF;
+    l_Shadow->m_HDMABlocksLeft = 0;
+    l_Shadow->m_FrameRenderedCallback = NULL;
+    l_Shadow->m_ScanlineRenderedCallback = NULL;
+    l_Shadow->m_Worker = NULL;
+    l_Worker->m_Shadow = l_Shadow;
+
+    // The shadow PPU needs a background cache of its own, if this PPU has one.
+    l_Shadow->m_BackgroundCache = NULL;
+    if (p_PPU->m_BackgroundCache != NULL)
+    {
+        l_Shadow->m_BackgroundCache = GABLE_calloc(1, GABLE_BackgroundCache);
+        GABLE_pexpect(l_Shadow->m_BackgroundCache != NULL, "Failed to allocate shadow background cache");
+        l_Shadow->m_BackgroundCache->m_AllDirty = true;
+    }
+
+    // Initialize the write log and the render worker's synchronization primitives.
+    atomic_init(&l_Worker->m_LogHead, 0);
+    atomic_init(&l_Worker->m_LogTail, 0);
+    atomic_init(&l_Worker->m_PublishedDots, 0);
+    atomic_init(&l_Worker->m_RenderedDots, 0);
+    atomic_init(&l_Worker->m_Sleeping, false);
+    atomic_init(&l_Worker->m_Stopping, false);
+    pthread_mutex_init(&l_Worker->m_Mutex, NULL);
+    pthread_cond_init(&l_Worker->m_WakeCondition, NULL);
+
+    // Spawn the render worker's thread.
+    errno = pthread_create(&l_Worker->m_Thread, NULL, GABLE_PPUWorkerMain, l_Worker);
+    if (errno != 0)
+    {
+        GABLE_perror("Failed to spawn render worker thread");
+        pthread_cond_destroy(&l_Worker->m_WakeCondition);
+        pthread_mutex_destroy(&l_Worker->m_Mutex);
+        GABLE_free(l_Shadow->m_BackgroundCache);
+        GABLE_free(l_Worker->m_Shadow);
+        GABLE_free(l_Worker);
+        return;
+    }
+
+    p_PPU->m_Worker = l_Worker;
+
+}
+
+void GABLE_StopPPUWorker (GABLE_PPU* p_PPU)
+{
+
+    GABLE_PPUWorker* l_Worker = p_PPU->m_Worker;
+    if (l_Worker == NULL)
+    {
+        return;
+    }
+
+    // Let the render worker finish whatever has been published so far, so that the partially
+    // rendered frame isn't lost, then tell it to exit and wait for it.
+    GABLE_SyncPPUWorker(p_PPU);
+
+    pthread_mutex_lock(&l_Worker->m_Mutex);
+    atomic_store(&l_Worker->m_Stopping, true);
+    pthread_cond_signal(&l_Worker->m_WakeCondition);
+    pthread_mutex_unlock(&l_Worker->m_Mutex);
+    pthread_join(l_Worker->m_Thread, NULL);
+
+    // Clean up.
+    pthread_cond_destroy(&l_Worker->m_WakeCondition);
+    pthread_mutex_destroy(&l_Worker->m_Mutex);
+    GABLE_free(l_Worker->m_Shadow->m_BackgroundCache);
+    GABLE_free(l_Worker->m_Shadow);
+    GABLE_free(l_Worker);
+    p_PPU->m_Worker = NULL;
+
+}
+
+// Static Functions - Background Cache /////////////////////////////////////////////////////////////
+
+void GABLE_InvalidateBackgroundCache (GABLE_PPU* p_PPU, Uint8 p_Bank, Uint16 p_Address)
+{
+
+    GABLE_BackgroundCache* l_Cache = p_PPU->m_BackgroundCache;
+    if (l_Cache == NULL)
+    {
+        return;
+    }
+
+    // Writes to either tilemap (tile numbers in bank 0, attributes in bank 1) only invalidate the
+    // cell written to.
+    if (p_Address >= GABLE_GB_SCRN0_START - GABLE_GB_VRAM_START)
+    {
+        Uint16 l_Offset = p_Address - (GABLE_GB_SCRN0_START - GABLE_GB_VRAM_START);
+        l_Cache->m_DirtyCells[l_Offset / GABLE_PPU_VRAM_TILEMAP_SIZE][l_Offset % GABLE_PPU_VRAM_TILEMAP_SIZE] = true;
+    }
+
+    // Writes to tile data mark the tile as written to. The cells which point to that tile are
+    // found the next time a line is rendered from the cache.
+    else
+    {
+        l_Cache->m_DirtyTiles[p_Bank][p_Address / 16] = true;
+        l_Cache->m_TileDataDirty = true;
+    }
+
+}
+
+void GABLE_InvalidateWholeBackgroundCache (GABLE_PPU* p_PPU)
+{
+    if (p_PPU->m_BackgroundCache != NULL)
+    {
+        p_PPU->m_BackgroundCache->m_AllDirty = true;
+    }
+}
+
+void GABLE_RenderCachedCell (GABLE_PPU* p_PPU, GABLE_BackgroundCache* p_Cache, Uint8 p_Map, Uint16 p_Cell)
+{
+
+    // Fetch the cell's tile number and attributes, from VRAM banks 0 and 1, respectively.
+    Uint16 l_MapAddress = (GABLE_GB_SCRN0_START - GABLE_GB_VRAM_START) + (p_Map * GABLE_PPU_VRAM_TILEMAP_SIZE) + p_Cell;
+    Uint8 l_TileIndex = p_PPU->m_VRAM0[l_MapAddress];
+    GABLE_TileAttributes l_TileAttributes = { .m_Value = p_PPU->m_VRAM1[l_MapAddress] };
+
+    // Determine the address of the tile's data in the current VRAM bank, in the same manner as the
+    // pixel fetcher.
+    Uint16 l_TileAddress = l_TileIndex * 16;
+    if (l_TileIndex < 128 && p_PPU->m_LCDC.m_BGWindowTileDataAddress == 0)
+    {
+        l_TileAddress += 0x1000;
+    }
+
+    // Resolve the four colors the tile can use ahead of time.
+    Uint32 l_Colors[4];
+    for (Uint8 i = 0; i < 4; ++i)
+    {
+        l_Colors[i] = (p_PPU->m_GRPM != 0) ?
+            GABLE_GetBackgroundColorInternal(p_PPU, l_TileAttributes.m_PaletteIndex, i, NULL) :
+            GABLE_PPU_DMG_PALETTE[(p_PPU->m_BGP >> (i * 2)) & 0b11];
+    }
+
+    // Render the tile's 8x8 pixels into the cache.
+    Uint32 l_Origin = ((p_Cell / 32) * 8 * GABLE_PPU_TILEMAP_PIXEL_SIZE) + ((p_Cell % 32) * 8);
+    for (Uint8 y = 0; y < 8; ++y)
+    {
+        Uint8 l_TileDataLow = p_PPU->m_VRAM[l_TileAddress + (y * 2)];
+        Uint8 l_TileDataHigh = p_PPU->m_VRAM[l_TileAddress + (y * 2) + 1];
+
+        Uint32 l_Index = l_Origin + (y * GABLE_PPU_TILEMAP_PIXEL_SIZE);
+        for (Uint8 x = 0; x < 8; ++x)
+        {
+            Uint8 l_Bit = (l_TileAttributes.m_HorizontalFlip == 0) ? 7 - x : x;
+            Uint8 l_ColorIndex = (((l_TileDataHigh >> l_Bit) & 1) << 1) | ((l_TileDataLow >> l_Bit) & 1);
+            p_Cache->m_Colors[p_Map][l_Index + x] = l_Colors[l_ColorIndex];
+            p_Cache->m_ColorIndices[p_Map][l_Index + x] = l_ColorIndex;
+        }
+    }
+
+    p_Cache->m_DirtyCells[p_Map][p_Cell] = false;
+
+}
+
+void GABLE_CompositeCachedLineObjects (GABLE_PPU* p_PPU, const Uint8* p_ColorIndices)
+{
+
+    Uint32* l_Line = &p_PPU->m_ScreenBuffer[p_PPU->m_LY * GABLE_PPU_SCREEN_WIDTH];
+    Uint8 l_FineX = p_PPU->m_SCX % 8;
+
+    // Walk through the line in the same 8-pixel steps as the pixel fetcher, selecting and fetching
+    // the objects for each step with the pixel fetcher's own functions, so that the same objects
+    // win out on each pixel.
+    GABLE_PixelFetcher l_Fetcher;
+    memset(&l_Fetcher, 0, sizeof(GABLE_PixelFetcher));
+    for (Uint8 l_Step = 0; l_Step < GABLE_PPU_LINE_TILE_SPAN; ++l_Step)
+    {
+        l_Fetcher.m_FetchingX = l_Step * 8;
+        l_Fetcher.m_FetchedOBJ.m_ObjectCount = 0;
+        GABLE_FetchObjectTileNumber(p_PPU, &l_Fetcher);
+        if (l_Fetcher.m_FetchedOBJ.m_ObjectCount == 0)
+        {
+            continue;
+        }
+
+        GABLE_FetchObjectTileData(p_PPU, &l_Fetcher, 0);
+        GABLE_FetchObjectTileData(p_PPU, &l_Fetcher, 1);
+
+        // The pixel fetcher discards the first `SCX % 8` pixels it pushes.
+        for (Uint8 i = 0; i < 8; ++i)
+        {
+            l_Fetcher.m_QueueX = (l_Step * 8) + i;
+            if (l_Fetcher.m_QueueX < l_FineX)
+            {
+                continue;
+            }
+
+            Uint8 l_ScreenX = l_Fetcher.m_QueueX - l_FineX;
+            if (l_ScreenX >= GABLE_PPU_SCREEN_WIDTH)
+            {
+                break;
+            }
+
+            l_Line[l_ScreenX] = GABLE_FetchObjectPixel(
+                p_PPU,
+                &l_Fetcher,
+                0,
+                p_ColorIndices[(Uint8) (p_PPU->m_SCX + l_ScreenX)],
+                l_Line[l_ScreenX],
+                p_PPU->m_LCDC.m_BGWEnableOrPriority
+            );
+        }
+    }
+
+}
+
+Bool GABLE_RenderCachedLine (GABLE_PPU* p_PPU)
+{
+
+    GABLE_BackgroundCache* l_Cache = p_PPU->m_BackgroundCache;
+
+    // The cache can't be used on lines where the window is visible, nor on lines where the DMG
+    // background/window layer is disabled. The pixel fetcher handles those.
+    if (p_PPU->m_GRPM == 0 && p_PPU->m_LCDC.m_BGWEnableOrPriority == false)
+    {
+        return false;
+    }
+    else if (GABLE_IsWindowVisible(p_PPU) == true && p_PPU->m_LY >= p_PPU->m_WY)
+    {
+        return false;
+    }
+
+    // Bring the cache's dirty cells up to date.
+    if (l_Cache->m_AllDirty == true)
+    {
+        memset(l_Cache->m_DirtyCells, true, sizeof(l_Cache->m_DirtyCells));
+        memset(l_Cache->m_DirtyTiles, false, sizeof(l_Cache->m_DirtyTiles));
+        l_Cache->m_TileDataDirty = false;
+        l_Cache->m_AllDirty = false;
+    }
+    else if (l_Cache->m_TileDataDirty == true)
+    {
+        // Only tile data in the current VRAM bank is rendered into the cache. Switching banks
+        // invalidates the whole cache anyway.
+        Uint8 l_Bank = (p_PPU->m_VRAM == p_PPU->m_VRAM1);
+        for (Uint8 l_Map = 0; l_Map < 2; ++l_Map)
+        {
+            const Uint8* l_TileNumbers = &p_PPU->m_VRAM0[(GABLE_GB_SCRN0_START - GABLE_GB_VRAM_START) +
+                (l_Map * GABLE_PPU_VRAM_TILEMAP_SIZE)];
+            for (Uint16 l_Cell = 0; l_Cell < GABLE_PPU_VRAM_TILEMAP_SIZE; ++l_Cell)
+            {
+                Uint16 l_Tile = l_TileNumbers[l_Cell];
+                if (l_Tile < 128 && p_PPU->m_LCDC.m_BGWindowTileDataAddress == 0)
+                {
+                    l_Tile += 256;
+                }
+
+                if (l_Cache->m_DirtyTiles[l_Bank][l_Tile] == true)
+                {
+                    l_Cache->m_DirtyCells[l_Map][l_Cell] = true;
+                }
+            }
+        }
+
+        memset(l_Cache->m_DirtyTiles, false, sizeof(l_Cache->m_DirtyTiles));
+        l_Cache->m_TileDataDirty = false;
+    }
+
+    // Re-render any dirty cells along the part of the background layer this line shows.
+    Uint8 l_Map = p_PPU->m_LCDC.m_BGTilemapAddress;
+    Uint8 l_MapY = p_PPU->m_LY + p_PPU->m_SCY;
+    for (Uint8 i = 0; i < GABLE_PPU_LINE_TILE_SPAN; ++i)
+    {
+        Uint16 l_Cell = ((l_MapY / 8) * 32) + (((p_PPU->m_SCX / 8) + i) % 32);
+        if (l_Cache->m_DirtyCells[l_Map][l_Cell] == true)
+        {
+            GABLE_RenderCachedCell(p_PPU, l_Cache, l_Map, l_Cell);
+        }
+    }
+
+    // Copy the line out of the cache, wrapping around the right edge of the tilemap if needed.
+    Uint32* l_Line = &p_PPU->m_ScreenBuffer[p_PPU->m_LY * GABLE_PPU_SCREEN_WIDTH];
+    const Uint32* l_Row = &l_Cache->m_Colors[l_Map][l_MapY * GABLE_PPU_TILEMAP_PIXEL_SIZE];
+    Uint16 l_FirstPart = GABLE_PPU_TILEMAP_PIXEL_SIZE - p_PPU->m_SCX;
+    if (l_FirstPart > GABLE_PPU_SCREEN_WIDTH)
+    {
+        l_FirstPart = GABLE_PPU_SCREEN_WIDTH;
+    }
+
+    memcpy(l_Line, &l_Row[p_PPU->m_SCX], l_FirstPart * sizeof(Uint32));
+    memcpy(&l_Line[l_FirstPart], l_Row, (GABLE_PPU_SCREEN_WIDTH - l_FirstPart) * sizeof(Uint32));
+
+    // Draw the line's objects on top.
+    if (p_PPU->m_LCDC.m_ObjectEnable == true && p_PPU->m_LineObjectCount > 0)
+    {
+        GABLE_CompositeCachedLineObjects(p_PPU,
+            &l_Cache->m_ColorIndices[l_Map][l_MapY * GABLE_PPU_TILEMAP_PIXEL_SIZE]);
+    }
+
+    return true;
+
+}
+
+void GABLE_LeaveCachedLine (GABLE_PPU* p_PPU)
+{
+
+    // A line rendered from the background cache is drawn all at once, at the start of the pixel
+    // transfer, from the registers as they were then. If one of those registers is about to change
+    // partway through the pixel transfer, then the rest of the line has to be drawn by the pixel
+    // fetcher, which also works out when the pixel transfer ends from then on.
+    if (
+        p_PPU->m_LineFromCache == false ||
+        p_PPU->m_STAT.m_DisplayMode != GABLE_DM_PIXEL_TRANSFER
+    )
+    {
+        return;
+    }
+
+    // Step the pixel fetcher through the dots of the pixel transfer so far, before the register
+    // changes. It redraws the pixels the cache already drew, and ends up just where it would be
+    // had it been drawing the line all along.
+    Uint16 l_CurrentDot = p_PPU->m_CurrentDot;
+    for (p_PPU->m_CurrentDot = 80; p_PPU->m_CurrentDot < l_CurrentDot; ++p_PPU->m_CurrentDot)
+    {
+        GABLE_TickPixelFetcher(p_PPU, &p_PPU->m_PixelFetcher);
+    }
+
+    p_PPU->m_LineFromCache = false;
+
+}
+
+// Public Functions ////////////////////////////////////////////////////////////////////////////////
+
+GABLE_PPU* GABLE_CreatePPU ()
+{
+
+    // Allocate the PPU context.
+    GABLE_PPU* l_PPU = GABLE_calloc(1, GABLE_PPU);
+    GABLE_pexpect(l_PPU != NULL, "Failed to allocate PPU context");
+
+    // Initialize the PPU context.
+    GABLE_ResetPPU(l_PPU);
+
+    // Return the PPU context.
+    return l_PPU;
+
+}
+
+void GABLE_DestroyPPU (GABLE_PPU* p_PPU)
+{
+
+    if (p_PPU != NULL)
+    {
+        GABLE_StopPPUWorker(p_PPU);
+        GABLE_free(p_PPU->m_BackgroundCache);
+        GABLE_free(p_PPU);
+    }
+
+}
+
+void GABLE_ResetPPU (GABLE_PPU* p_PPU)
+{
+    GABLE_expect(p_PPU, "PPU context is NULL!");
+
+    // If threaded rendering is enabled, stop the render worker for now. It is restarted once the
+    // PPU has been reset, so that its shadow PPU starts out from the reset state, too.
+    Bool l_Threaded = (p_PPU->m_Worker != NULL);
+    GABLE_StopPPUWorker(p_PPU);
+
+    // Hold on to the background cache, if there is one. It is invalidated once the PPU has been
+    // reset.
+    GABLE_BackgroundCache* l_BackgroundCache = p_PPU->m_BackgroundCache;
+    Bool l_Headless = p_PPU->m_Headless;
+    
+    // Reset the PPU structure's memory.
+    memset(p_PPU, 0, sizeof(GABLE_PPU));
+
+    // Also reset the pixel fetcher context's memory.
+    memset(&p_PPU->m_PixelFetcher, 0, sizeof(GABLE_PixelFetcher));
+
+    // Reset the PPU registers.
+    /* LCDC     = 0x91 */   p_PPU->m_LCDC.m_Register    = 0x91; // 0b10010001
+    /* STAT     = 0x85 */   p_PPU->m_STAT.m_Register    = 0x85; // 0b10000101
+    /* SCY      = 0x00 */   p_PPU->m_SCY                = 0x00;
+    /* SCX      = 0x00 */   p_PPU->m_SCX                = 0x00;
+    /* LY       = 0x00 */   p_PPU->m_LY                 = 0x00;
+    /* LYC      = 0x00 */   p_PPU->m_LYC                = 0x00;
+    /* BGP      = 0xFC */   p_PPU->m_BGP                = 0b00011011; // Color indices: 0, 1, 2, 3
+    /* OBP0     = 0xFF */   p_PPU->m_OBP0               = 0b00011011; // Color indices: 0, 1, 2, 3
+    /* OBP1     = 0xFF */   p_PPU->m_OBP1               = 0b00011011; // Color indices: 0, 1, 2, 3
+    /* WY       = 0x00 */   p_PPU->m_WY                 = 0x00;
+    /* WX       = 0x00 */   p_PPU->m_WX                 = 0x00;
+    /* DMA      = 0x00 */   p_PPU->m_DMA                = 0x00;
+    /* VBK      = 0x00 */   p_PPU->m_VBK                = 0x00;
+    /* HDMA1    = 0xFF */   p_PPU->m_HDMA1              = 0xFF;
+    /* HDMA2    = 0xFF */   p_PPU->m_HDMA2              = 0xFF;
+    /* HDMA3    = 0xFF */   p_PPU->m_HDMA3              = 0xFF;
+    /* HDMA4    = 0xFF */   p_PPU->m_HDMA4              = 0xFF;
+    /* HDMA5    = 0xFF */   p_PPU->m_HDMA5.m_Register   = 0xFF;
+    /* BGPI     = 0x00 */   p_PPU->m_BGPI.m_Register    = 0x00;
+    /* OBPI     = 0x00 */   p_PPU->m_OBPI.m_Register    = 0x00;
+    /* OPRI     = 0x00 */   p_PPU->m_OPRI               = 0x00;
+    /* GRPM     = 0x01 */   p_PPU->m_GRPM               = 0x01;
+    /* LTAH     = 0x00 */   p_PPU->m_LTAH               = 0x00;
+    /* LTAL     = 0x00 */   p_PPU->m_LTAL               = 0x00;
+    /* LTC      = 0x00 */   p_PPU->m_LTC.m_Register     = 0x00;
+
+    // Prepare the color RAM buffers.
+    // Initialize each palette to a DMG style palette.
+    // - DMG Palette: White, Light Gray, Dark Gray, Black
+    for (Uint8 i = 0; i < GABLE_PPU_CRAM_SIZE; i += 8)
+    {
+        p_PPU->m_BgCRAM[i + 0] = GABLE_PPU_DMG_PALETTE_RGB555[0];
+        p_PPU->m_BgCRAM[i + 1] = GABLE_PPU_DMG_PALETTE_RGB555[1];
+        p_PPU->m_BgCRAM[i + 2] = GABLE_PPU_DMG_PALETTE_RGB555[2];
+        p_PPU->m_BgCRAM[i + 3] = GABLE_PPU_DMG_PALETTE_RGB555[3];
+        p_PPU->m_BgCRAM[i + 4] = GABLE_PPU_DMG_PALETTE_RGB555[4];
+        p_PPU->m_BgCRAM[i + 5] = GABLE_PPU_DMG_PALETTE_RGB555[5];
+        p_PPU->m_BgCRAM[i + 6] = GABLE_PPU_DMG_PALETTE_RGB555[6];
+        p_PPU->m_BgCRAM[i + 7] = GABLE_PPU_DMG_PALETTE_RGB555[7];
+
+        p_PPU->m_ObjCRAM[i + 0] = GABLE_PPU_DMG_PALETTE_RGB555[0];
+        p_PPU->m_ObjCRAM[i + 1] = GABLE_PPU_DMG_PALETTE_RGB555[1];
+        p_PPU->m_ObjCRAM[i + 2] = GABLE_PPU_DMG_PALETTE_RGB555[2];
+        p_PPU->m_ObjCRAM[i + 3] = GABLE_PPU_DMG_PALETTE_RGB555[3];
+        p_PPU->m_ObjCRAM[i + 4] = GABLE_PPU_DMG_PALETTE_RGB555[4];
+        p_PPU->m_ObjCRAM[i + 5] = GABLE_PPU_DMG_PALETTE_RGB555[5];
+        p_PPU->m_ObjCRAM[i + 6] = GABLE_PPU_DMG_PALETTE_RGB555[6];
+        p_PPU->m_ObjCRAM[i + 7] = GABLE_PPU_DMG_PALETTE_RGB555[7];
+    }
+
+    // Point the VRAM pointer to VRAM0.
+    p_PPU->m_VRAM = p_PPU->m_VRAM0;
+
+    // Reset the PPU's internal state.
+    p_PPU->m_CurrentDot = 0;
+    p_PPU->m_LCDOffDots = 0;
+    p_PPU->m_ODMATicks = 0xFF;
+    p_PPU->m_ODMADelay = 0;
+    p_PPU->m_ODMASource = 0;
+    p_PPU->m_ODMADestination = 0;
+    p_PPU->m_HDMABlocksLeft = 0;
+    p_PPU->m_HDMASource = 0;
+    p_PPU->m_HDMADestination = 0;
+    p_PPU->m_LineObjectCount = 0;
+
+    // Reset the PPU's display mode and pixel fetch mode.
+    p_PPU->m_STAT.m_DisplayMode = GABLE_DM_OBJECT_SCAN;
+    p_PPU->m_PixelFetcher.m_Mode = GABLE_PFM_TILE_NUMBER;
+
+    // Restore the background cache, and headless mode.
+    p_PPU->m_BackgroundCache = l_BackgroundCache;
+    p_PPU->m_Headless = l_Headless;
+    GABLE_InvalidateWholeBackgroundCache(p_PPU);
+    GABLE_ScheduleModeBoundary(p_PPU);
+
+    // Restart the render worker, if it was running.
+    if (l_Threaded == true)
+    {
+        GABLE_StartPPUWorker(p_PPU);
+    }
+}
+
+void GABLE_TickPPU (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine)
+{
+
+    GABLE_expect(p_PPU, "PPU context is NULL!");
+    GABLE_expect(p_Engine, "Engine context is NULL!");
+
+    // If the line table is enabled, then apply the current scanline's entry just before the first
+    // dot of its object scan. This is done before the dot is counted for the render worker, so that
+    // the values written take effect on that same dot in its shadow PPU, too.
+    if (
+        p_PPU->m_LTC.m_Enable == 1 &&
+        p_PPU->m_CurrentDot == 0 &&
+        p_PPU->m_STAT.m_DisplayMode == GABLE_DM_OBJECT_SCAN &&
+        p_PPU->m_LCDC.m_DisplayEnable == true
+    )
+    {
+        GABLE_ApplyLineTable(p_PPU, p_Engine);
+    }
+
+    // At the start of each `VBLANK` period, advance the tile animations and the palette fade, and
+    // stream in the parts of the map which the camera has brought into view. These are written
+    // before the dot is counted for the render worker, in the same manner as above.
+    if (
+        p_PPU->m_CurrentDot == 0 &&
+        p_PPU->m_LY == GABLE_PPU_SCREEN_HEIGHT &&
+        p_PPU->m_STAT.m_DisplayMode == GABLE_DM_VERTICAL_BLANK &&
+        p_PPU->m_LCDC.m_DisplayEnable == true
+    )
+    {
+        GABLE_TickTileAnimations(p_PPU, p_Engine);
+        if (p_PPU->m_MapStreamer.m_Active == true)
+        {
+            GABLE_TickMapStreamer(p_PPU, p_Engine);
+        }
+
+        if (p_PPU->m_PaletteFade.m_Active == true)
+        {
+            GABLE_TickPaletteFade(p_PPU);
+        }
+    }
+
+    // If threaded rendering is enabled, count this dot, and let the render worker tick its shadow
+    // PPU up to it. The render worker is woken at the start of each scanline if it fell asleep.
+    GABLE_PPUWorker* l_Worker = p_PPU->m_Worker;
+    if (l_Worker != NULL)
+    {
+        atomic_store_explicit(&l_Worker->m_PublishedDots, ++l_Worker->m_Dots, memory_order_release);
+        if (p_PPU->m_CurrentDot == 0)
+        {
+            GABLE_WakePPUWorker(l_Worker);
+        }
+    }
+
+    // Don't tick the PPU if the display is off. Instead, count the dots of a virtual frame, and
+    // call the frame-rendered callback (if one is provided) once per frame's worth of dots, so that
+    // the host still sees a steady frame rate while the (blank) display is off.
+    if (p_PPU->m_LCDC.m_DisplayEnable == false)
+    {
+        if (++p_PPU->m_LCDOffDots >= GABLE_DOTS_PER_FRAME)
+        {
+            p_PPU->m_LCDOffDots = 0;
+            if (p_PPU->m_FrameRenderedCallback != NULL)
+            {
+                GABLE_SyncAPU(GABLE_GetAPU(p_Engine), p_Engine);
+                p_PPU->m_FrameRenderedCallback(p_Engine, p_PPU);
+            }
+        }
+
+        return;
+    }
+
+    // In headless mode, only the display's timing is kept.
+    if (p_PPU->m_Headless == true)
+    {
+        GABLE_TickHeadlessPPU(p_PPU, p_Engine);
+        return;
+    }
+    
+    GABLE_TickDisplayMode(p_PPU, p_Engine);
+
+}
+
+void GABLE_TickODMA (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine)
+{
+
+    GABLE_expect(p_PPU, "PPU context is NULL!");
+    GABLE_expect(p_Engine, "Engine context is NULL!");
+
+    // Check to see if the DMA transfer is active.
+    if (p_PPU->m_ODMATicks >= 0xA0)
+    {
+        return;
+    }
+
+    // If the ODMA transfer has been initiated, check to see if there is a delay still before
+    // actually starting the transfer.
+    if (p_PPU->m_ODMADelay > 0)
+    {
+        p_PPU->m_ODMADelay--;
+        return;
+    }
+
+    // On the transfer's first tick, resolve the source region once and copy the whole transfer
+    // into the OAM buffer in one step. The remaining ticks only count down the transfer's window,
+    // during which the OAM buffer stays accessible to the DMA process, as before.
+    if (p_PPU->m_ODMATicks == 0)
+    {
+        Uint8* l_OAM = (Uint8*) p_PPU->m_OAM;
+        Uint16 l_Offset = p_PPU->m_ODMADestination - GABLE_GB_OAM_START;
+        GABLE_ReadBlock(p_Engine, p_PPU->m_ODMASource, &l_OAM[l_Offset], GABLE_PPU_OAM_SIZE);
+
+        // If threaded rendering is enabled, record the transferred bytes for the render worker.
+        if (p_PPU->m_Worker != NULL)
+        {
+            for (Uint16 i = 0; i < GABLE_PPU_OAM_SIZE; ++i)
+            {
+                GABLE_LogPPUWrite(p_PPU, GABLE_PWT_OAM, l_Offset + i, l_OAM[l_Offset + i]);
+            }
+        }
+    }
+
+    // Increment the number of ticks.
+    p_PPU->m_ODMATicks++;
+
+}
+
+// Public Functions - Memory Access ////////////////////////////////////////////////////////////////
+
+Bool GABLE_ReadVRAMByte (const GABLE_PPU* p_PPU, Uint16 p_Address, Uint8* p_Value)
+{
+
+    GABLE_expect(p_PPU, "PPU context is NULL!");
+    GABLE_expect(p_Value, "Value pointer is NULL!");
+
+    // If, for some reason, the VRAM pointer is NULL, return `false`.
+    if (p_PPU->m_VRAM == NULL)
+    {
+        GABLE_error("Current VRAM bank pointer is NULL. Write to 'VBK' register to correct this.");
+        return false;
+    }
+    
+    // If a relative address (`0x0000` to `0x1FFF`) is provided, then it can be assumed that VRAM is
+    // being accessed from GABLE's address bus. If the PPU is currently transferring pixels to the
+    // screen buffer (i.e., in the pixel transfer state), then the VRAM buffer is locked and cannot be
+    // accessed. In this case, the byte returned is `0xFF`.
     //
     // This check is not performed if this read is being conducted as part of an OAM DMA transfer,
     // or if the LCDC display is off.
@@ -1315,6 +2842,61 @@ Bool GABLE_ReadVRAMByte (const GABLE_PPU* p_PPU, Uint16 p_Address, Uint8* p_Valu
 
 }
 
+Bool GABLE_ReadVRAMBlock (const GABLE_PPU* p_PPU, Uint16 p_Address, Uint8* p_Buffer, Size p_Length)
+{
+
+    GABLE_expect(p_PPU, "PPU context is NULL!");
+    GABLE_expect(p_Buffer, "Buffer pointer is NULL!");
+
+    // If, for some reason, the VRAM pointer is NULL, return `false`.
+    if (p_PPU->m_VRAM == NULL)
+    {
+        GABLE_error("Current VRAM bank pointer is NULL. Write to 'VBK' register to correct this.");
+        return false;
+    }
+
+    // As with single-byte reads, a relative address means the VRAM is being accessed from GABLE's
+    // address bus, and is subject to the pixel transfer lock. An absolute address means the VRAM is
+    // being accessed internally by the PPU; correct it to a relative address.
+    Bool l_Locked = false;
+    if (p_Address < GABLE_PPU_VRAM_BANK_SIZE)
+    {
+        l_Locked =
+            p_PPU->m_LCDC.m_DisplayEnable == true &&
+            p_PPU->m_STAT.m_DisplayMode == GABLE_DM_PIXEL_TRANSFER && 
+            p_PPU->m_ODMATicks >= 0xA0;
+    }
+    else if (p_Address >= GABLE_GB_VRAM_START && p_Address <= GABLE_GB_VRAM_END)
+    {
+        p_Address -= GABLE_GB_VRAM_START;
+    }
+    else
+    {
+        GABLE_error("VRAM read address $%04X is out of bounds.", p_Address);
+        return false;
+    }
+
+    // If the block runs past the end of the VRAM bank, return `false`.
+    if ((Size) p_Address + p_Length > GABLE_PPU_VRAM_BANK_SIZE)
+    {
+        GABLE_error("VRAM read block at $%04X of length %zu is out of bounds.", p_Address, p_Length);
+        return false;
+    }
+
+    // Copy the block from the current VRAM bank, or fill it with `0xFF` if the VRAM is locked.
+    if (l_Locked == true)
+    {
+        memset(p_Buffer, 0xFF, p_Length);
+    }
+    else
+    {
+        memcpy(p_Buffer, &p_PPU->m_VRAM[p_Address], p_Length);
+    }
+
+    return true;
+
+}
+
 Bool GABLE_ReadOAMByte (const GABLE_PPU* p_PPU, Uint16 p_Address, Uint8* p_Value)
 {
 
@@ -1410,6 +2992,15 @@ Bool GABLE_WriteVRAMByte (GABLE_PPU* p_PPU, Uint16 p_Address, Uint8 p_Value)
 
     // Write the byte to the current VRAM bank.
     p_PPU->m_VRAM[p_Address] = p_Value;
+    GABLE_InvalidateBackgroundCache(p_PPU, (p_PPU->m_VRAM == p_PPU->m_VRAM1), p_Address);
+
+    // If threaded rendering is enabled, record the write for the render worker.
+    if (p_PPU->m_Worker != NULL)
+    {
+        GABLE_LogPPUWrite(p_PPU, (p_PPU->m_VRAM == p_PPU->m_VRAM0) ? GABLE_PWT_VRAM0 : GABLE_PWT_VRAM1,
+            p_Address, p_Value);
+    }
+
     return true;
 
 }
@@ -1452,6 +3043,13 @@ Bool GABLE_WriteOAMByte (GABLE_PPU* p_PPU, Uint16 p_Address, Uint8 p_Value)
     // Cast the OAM buffer to a byte array and write the byte to that array.
     Uint8* l_OAM = (Uint8*) p_PPU->m_OAM;
     l_OAM[p_Address] = p_Value;
+
+    // If threaded rendering is enabled, record the write for the render worker.
+    if (p_PPU->m_Worker != NULL)
+    {
+        GABLE_LogPPUWrite(p_PPU, GABLE_PWT_OAM, p_Address, p_Value);
+    }
+
     return true;
 
 }
@@ -1584,13 +3182,31 @@ Uint8 GABLE_ReadOBPD (const GABLE_PPU* p_PPU)
 Uint8 GABLE_ReadOPRI (const GABLE_PPU* p_PPU)
 {
     GABLE_expect(p_PPU, "PPU context is NULL!");
-    return p_PPU->m_OPRI;
+    return p_PPU->m_OPRI;
+}
+
+Uint8 GABLE_ReadGRPM (const GABLE_PPU* p_PPU)
+{
+    GABLE_expect(p_PPU, "PPU context is NULL!");
+    return p_PPU->m_GRPM;
+}
+
+Uint8 GABLE_ReadLTAH (const GABLE_PPU* p_PPU)
+{
+    GABLE_expect(p_PPU, "PPU context is NULL!");
+    return p_PPU->m_LTAH;
+}
+
+Uint8 GABLE_ReadLTAL (const GABLE_PPU* p_PPU)
+{
+    GABLE_expect(p_PPU, "PPU context is NULL!");
+    return p_PPU->m_LTAL;
 }
 
-Uint8 GABLE_ReadGRPM (const GABLE_PPU* p_PPU)
+Uint8 GABLE_ReadLTC (const GABLE_PPU* p_PPU)
 {
     GABLE_expect(p_PPU, "PPU context is NULL!");
-    return p_PPU->m_GRPM;
+    return p_PPU->m_LTC.m_Register;
 }
 
 // Public Functions - Hardware Register Setters ////////////////////////////////////////////////////
@@ -1607,11 +3223,18 @@ void GABLE_WriteLCDC (GABLE_PPU* p_PPU, Uint8 p_Value)
         p_PPU->m_STAT.m_DisplayMode != GABLE_DM_VERTICAL_BLANK
     )
     {
+        GABLE_LeaveCachedLine(p_PPU);
         p_PPU->m_LCDC.m_Register = (p_PPU->m_LCDC.m_Register & 0b10000000) | (p_Value & 0b01111111);
     }
     else
     {
-        p_PPU->m_LCDC.m_Register = p_Value;
+        GABLE_ApplyLCDC(p_PPU, p_Value);
+    }
+
+    // Let the render worker know about the new value.
+    if (p_PPU->m_Worker != NULL)
+    {
+        GABLE_LogPPUWrite(p_PPU, GABLE_PWT_REGISTER, G_LCDC, p_PPU->m_LCDC.m_Register);
     }
 }
 
@@ -1628,13 +3251,44 @@ void GABLE_WriteSTAT (GABLE_PPU* p_PPU, Uint8 p_Value)
 void GABLE_WriteSCY (GABLE_PPU* p_PPU, Uint8 p_Value)
 {
     GABLE_expect(p_PPU, "PPU context is NULL!");
+    GABLE_LeaveCachedLine(p_PPU);
     p_PPU->m_SCY = p_Value;
+
+    if (p_PPU->m_Worker != NULL)
+    {
+        GABLE_LogPPUWrite(p_PPU, GABLE_PWT_REGISTER, G_SCY, p_Value);
+    }
 }
 
 void GABLE_WriteSCX (GABLE_PPU* p_PPU, Uint8 p_Value)
 {
     GABLE_expect(p_PPU, "PPU context is NULL!");
+    GABLE_LeaveCachedLine(p_PPU);
+
+    // In headless mode, and while threaded rendering is enabled, the length of the pixel transfer
+    // is worked out from the fine horizontal scroll. If that changes partway through the pixel
+    // transfer, though, the new length can only be found by stepping through the pixel fetcher.
+    if (
+        (p_PPU->m_Headless == true || p_PPU->m_Worker != NULL) &&
+        p_PPU->m_CountingFetcher == false &&
+        p_PPU->m_LCDC.m_DisplayEnable == true &&
+        p_PPU->m_STAT.m_DisplayMode == GABLE_DM_PIXEL_TRANSFER &&
+        (p_PPU->m_SCX & 0b111) != (p_Value & 0b111)
+    )
+    {
+        GABLE_CatchUpPixelFetcher(p_PPU);
+    }
+
     p_PPU->m_SCX = p_Value;
+    if (p_PPU->m_Headless == true)
+    {
+        GABLE_ScheduleModeBoundary(p_PPU);
+    }
+
+    if (p_PPU->m_Worker != NULL)
+    {
+        GABLE_LogPPUWrite(p_PPU, GABLE_PWT_REGISTER, G_SCX, p_Value);
+    }
 }
 
 // `LY` is read-only and cannot be written to.
@@ -1662,36 +3316,68 @@ void GABLE_WriteDMA (GABLE_PPU* p_PPU, Uint8 p_Value)
 void GABLE_WriteBGP (GABLE_PPU* p_PPU, Uint8 p_Value)
 {
     GABLE_expect(p_PPU, "PPU context is NULL!");
+    GABLE_LeaveCachedLine(p_PPU);
     p_PPU->m_BGP = p_Value;
+    GABLE_InvalidateWholeBackgroundCache(p_PPU);
+
+    if (p_PPU->m_Worker != NULL)
+    {
+        GABLE_LogPPUWrite(p_PPU, GABLE_PWT_REGISTER, G_BGP, p_Value);
+    }
 }
 
 void GABLE_WriteOBP0 (GABLE_PPU* p_PPU, Uint8 p_Value)
 {
     GABLE_expect(p_PPU, "PPU context is NULL!");
+    GABLE_LeaveCachedLine(p_PPU);
     p_PPU->m_OBP0 = p_Value;
+
+    if (p_PPU->m_Worker != NULL)
+    {
+        GABLE_LogPPUWrite(p_PPU, GABLE_PWT_REGISTER, G_OBP0, p_Value);
+    }
 }
 
 void GABLE_WriteOBP1 (GABLE_PPU* p_PPU, Uint8 p_Value)
 {
     GABLE_expect(p_PPU, "PPU context is NULL!");
+    GABLE_LeaveCachedLine(p_PPU);
     p_PPU->m_OBP1 = p_Value;
+
+    if (p_PPU->m_Worker != NULL)
+    {
+        GABLE_LogPPUWrite(p_PPU, GABLE_PWT_REGISTER, G_OBP1, p_Value);
+    }
 }
 
 void GABLE_WriteWY (GABLE_PPU* p_PPU, Uint8 p_Value)
 {
     GABLE_expect(p_PPU, "PPU context is NULL!");
+    GABLE_LeaveCachedLine(p_PPU);
     p_PPU->m_WY = p_Value;
+
+    if (p_PPU->m_Worker != NULL)
+    {
+        GABLE_LogPPUWrite(p_PPU, GABLE_PWT_REGISTER, G_WY, p_Value);
+    }
 }
 
 void GABLE_WriteWX (GABLE_PPU* p_PPU, Uint8 p_Value)
 {
     GABLE_expect(p_PPU, "PPU context is NULL!");
+    GABLE_LeaveCachedLine(p_PPU);
     p_PPU->m_WX = p_Value;
+
+    if (p_PPU->m_Worker != NULL)
+    {
+        GABLE_LogPPUWrite(p_PPU, GABLE_PWT_REGISTER, G_WX, p_Value);
+    }
 }
 
 void GABLE_WriteVBK (GABLE_PPU* p_PPU, Uint8 p_Value)
 {
     GABLE_expect(p_PPU, "PPU context is NULL!");
+    GABLE_LeaveCachedLine(p_PPU);
     p_PPU->m_VBK = p_Value;
     
     if (GABLE_bit(p_Value, 0) == 0)
@@ -1702,6 +3388,16 @@ void GABLE_WriteVBK (GABLE_PPU* p_PPU, Uint8 p_Value)
     {
         p_PPU->m_VRAM = p_PPU->m_VRAM1;
     }
+
+    // The background cache is rendered using tile data from the current VRAM bank.
+    GABLE_InvalidateWholeBackgroundCache(p_PPU);
+
+    // The pixel fetcher reads tile data from the current VRAM bank, so the render worker needs to
+    // know about this, too.
+    if (p_PPU->m_Worker != NULL)
+    {
+        GABLE_LogPPUWrite(p_PPU, GABLE_PWT_REGISTER, G_VBK, p_Value);
+    }
 }
 
 void GABLE_WriteHDMA1 (GABLE_PPU* p_PPU, Uint8 p_Value)
@@ -1749,7 +3445,11 @@ void GABLE_WriteHDMA5 (GABLE_PPU* p_PPU, GABLE_Engine* p_Engine, Uint8 p_Value)
     }
 
     // If the transfer mode is 1, then an HDMA transfer has been initiated. One block of data will
-    // be transferred each H-Blank period.
+    // be transferred each H-Blank period. Bit 7 of `HDMA5` reads clear until the transfer completes.
+    else
+    {
+        p_PPU->m_HDMA5.m_TransferMode = 0;
+    }
 }
 
 void GABLE_WriteBGPI (GABLE_PPU* p_PPU, Uint8 p_Value)
@@ -1767,6 +3467,11 @@ void GABLE_WriteBGPD (GABLE_PPU* p_PPU, Uint8 p_Value)
     if (p_PPU->m_LCDC.m_DisplayEnable == true && p_PPU->m_STAT.m_DisplayMode != GABLE_DM_PIXEL_TRANSFER)
     {
         p_PPU->m_BgCRAM[p_PPU->m_BGPI.m_ByteIndex] = p_Value;
+        GABLE_InvalidateWholeBackgroundCache(p_PPU);
+        if (p_PPU->m_Worker != NULL)
+        {
+            GABLE_LogPPUWrite(p_PPU, GABLE_PWT_BG_CRAM, p_PPU->m_BGPI.m_ByteIndex, p_Value);
+        }
     }
 
     // Whether or not the write was successful, the byte index will always increment if auto-increment
@@ -1792,6 +3497,10 @@ void GABLE_WriteOBPD (GABLE_PPU* p_PPU, Uint8 p_Value)
     if (p_PPU->m_LCDC.m_DisplayEnable == true && p_PPU->m_STAT.m_DisplayMode != GABLE_DM_PIXEL_TRANSFER)
     {
         p_PPU->m_ObjCRAM[p_PPU->m_OBPI.m_ByteIndex] = p_Value;
+        if (p_PPU->m_Worker != NULL)
+        {
+            GABLE_LogPPUWrite(p_PPU, GABLE_PWT_OBJ_CRAM, p_PPU->m_OBPI.m_ByteIndex, p_Value);
+        }
     }
 
     // Whether or not the write was successful, the byte index will always increment if auto-increment
@@ -1805,13 +3514,44 @@ void GABLE_WriteOBPD (GABLE_PPU* p_PPU, Uint8 p_Value)
 void GABLE_WriteOPRI (GABLE_PPU* p_PPU, Uint8 p_Value)
 {
     GABLE_expect(p_PPU, "PPU context is NULL!");
+    GABLE_LeaveCachedLine(p_PPU);
     p_PPU->m_OPRI = p_Value;
+
+    if (p_PPU->m_Worker != NULL)
+    {
+        GABLE_LogPPUWrite(p_PPU, GABLE_PWT_REGISTER, G_OPRI, p_Value);
+    }
 }
 
 void GABLE_WriteGRPM (GABLE_PPU* p_PPU, Uint8 p_Value)
 {
     GABLE_expect(p_PPU, "PPU context is NULL!");
+    GABLE_LeaveCachedLine(p_PPU);
     p_PPU->m_GRPM = p_Value;
+    GABLE_InvalidateWholeBackgroundCache(p_PPU);
+
+    if (p_PPU->m_Worker != NULL)
+    {
+        GABLE_LogPPUWrite(p_PPU, GABLE_PWT_REGISTER, G_GRPM, p_Value);
+    }
+}
+
+void GABLE_WriteLTAH (GABLE_PPU* p_PPU, Uint8 p_Value)
+{
+    GABLE_expect(p_PPU, "PPU context is NULL!");
+    p_PPU->m_LTAH = p_Value;
+}
+
+void GABLE_WriteLTAL (GABLE_PPU* p_PPU, Uint8 p_Value)
+{
+    GABLE_expect(p_PPU, "PPU context is NULL!");
+    p_PPU->m_LTAL = p_Value;
+}
+
+void GABLE_WriteLTC (GABLE_PPU* p_PPU, Uint8 p_Value)
+{
+    GABLE_expect(p_PPU, "PPU context is NULL!");
+    p_PPU->m_LTC.m_Register = p_Value;
 }
 
 // Public Functions - High-Level Functions /////////////////////////////////////////////////////////
@@ -1824,9 +3564,367 @@ void GABLE_SetFrameRenderedCallback (GABLE_Engine* p_Engine, GABLE_FrameRendered
     l_PPU->m_FrameRenderedCallback = p_Callback;
 }
 
+void GABLE_SetScanlineRenderedCallback (GABLE_Engine* p_Engine, GABLE_ScanlineRenderedCallback p_Callback)
+{
+    GABLE_expect(p_Engine, "Engine context is NULL!");
+    
+    GABLE_PPU* l_PPU = GABLE_GetPPU(p_Engine);
+    l_PPU->m_ScanlineRenderedCallback = p_Callback;
+}
+
 const Uint32* GABLE_GetScreenBuffer (GABLE_Engine* p_Engine)
 {
     GABLE_expect(p_Engine, "Engine context is NULL!");
     GABLE_PPU* l_PPU = GABLE_GetPPU(p_Engine);
     return l_PPU->m_ScreenBuffer;
 }
+
+void GABLE_SetThreadedRendering (GABLE_Engine* p_Engine, Bool p_Enabled)
+{
+    GABLE_expect(p_Engine, "Engine context is NULL!");
+
+    GABLE_PPU* l_PPU = GABLE_GetPPU(p_Engine);
+    if (p_Enabled == true)
+    {
+        GABLE_check(l_PPU->m_Headless == false, "Threaded rendering can't be enabled in headless mode!");
+        GABLE_StartPPUWorker(l_PPU);
+    }
+    else
+    {
+        GABLE_StopPPUWorker(l_PPU);
+    }
+}
+
+Bool GABLE_IsThreadedRendering (GABLE_Engine* p_Engine)
+{
+    GABLE_expect(p_Engine, "Engine context is NULL!");
+    GABLE_PPU* l_PPU = GABLE_GetPPU(p_Engine);
+    return l_PPU->m_Worker != NULL;
+}
+
+void GABLE_SetBackgroundCaching (GABLE_Engine* p_Engine, Bool p_Enabled)
+{
+    GABLE_expect(p_Engine, "Engine context is NULL!");
+
+    GABLE_PPU* l_PPU = GABLE_GetPPU(p_Engine);
+    if (p_Enabled == (l_PPU->m_BackgroundCache != NULL))
+    {
+        return;
+    }
+
+    // The render worker's shadow PPU needs its own cache, so restart the render worker, if it's
+    // running, once the cache has been created or destroyed.
+    Bool l_Threaded = (l_PPU->m_Worker != NULL);
+    GABLE_StopPPUWorker(l_PPU);
+
+    if (p_Enabled == true)
+    {
+        l_PPU->m_BackgroundCache = GABLE_calloc(1, GABLE_BackgroundCache);
+        GABLE_pexpect(l_PPU->m_BackgroundCache != NULL, "Failed to allocate background cache");
+        l_PPU->m_BackgroundCache->m_AllDirty = true;
+    }
+    else
+    {
+        GABLE_free(l_PPU->m_BackgroundCache);
+    }
+
+    if (l_Threaded == true)
+    {
+        GABLE_StartPPUWorker(l_PPU);
+    }
+}
+
+Bool GABLE_IsBackgroundCaching (GABLE_Engine* p_Engine)
+{
+    GABLE_expect(p_Engine, "Engine context is NULL!");
+    GABLE_PPU* l_PPU = GABLE_GetPPU(p_Engine);
+    return l_PPU->m_BackgroundCache != NULL;
+}
+
+void GABLE_SetPPUHeadless (GABLE_Engine* p_Engine, Bool p_Headless)
+{
+    GABLE_expect(p_Engine, "Engine context is NULL!");
+
+    GABLE_PPU* l_PPU = GABLE_GetPPU(p_Engine);
+    if (p_Headless == l_PPU->m_Headless)
+    {
+        return;
+    }
+
+    // There's nothing for the render worker to draw in headless mode.
+    if (p_Headless == true)
+    {
+        GABLE_StopPPUWorker(l_PPU);
+    }
+
+    // If headless mode is toggled partway through a pixel transfer, then the pixel fetcher has to
+    // be kept stepping through it, so that the pixel transfer still ends on the right dot. If it is
+    // turned off partway through a frame, then the screen buffer is filled in properly starting
+    // from the next scanline.
+    if (
+        l_PPU->m_LCDC.m_DisplayEnable == true &&
+        l_PPU->m_STAT.m_DisplayMode == GABLE_DM_PIXEL_TRANSFER
+    )
+    {
+        if (p_Headless == true)
+        {
+            l_PPU->m_CountingFetcher = true;
+        }
+        else if (l_PPU->m_CountingFetcher == false)
+        {
+            GABLE_CatchUpPixelFetcher(l_PPU);
+        }
+    }
+
+    l_PPU->m_Headless = p_Headless;
+    GABLE_ScheduleModeBoundary(l_PPU);
+}
+
+Bool GABLE_IsPPUHeadless (GABLE_Engine* p_Engine)
+{
+    GABLE_expect(p_Engine, "Engine context is NULL!");
+    GABLE_PPU* l_PPU = GABLE_GetPPU(p_Engine);
+    return l_PPU->m_Headless;
+}
+
+Bool GABLE_SetTileAnimation (GABLE_Engine* p_Engine, Uint8 p_Slot, const GABLE_DataHandle* p_Handle,
+    Uint8 p_VRAMBank, Uint16 p_FirstTile, Uint16 p_TileCount, Uint8 p_FramePeriod)
+{
+    GABLE_expect(p_Engine, "Engine context is NULL!");
+    GABLE_expect(p_Handle, "Data handle is NULL!");
+
+    // Validate the slot, and the range of tiles to animate.
+    if (p_Slot >= GABLE_PPU_TILE_ANIMATION_SLOT_COUNT)
+    {
+        GABLE_error("Tile animation slot %u is out of bounds.", p_Slot);
+        return false;
+    }
+    else if (p_VRAMBank > 1)
+    {
+        GABLE_error("VRAM bank %u is out of bounds.", p_VRAMBank);
+        return false;
+    }
+    else if (p_TileCount == 0 || p_FirstTile + p_TileCount > GABLE_PPU_VRAM_TILE_COUNT)
+    {
+        GABLE_error("Tile animation range %u to %u is out of bounds.", p_FirstTile, p_FirstTile + p_TileCount);
+        return false;
+    }
+    else if (p_FramePeriod == 0)
+    {
+        GABLE_error("Tile animation frame period is 0 frames.");
+        return false;
+    }
+
+    // The data chunk has to hold at least one frame's worth of tile data. Any bytes left over past
+    // the last whole frame are ignored.
+    Uint16 l_FrameCount = p_Handle->m_Length / (p_TileCount * 16);
+    if (l_FrameCount == 0)
+    {
+        GABLE_error("Data handle '%s' is too short to hold a frame of %u tiles.", p_Handle->m_Name, p_TileCount);
+        return false;
+    }
+
+    // The handle's address is relative to the start of the memory map, so that handles outside of
+    // bank 0 point past `$4000`. The slot keeps hold of the bank number and the offset within that
+    // bank instead, so that the animation doesn't depend on the currently-selected bank (nor on the
+    // handle, which may move in memory as more data is loaded).
+    GABLE_PPU* l_PPU = GABLE_GetPPU(p_Engine);
+    GABLE_TileAnimation* l_Animation = &l_PPU->m_TileAnimations[p_Slot];
+    l_Animation->m_SourceBank = (p_Handle->m_BankHigh << 8) | p_Handle->m_BankLow;
+    l_Animation->m_SourceOffset = p_Handle->m_Address % GABLE_DS_BANK_SIZE;
+    l_Animation->m_FirstTile = p_FirstTile;
+    l_Animation->m_TileCount = p_TileCount;
+    l_Animation->m_FrameCount = l_FrameCount;
+    l_Animation->m_CurrentFrame = 0;
+    l_Animation->m_VRAMBank = p_VRAMBank;
+    l_Animation->m_FramePeriod = p_FramePeriod;
+    l_Animation->m_FramesLeft = p_FramePeriod;
+    l_Animation->m_Active = true;
+
+    // Copy the first frame into VRAM right away, so that it is in place even if the display is off.
+    GABLE_CopyTileAnimationFrame(l_PPU, p_Engine, l_Animation);
+    return true;
+}
+
+void GABLE_ClearTileAnimation (GABLE_Engine* p_Engine, Uint8 p_Slot)
+{
+    GABLE_expect(p_Engine, "Engine context is NULL!");
+    GABLE_check(p_Slot < GABLE_PPU_TILE_ANIMATION_SLOT_COUNT, "Tile animation slot %u is out of bounds.", p_Slot);
+
+    GABLE_PPU* l_PPU = GABLE_GetPPU(p_Engine);
+    l_PPU->m_TileAnimations[p_Slot].m_Active = false;
+}
+
+Bool GABLE_SetMapStreamer (GABLE_Engine* p_Engine, Uint8 p_Tilemap, const GABLE_DataHandle* p_Tiles,
+    const GABLE_DataHandle* p_Attributes, Uint16 p_Width, Uint16 p_Height)
+{
+    GABLE_expect(p_Engine, "Engine context is NULL!");
+    GABLE_expect(p_Tiles, "Tile number data handle is NULL!");
+
+    // Validate the tilemap, and the size of the map against the data chunks holding it.
+    if (p_Tilemap > 1)
+    {
+        GABLE_error("Tilemap %u is out of bounds.", p_Tilemap);
+        return false;
+    }
+    else if (p_Width == 0 || p_Height == 0)
+    {
+        GABLE_error("Map size %ux%u is empty.", p_Width, p_Height);
+        return false;
+    }
+    else if ((Size) p_Width * p_Height > p_Tiles->m_Length)
+    {
+        GABLE_error("Data handle '%s' is too short to hold a %ux%u map.", p_Tiles->m_Name, p_Width, p_Height);
+        return false;
+    }
+    else if (p_Attributes != NULL && (Size) p_Width * p_Height > p_Attributes->m_Length)
+    {
+        GABLE_error("Data handle '%s' is too short to hold a %ux%u map.", p_Attributes->m_Name, p_Width, p_Height);
+        return false;
+    }
+
+    // As with the tile animation slots, keep hold of the bank numbers and offsets, rather than the
+    // handles themselves.
+    GABLE_PPU* l_PPU = GABLE_GetPPU(p_Engine);
+    GABLE_MapStreamer* l_Streamer = &l_PPU->m_MapStreamer;
+    memset(l_Streamer, 0, sizeof(GABLE_MapStreamer));
+    l_Streamer->m_TileBank = (p_Tiles->m_BankHigh << 8) | p_Tiles->m_BankLow;
+    l_Streamer->m_TileOffset = p_Tiles->m_Address % GABLE_DS_BANK_SIZE;
+    if (p_Attributes != NULL)
+    {
+        l_Streamer->m_AttributeBank = (p_Attributes->m_BankHigh << 8) | p_Attributes->m_BankLow;
+        l_Streamer->m_AttributeOffset = p_Attributes->m_Address % GABLE_DS_BANK_SIZE;
+        l_Streamer->m_HasAttributes = true;
+    }
+    l_Streamer->m_Width = p_Width;
+    l_Streamer->m_Height = p_Height;
+    l_Streamer->m_Tilemap = p_Tilemap;
+    l_Streamer->m_Active = true;
+
+    // Stream in the top-left corner of the map right away, so that it is in place even if the
+    // display is off.
+    GABLE_TickMapStreamer(l_PPU, p_Engine);
+    return true;
+}
+
+void GABLE_SetMapCamera (GABLE_Engine* p_Engine, Uint16 p_X, Uint16 p_Y)
+{
+    GABLE_expect(p_Engine, "Engine context is NULL!");
+
+    GABLE_PPU* l_PPU = GABLE_GetPPU(p_Engine);
+    GABLE_MapStreamer* l_Streamer = &l_PPU->m_MapStreamer;
+    GABLE_check(l_Streamer->m_Active == true, "The map streamer is not in use!");
+
+    // Keep the camera within the map, so that the screen never shows anything past its edges.
+    Uint32 l_MaxX = (l_Streamer->m_Width * 8 > GABLE_PPU_SCREEN_WIDTH) ? (l_Streamer->m_Width * 8) - GABLE_PPU_SCREEN_WIDTH : 0;
+    Uint32 l_MaxY = (l_Streamer->m_Height * 8 > GABLE_PPU_SCREEN_HEIGHT) ? (l_Streamer->m_Height * 8) - GABLE_PPU_SCREEN_HEIGHT : 0;
+    l_Streamer->m_CameraX = (p_X > l_MaxX) ? l_MaxX : p_X;
+    l_Streamer->m_CameraY = (p_Y > l_MaxY) ? l_MaxY : p_Y;
+
+    // While the display is off, there are no `VBLANK` periods to stream the map in at, so do so
+    // right away.
+    if (l_PPU->m_LCDC.m_DisplayEnable == false)
+    {
+        GABLE_TickMapStreamer(l_PPU, p_Engine);
+    }
+}
+
+void GABLE_ClearMapStreamer (GABLE_Engine* p_Engine)
+{
+    GABLE_expect(p_Engine, "Engine context is NULL!");
+
+    GABLE_PPU* l_PPU = GABLE_GetPPU(p_Engine);
+    l_PPU->m_MapStreamer.m_Active = false;
+}
+
+Bool GABLE_UploadBackgroundPalettes (GABLE_Engine* p_Engine, Uint8 p_Index, const Uint8* p_Data, Size p_Length)
+{
+    GABLE_expect(p_Engine, "Engine context is NULL!");
+    GABLE_expect(p_Data, "Palette data is NULL!");
+
+    GABLE_PPU* l_PPU = GABLE_GetPPU(p_Engine);
+    if ((Size) p_Index + p_Length > GABLE_PPU_CRAM_SIZE)
+    {
+        GABLE_error("Palette data at %u of length %zu is out of bounds.", p_Index, p_Length);
+        return false;
+    }
+    else if (l_PPU->m_LCDC.m_DisplayEnable == false || l_PPU->m_STAT.m_DisplayMode == GABLE_DM_PIXEL_TRANSFER)
+    {
+        return false;
+    }
+
+    GABLE_StoreCRAM(l_PPU, false, p_Index, p_Data, p_Length);
+    return true;
+}
+
+Bool GABLE_UploadObjectPalettes (GABLE_Engine* p_Engine, Uint8 p_Index, const Uint8* p_Data, Size p_Length)
+{
+    GABLE_expect(p_Engine, "Engine context is NULL!");
+    GABLE_expect(p_Data, "Palette data is NULL!");
+
+    GABLE_PPU* l_PPU = GABLE_GetPPU(p_Engine);
+    if ((Size) p_Index + p_Length > GABLE_PPU_CRAM_SIZE)
+    {
+        GABLE_error("Palette data at %u of length %zu is out of bounds.", p_Index, p_Length);
+        return false;
+    }
+    else if (l_PPU->m_LCDC.m_DisplayEnable == false || l_PPU->m_STAT.m_DisplayMode == GABLE_DM_PIXEL_TRANSFER)
+    {
+        return false;
+    }
+
+    GABLE_StoreCRAM(l_PPU, true, p_Index, p_Data, p_Length);
+    return true;
+}
+
+GABLE_ColorRGB555 GABLE_GetPresetColor (GABLE_Color p_Color)
+{
+    GABLE_expect(p_Color < GABLE_COLOR_COUNT, "Invalid preset color!");
+    return GABLE_PRESET_COLORS[p_Color];
+}
+
+void GABLE_FadePalettes (GABLE_Engine* p_Engine, const Uint8* p_BackgroundTarget, const Uint8* p_ObjectTarget,
+    Uint16 p_FrameCount)
+{
+    GABLE_expect(p_Engine, "Engine context is NULL!");
+
+    // The fade starts out from whatever is in color RAM right now. Any color RAM buffer without a
+    // target is left as it is.
+    GABLE_PPU* l_PPU = GABLE_GetPPU(p_Engine);
+    GABLE_PaletteFade* l_Fade = &l_PPU->m_PaletteFade;
+    memcpy(l_Fade->m_Source[0], l_PPU->m_BgCRAM, GABLE_PPU_CRAM_SIZE);
+    memcpy(l_Fade->m_Source[1], l_PPU->m_ObjCRAM, GABLE_PPU_CRAM_SIZE);
+    memcpy(l_Fade->m_Target[0], (p_BackgroundTarget != NULL) ? p_BackgroundTarget : l_PPU->m_BgCRAM, GABLE_PPU_CRAM_SIZE);
+    memcpy(l_Fade->m_Target[1], (p_ObjectTarget != NULL) ? p_ObjectTarget : l_PPU->m_ObjCRAM, GABLE_PPU_CRAM_SIZE);
+    l_Fade->m_FrameCount = (p_FrameCount > 0) ? p_FrameCount : 1;
+    l_Fade->m_Frame = 0;
+    l_Fade->m_Active = true;
+
+    // A fade lasting zero frames takes effect right away.
+    if (p_FrameCount == 0)
+    {
+        GABLE_TickPaletteFade(l_PPU);
+    }
+}
+
+void GABLE_FadePalettesToColor (GABLE_Engine* p_Engine, GABLE_ColorRGB555 p_Color, Uint16 p_FrameCount)
+{
+    GABLE_expect(p_Engine, "Engine context is NULL!");
+
+    // Fill a color RAM buffer with the target color, then fade both buffers towards it.
+    Uint8 l_Target[GABLE_PPU_CRAM_SIZE];
+    for (Uint8 i = 0; i < GABLE_PPU_CRAM_SIZE; i += 2)
+    {
+        l_Target[i] = (p_Color.m_Red << 3) | (p_Color.m_Green >> 2);
+        l_Target[i + 1] = ((p_Color.m_Green & 0b11) << 6) | (p_Color.m_Blue << 1);
+    }
+
+    GABLE_FadePalettes(p_Engine, l_Target, l_Target, p_FrameCount);
+}
+
+Bool GABLE_IsPaletteFading (GABLE_Engine* p_Engine)
+{
+    GABLE_expect(p_Engine, "Engine context is NULL!");
+    GABLE_PPU* l_PPU = GABLE_GetPPU(p_Engine);
+    return l_PPU->m_PaletteFade.m_Active;
+}
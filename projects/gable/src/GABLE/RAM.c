@@ -113,6 +113,59 @@ Bool GABLE_ReadSRAMByte (GABLE_RAM* p_RAM, Uint16 p_Address, Uint8* p_Value)
     return true;
 }
 
+Bool GABLE_ReadWRAMBlock (GABLE_RAM* p_RAM, Uint16 p_Address, Uint8* p_Buffer, Size p_Length)
+{
+    // Validate the RAM instance and buffer.
+    GABLE_expect(p_RAM != NULL, "RAM context is NULL!");
+    GABLE_expect(p_Buffer != NULL, "Buffer pointer is NULL!");
+
+    if ((Size) p_Address + p_Length > GABLE_GB_WRAM_SIZE)
+    {
+        GABLE_error("Working RAM block at '%u' of length '%zu' is out of bounds.", p_Address, p_Length);
+        return false;
+    }
+
+    // Copy the part of the block which lies in the first bank...
+    if (p_Address < GABLE_RAM_WRAM_BANK_SIZE)
+    {
+        Size l_Length = GABLE_RAM_WRAM_BANK_SIZE - p_Address;
+        if (l_Length > p_Length)
+        {
+            l_Length = p_Length;
+        }
+
+        memcpy(p_Buffer, &p_RAM->m_WRAM[p_Address], l_Length);
+        p_Buffer += l_Length;
+        p_Address += l_Length;
+        p_Length -= l_Length;
+    }
+
+    // ...then the part which lies in the current switchable bank.
+    if (p_Length > 0)
+    {
+        memcpy(p_Buffer, &p_RAM->m_WRAM[(p_RAM->m_WRAMBankNumber * GABLE_RAM_WRAM_BANK_SIZE) + (p_Address - GABLE_RAM_WRAM_BANK_SIZE)], p_Length);
+    }
+
+    return true;
+}
+
+Bool GABLE_ReadSRAMBlock (GABLE_RAM* p_RAM, Uint16 p_Address, Uint8* p_Buffer, Size p_Length)
+{
+    // Validate the RAM instance and buffer.
+    GABLE_expect(p_RAM != NULL, "RAM context is NULL!");
+    GABLE_expect(p_Buffer != NULL, "Buffer pointer is NULL!");
+
+    if ((Size) p_Address + p_Length > GABLE_RAM_SRAM_BANK_SIZE)
+    {
+        GABLE_error("Static RAM block at '%u' of length '%zu' is out of bounds.", p_Address, p_Length);
+        return false;
+    }
+
+    memcpy(p_Buffer, &p_RAM->m_SRAM[(p_RAM->m_SRAMBankNumber * GABLE_RAM_SRAM_BANK_SIZE) + p_Address], p_Length);
+
+    return true;
+}
+
 Bool GABLE_ReadHRAMByte (GABLE_RAM* p_RAM, Uint16 p_Address, Uint8* p_Value)
 {
     // Validate the RAM instance.
@@ -0,0 +1,976 @@
+/**
+ * @file GABLE/Sequencer.c
+ */
+
+#include <GABLE/Engine.h>
+#include <GABLE/DataStore.h>
+#include <GABLE/APU.h>
+#include <GABLE/Sequencer.h>
+
+// Private Constants ///////////////////////////////////////////////////////////////////////////////
+
+// The number of events a channel may run through in one row, before its stream is deemed broken
+// (eg. an endless run of setting changes) and ended.
+#define GABLE_SEQ_MAX_ROW_EVENTS    64
+
+// Static Constants ////////////////////////////////////////////////////////////////////////////////
+
+// The pulse channels' period register values of the notes `$00` - `$47`, from C in octave 2
+// (65.41 Hz) up to B in octave 7 (3951.07 Hz), in equal temperament: `2048 - (131072 / frequency)`.
+static const Uint16 GABLE_SEQ_NOTE_PERIODS[GABLE_SEQ_NOTE_COUNT] = {
+      44,  157,  263,  363,  457,  547,  631,  711,  786,  856,  923,  986,
+    1046, 1102, 1155, 1205, 1253, 1297, 1339, 1379, 1417, 1452, 1486, 1517,
+    1547, 1575, 1602, 1627, 1650, 1673, 1694, 1714, 1732, 1750, 1767, 1783,
+    1798, 1812, 1825, 1837, 1849, 1860, 1871, 1881, 1890, 1899, 1907, 1915,
+    1923, 1930, 1936, 1943, 1949, 1954, 1959, 1964, 1969, 1974, 1978, 1982,
+    1985, 1989, 1992, 1995, 1998, 2001, 2004, 2006, 2009, 2011, 2013, 2015
+};
+
+// The wave channel's period register values of the same notes. The wave channel steps through its
+// 32 samples twice as fast as the pulse channels step through their 8, for the same period, so a
+// period plays an octave lower on it: `2048 - (65536 / frequency)`.
+static const Uint16 GABLE_SEQ_WAVE_NOTE_PERIODS[GABLE_SEQ_NOTE_COUNT] = {
+    1046, 1102, 1155, 1205, 1253, 1297, 1339, 1379, 1417, 1452, 1486, 1517,
+    1547, 1575, 1602, 1627, 1650, 1673, 1694, 1714, 1732, 1750, 1767, 1783,
+    1798, 1812, 1825, 1837, 1849, 1860, 1871, 1881, 1890, 1899, 1907, 1915,
+    1923, 1930, 1936, 1943, 1949, 1954, 1959, 1964, 1969, 1974, 1978, 1982,
+    1985, 1989, 1992, 1995, 1998, 2001, 2004, 2006, 2009, 2011, 2013, 2015,
+    2017, 2018, 2020, 2022, 2023, 2025, 2026, 2027, 2028, 2029, 2030, 2031
+};
+
+// GABLE Sequencer Structures //////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief The state of one channel's part in a song or sound effect.
+ */
+typedef struct GABLE_SequencerTrack
+{
+    Uint16  m_Position;                                     ///< @brief The offset of the track's next event, or zero if its stream has ended.
+    Uint8   m_Wait;                                         ///< @brief The number of empty rows left to wait out.
+    Uint8   m_Instrument[GABLE_SEQ_INSTRUMENT_SIZE];        ///< @brief The current instrument.
+    Uint8   m_Volume;                                       ///< @brief The volume to play notes at, or `0xFF` for the instrument's.
+    Uint8   m_Panning;                                      ///< @brief The channel's panning.
+    Uint8   m_VibratoDepth;                                 ///< @brief The vibrato's depth, in period units.
+    Uint8   m_VibratoSpeed;                                 ///< @brief The vibrato's speed, in 64ths of a cycle per tick.
+    Uint8   m_VibratoPhase;                                 ///< @brief How far the vibrato is through its cycle, in 64ths.
+    Uint8   m_VibratoDelay;                                 ///< @brief The number of ticks left before the vibrato starts.
+    Uint16  m_Period;                                       ///< @brief The period of the note being played.
+    Bool    m_NoteOn;                                       ///< @brief Set while a note is being played.
+} GABLE_SequencerTrack;
+
+/**
+ * @brief The state of a song or sound effect being played by the sequencer.
+ */
+typedef struct GABLE_SequencerPlayer
+{
+    Bool                    m_Playing;                      ///< @brief Set while the song is playing.
+    Bool                    m_Paused;                       ///< @brief Set while the song is paused.
+    Uint8                   m_Priority;                     ///< @brief The sound effect's priority.
+    Uint16                  m_Bank;                         ///< @brief The data store bank holding the song.
+    Uint16                  m_Offset;                       ///< @brief The offset of the song in its bank.
+    Uint8                   m_Tempo;                        ///< @brief The song's tempo.
+    Uint8                   m_Speed;                        ///< @brief The number of ticks in each row.
+    Uint16                  m_RowCount;                     ///< @brief The number of rows in each pattern.
+    Uint8                   m_OrderCount;                   ///< @brief The number of entries in the order list.
+    Uint8                   m_LoopOrder;                    ///< @brief The entry to loop back to.
+    Uint8                   m_InstrumentCount;              ///< @brief The number of instruments.
+    Uint8                   m_WaveCount;                    ///< @brief The number of wave patterns.
+    Uint8                   m_PatternCount;                 ///< @brief The number of patterns.
+    Uint16                  m_WaveOffset;                   ///< @brief The offset of the wave patterns.
+    Uint16                  m_PatternTableOffset;           ///< @brief The offset of the pattern table.
+    Uint16                  m_OrderOffset;                  ///< @brief The offset of the order list.
+    Uint16                  m_TempoCounter;                 ///< @brief Counts up by the tempo on each "DIV-APU" tick.
+    Uint8                   m_Tick;                         ///< @brief The current tick in the current row.
+    Uint16                  m_Row;                          ///< @brief The current row in the current pattern.
+    Uint16                  m_Order;                        ///< @brief The current entry in the order list.
+    GABLE_SequencerTrack    m_Tracks[4];                    ///< @brief Each channel's track.
+} GABLE_SequencerPlayer;
+
+/**
+ * @brief The GABLE Engine's music sequencer structure.
+ */
+typedef struct GABLE_Sequencer
+{
+    Uint16                  m_Address;                                  ///< @brief The value of the `SQAH` and `SQAL` registers.
+    Uint8                   m_Marker;                                   ///< @brief The value of the `SQM` register.
+    GABLE_SequencerPlayer   m_Music;                                    ///< @brief The song being played.
+    GABLE_SequencerPlayer   m_Effects[GABLE_SEQ_EFFECT_SLOTS];          ///< @brief The sound effects being played.
+    GABLE_SequencerPlayer*  m_Owners[4];                                ///< @brief The song or sound effect playing on each channel.
+} GABLE_Sequencer;
+
+// Static Function Prototypes //////////////////////////////////////////////////////////////////////
+
+static Bool GABLE_ReadSongBytes (GABLE_Engine* p_Engine, const GABLE_SequencerPlayer* p_Player,
+    Uint16 p_Offset, Uint8* p_Buffer, Size p_Length);
+static Bool GABLE_LoadSong (GABLE_Sequencer* p_Sequencer, GABLE_Engine* p_Engine,
+    GABLE_SequencerPlayer* p_Player);
+static void GABLE_SilenceChannel (GABLE_APU* p_APU, GABLE_AudioChannel p_Channel);
+static void GABLE_ReleaseChannel (GABLE_Sequencer* p_Sequencer, GABLE_APU* p_APU,
+    GABLE_AudioChannel p_Channel);
+static void GABLE_StopPlayer (GABLE_Sequencer* p_Sequencer, GABLE_Engine* p_Engine,
+    GABLE_SequencerPlayer* p_Player);
+static void GABLE_WritePeriod (GABLE_APU* p_APU, GABLE_AudioChannel p_Channel,
+    const GABLE_SequencerTrack* p_Track, Uint16 p_Period, Bool p_Trigger);
+static void GABLE_PlayNote (GABLE_Engine* p_Engine, GABLE_SequencerPlayer* p_Player,
+    GABLE_SequencerTrack* p_Track, GABLE_AudioChannel p_Channel, Uint8 p_Note);
+static Bool GABLE_SelectInstrument (GABLE_Engine* p_Engine, GABLE_SequencerPlayer* p_Player,
+    GABLE_SequencerTrack* p_Track, Uint8 p_Instrument);
+static Bool GABLE_RunTrackRow (GABLE_Sequencer* p_Sequencer, GABLE_Engine* p_Engine,
+    GABLE_SequencerPlayer* p_Player, GABLE_AudioChannel p_Channel);
+static void GABLE_RunTrackTick (GABLE_Sequencer* p_Sequencer, GABLE_Engine* p_Engine,
+    GABLE_SequencerPlayer* p_Player, GABLE_AudioChannel p_Channel);
+static Bool GABLE_StartPattern (GABLE_Engine* p_Engine, GABLE_SequencerPlayer* p_Player);
+static void GABLE_TickPlayer (GABLE_Sequencer* p_Sequencer, GABLE_Engine* p_Engine,
+    GABLE_SequencerPlayer* p_Player);
+static void GABLE_PlayEffect (GABLE_Sequencer* p_Sequencer, GABLE_Engine* p_Engine, Uint8 p_Priority);
+
+// Static Functions ////////////////////////////////////////////////////////////////////////////////
+
+Bool GABLE_ReadSongBytes (GABLE_Engine* p_Engine, const GABLE_SequencerPlayer* p_Player,
+    Uint16 p_Offset, Uint8* p_Buffer, Size p_Length)
+{
+
+    // All of a song's data lies in the bank it was started from, so reads which would run past the
+    // end of the bank (or wrap around the offset) are broken data, and fail.
+    Size l_Offset = (Size) p_Player->m_Offset + p_Offset;
+    if (l_Offset + p_Length > GABLE_DS_BANK_SIZE)
+    {
+        GABLE_error("Sequencer data at offset %zu of length %zu runs past the end of bank %u.",
+            l_Offset, p_Length, p_Player->m_Bank);
+        return false;
+    }
+
+    return GABLE_ReadDataStoreBankBlock(GABLE_GetDataStore(p_Engine), p_Player->m_Bank,
+        (Uint16) l_Offset, p_Buffer, p_Length);
+
+}
+
+Bool GABLE_LoadSong (GABLE_Sequencer* p_Sequencer, GABLE_Engine* p_Engine,
+    GABLE_SequencerPlayer* p_Player)
+{
+
+    // Work out which bank the song lies in. Songs in the switchable bank are played from whichever
+    // bank is selected now, so that the program is free to switch banks while they play.
+    if (p_Sequencer->m_Address > GABLE_GB_ROM_END)
+    {
+        GABLE_error("Sequencer data address $%04X is not in the data store.", p_Sequencer->m_Address);
+        return false;
+    }
+    else if (p_Sequencer->m_Address < GABLE_DS_BANK_SIZE)
+    {
+        p_Player->m_Bank = 0;
+        p_Player->m_Offset = p_Sequencer->m_Address;
+    }
+    else
+    {
+        const GABLE_DataStore* l_DataStore = GABLE_GetDataStore(p_Engine);
+        p_Player->m_Bank = (GABLE_ReadDSBKH(l_DataStore) << 8) | GABLE_ReadDSBKL(l_DataStore);
+        p_Player->m_Offset = p_Sequencer->m_Address - GABLE_DS_BANK_SIZE;
+    }
+
+    // Read the song's header, and work out where the rest of its data lies.
+    Uint8 l_Header[GABLE_SEQ_HEADER_SIZE];
+    if (GABLE_ReadSongBytes(p_Engine, p_Player, 0, l_Header, GABLE_SEQ_HEADER_SIZE) == false)
+    {
+        return false;
+    }
+
+    p_Player->m_Tempo = l_Header[0];
+    p_Player->m_Speed = (l_Header[1] != 0) ? l_Header[1] : 1;
+    p_Player->m_RowCount = (l_Header[2] != 0) ? l_Header[2] : 256;
+    p_Player->m_OrderCount = l_Header[3];
+    p_Player->m_LoopOrder = l_Header[4];
+    p_Player->m_InstrumentCount = l_Header[5];
+    p_Player->m_WaveCount = l_Header[6];
+    p_Player->m_PatternCount = l_Header[7];
+    p_Player->m_WaveOffset = GABLE_SEQ_HEADER_SIZE +
+        (p_Player->m_InstrumentCount * GABLE_SEQ_INSTRUMENT_SIZE);
+    p_Player->m_PatternTableOffset = p_Player->m_WaveOffset +
+        (p_Player->m_WaveCount * GABLE_WAVE_RAM_SIZE);
+    p_Player->m_OrderOffset = p_Player->m_PatternTableOffset + (p_Player->m_PatternCount * 2);
+
+    if (p_Player->m_OrderCount == 0 || p_Player->m_InstrumentCount > GABLE_SEQ_MAX_INSTRUMENTS)
+    {
+        GABLE_error("Sequencer data at $%04X is not a valid song.", p_Sequencer->m_Address);
+        return false;
+    }
+
+    // Start from the top, with the first instrument selected on every channel, and each channel's
+    // stream to be picked up from the first entry in the order list.
+    p_Player->m_TempoCounter = 0;
+    p_Player->m_Tick = 0;
+    p_Player->m_Row = 0;
+    p_Player->m_Order = 0;
+    p_Player->m_Paused = false;
+    for (Index i = 0; i < 4; ++i)
+    {
+        GABLE_SequencerTrack* l_Track = &p_Player->m_Tracks[i];
+        memset(l_Track, 0, sizeof(GABLE_SequencerTrack));
+        if (p_Player->m_InstrumentCount > 0 &&
+            GABLE_SelectInstrument(p_Engine, p_Player, l_Track, 0) == false)
+        {
+            return false;
+        }
+    }
+
+    return true;
+
+}
+
+void GABLE_SilenceChannel (GABLE_APU* p_APU, GABLE_AudioChannel p_Channel)
+{
+
+    // Switching a channel's DAC off also switches the channel off. The next note switches it back
+    // on again.
+    switch (p_Channel)
+    {
+        case GABLE_AC_PC1:  GABLE_WriteNR12(p_APU, 0x00); break;
+        case GABLE_AC_PC2:  GABLE_WriteNR22(p_APU, 0x00); break;
+        case GABLE_AC_WC:   GABLE_WriteNR30(p_APU, 0x00); break;
+        case GABLE_AC_NC:   GABLE_WriteNR42(p_APU, 0x00); break;
+    }
+
+}
+
+void GABLE_ReleaseChannel (GABLE_Sequencer* p_Sequencer, GABLE_APU* p_APU,
+    GABLE_AudioChannel p_Channel)
+{
+
+    // Hand the channel back to the music, which picks it up again from its next note.
+    p_Sequencer->m_Owners[p_Channel]->m_Tracks[p_Channel].m_Position = 0;
+    p_Sequencer->m_Owners[p_Channel] = &p_Sequencer->m_Music;
+    p_Sequencer->m_Music.m_Tracks[p_Channel].m_NoteOn = false;
+    GABLE_SilenceChannel(p_APU, p_Channel);
+
+}
+
+void GABLE_StopPlayer (GABLE_Sequencer* p_Sequencer, GABLE_Engine* p_Engine,
+    GABLE_SequencerPlayer* p_Player)
+{
+
+    // Silence the channels the player holds. A sound effect hands its channels back to the music.
+    GABLE_APU* l_APU = GABLE_GetAPU(p_Engine);
+    for (Index i = 0; i < 4; ++i)
+    {
+        if (p_Sequencer->m_Owners[i] != p_Player)
+        {
+            continue;
+        }
+        else if (p_Player == &p_Sequencer->m_Music)
+        {
+            GABLE_SilenceChannel(l_APU, i);
+        }
+        else
+        {
+            GABLE_ReleaseChannel(p_Sequencer, l_APU, i);
+        }
+    }
+
+    p_Player->m_Playing = false;
+    p_Player->m_Paused = false;
+
+}
+
+void GABLE_WritePeriod (GABLE_APU* p_APU, GABLE_AudioChannel p_Channel,
+    const GABLE_SequencerTrack* p_Track, Uint16 p_Period, Bool p_Trigger)
+{
+
+    // Write the period's low byte, then its high bits, along with the length timer's enable bit and
+    // (when starting a note) the trigger bit.
+    Uint8 l_Control = (p_Period >> 8) & 0b111;
+    if (p_Track->m_Instrument[2] != 0) { l_Control |= 0b01000000; }
+    if (p_Trigger == true) { l_Control |= 0b10000000; }
+
+    switch (p_Channel)
+    {
+        case GABLE_AC_PC1:
+            GABLE_WriteNR13(p_APU, p_Period & 0xFF);
+            GABLE_WriteNR14(p_APU, l_Control);
+            break;
+        case GABLE_AC_PC2:
+            GABLE_WriteNR23(p_APU, p_Period & 0xFF);
+            GABLE_WriteNR24(p_APU, l_Control);
+            break;
+        case GABLE_AC_WC:
+            GABLE_WriteNR33(p_APU, p_Period & 0xFF);
+            GABLE_WriteNR34(p_APU, l_Control);
+            break;
+        case GABLE_AC_NC:
+            GABLE_WriteNR44(p_APU, l_Control & 0b11000000);
+            break;
+    }
+
+}
+
+void GABLE_PlayNote (GABLE_Engine* p_Engine, GABLE_SequencerPlayer* p_Player,
+    GABLE_SequencerTrack* p_Track, GABLE_AudioChannel p_Channel, Uint8 p_Note)
+{
+
+    GABLE_APU* l_APU = GABLE_GetAPU(p_Engine);
+    const Uint8* l_Instrument = p_Track->m_Instrument;
+    Uint8 l_Length = l_Instrument[2];
+
+    // Work out the note's envelope, replacing the instrument's initial volume if the track has a
+    // volume of its own.
+    Uint8 l_Envelope = l_Instrument[0];
+    if (p_Track->m_Volume != 0xFF)
+    {
+        l_Envelope = (l_Envelope & 0x0F) | (p_Track->m_Volume << 4);
+    }
+
+    // Set the channel's panning, if it has changed. `NR51` is only written when it has to be, since
+    // the program may be using the other channels' bits for sounds of its own, and since the APU's
+    // mix block has to be pushed out before the panning changes.
+    Uint8 l_OldPanning = GABLE_ReadNR51(l_APU);
+    Uint8 l_NewPanning = l_OldPanning & ~(0x11 << p_Channel);
+    if (p_Track->m_Panning & 0b10) { l_NewPanning |= (0x10 << p_Channel); }
+    if (p_Track->m_Panning & 0b01) { l_NewPanning |= (0x01 << p_Channel); }
+    if (l_NewPanning != l_OldPanning)
+    {
+        GABLE_FlushAPUMixBlock(l_APU, p_Engine);
+        GABLE_WriteNR51(l_APU, l_NewPanning);
+    }
+
+    // Set up the channel from the instrument, then trigger it.
+    if (l_Length > 64 && p_Channel != GABLE_AC_WC) { l_Length = 64; }
+    p_Track->m_Period = (p_Channel == GABLE_AC_WC) ?
+        GABLE_SEQ_WAVE_NOTE_PERIODS[p_Note] : GABLE_SEQ_NOTE_PERIODS[p_Note];
+    switch (p_Channel)
+    {
+        case GABLE_AC_PC1:
+            GABLE_WriteNR10(l_APU, l_Instrument[7]);
+            GABLE_WriteNR11(l_APU, (l_Instrument[1] & 0b11000000) | ((64 - l_Length) & 0b111111));
+            GABLE_WriteNR12(l_APU, l_Envelope);
+            break;
+        case GABLE_AC_PC2:
+            GABLE_WriteNR21(l_APU, (l_Instrument[1] & 0b11000000) | ((64 - l_Length) & 0b111111));
+            GABLE_WriteNR22(l_APU, l_Envelope);
+            break;
+        case GABLE_AC_WC:
+        {
+
+            // The wave pattern RAM can only be safely rewritten while the wave channel's DAC is off.
+            Uint8 l_Wave[GABLE_WAVE_RAM_SIZE];
+            GABLE_WriteNR30(l_APU, 0x00);
+            if (l_Instrument[1] < p_Player->m_WaveCount &&
+                GABLE_ReadSongBytes(p_Engine, p_Player, p_Player->m_WaveOffset +
+                    (l_Instrument[1] * GABLE_WAVE_RAM_SIZE), l_Wave, GABLE_WAVE_RAM_SIZE) == true)
+            {
+                for (Index i = 0; i < GABLE_WAVE_RAM_SIZE; ++i)
+                {
+                    GABLE_WriteWaveByte(l_APU, i, l_Wave[i]);
+                }
+            }
+
+            // The wave channel has no envelope, so a track volume picks the nearest output level.
+            Uint8 l_Level = l_Instrument[0] & 0b01100000;
+            if (p_Track->m_Volume != 0xFF)
+            {
+                l_Level = (p_Track->m_Volume == 0) ? 0b00000000 :
+                          (p_Track->m_Volume <= 5) ? 0b01100000 :
+                          (p_Track->m_Volume <= 10) ? 0b01000000 : 0b00100000;
+            }
+
+            GABLE_WriteNR30(l_APU, 0b10000000);
+            GABLE_WriteNR31(l_APU, (Uint8) (256 - l_Length));
+            GABLE_WriteNR32(l_APU, l_Level);
+            break;
+        }
+        case GABLE_AC_NC:
+        {
+
+            // The noise's notes step through its clock shifts and dividers, four to an octave,
+            // from the slowest clock up to the fastest.
+            Uint8 l_Clock = 0x00;
+            if (p_Note < 56) { l_Clock = ((13 - (p_Note / 4)) << 4) | (7 - (p_Note % 4)); }
+            else if (p_Note < 60) { l_Clock = 59 - p_Note; }
+
+            GABLE_WriteNR41(l_APU, (64 - l_Length) & 0b111111);
+            GABLE_WriteNR42(l_APU, l_Envelope);
+            GABLE_WriteNR43(l_APU, l_Clock | (l_Instrument[1] & 0b00001000));
+            break;
+        }
+    }
+
+    GABLE_WritePeriod(l_APU, p_Channel, p_Track, p_Track->m_Period, true);
+
+    // Restart the vibrato.
+    p_Track->m_VibratoPhase = 0;
+    p_Track->m_VibratoDelay = l_Instrument[4];
+    p_Track->m_NoteOn = true;
+
+}
+
+Bool GABLE_SelectInstrument (GABLE_Engine* p_Engine, GABLE_SequencerPlayer* p_Player,
+    GABLE_SequencerTrack* p_Track, Uint8 p_Instrument)
+{
+
+    if (p_Instrument >= p_Player->m_InstrumentCount)
+    {
+        GABLE_error("Sequencer instrument %u is out of bounds.", p_Instrument);
+        return false;
+    }
+
+    if (GABLE_ReadSongBytes(p_Engine, p_Player, GABLE_SEQ_HEADER_SIZE +
+        (p_Instrument * GABLE_SEQ_INSTRUMENT_SIZE), p_Track->m_Instrument,
+        GABLE_SEQ_INSTRUMENT_SIZE) == false)
+    {
+        return false;
+    }
+
+    // Selecting an instrument drops any settings the track made over the last one.
+    p_Track->m_Volume = 0xFF;
+    p_Track->m_Panning = p_Track->m_Instrument[3];
+    p_Track->m_VibratoDepth = p_Track->m_Instrument[5];
+    p_Track->m_VibratoSpeed = p_Track->m_Instrument[6];
+    return true;
+
+}
+
+Bool GABLE_RunTrackRow (GABLE_Sequencer* p_Sequencer, GABLE_Engine* p_Engine,
+    GABLE_SequencerPlayer* p_Player, GABLE_AudioChannel p_Channel)
+{
+
+    GABLE_SequencerTrack* l_Track = &p_Player->m_Tracks[p_Channel];
+    if (l_Track->m_Position == 0)
+    {
+        return true;
+    }
+    else if (l_Track->m_Wait > 0)
+    {
+        l_Track->m_Wait--;
+        return true;
+    }
+
+    // Only the song or sound effect which holds the channel may write to it; the others keep
+    // running their streams, silently, so that they stay in time.
+    Bool l_Owner = (p_Sequencer->m_Owners[p_Channel] == p_Player);
+
+    // Run through the track's events, up to and including the one which ends the row.
+    for (Index i = 0; i < GABLE_SEQ_MAX_ROW_EVENTS; ++i)
+    {
+        Uint8 l_Event[2];
+        if (GABLE_ReadSongBytes(p_Engine, p_Player, l_Track->m_Position, &l_Event[0], 1) == false)
+        {
+            return false;
+        }
+
+        l_Track->m_Position++;
+        if (l_Event[0] < GABLE_SEQ_NOTE_COUNT)
+        {
+            if (l_Owner == true)
+            {
+                GABLE_PlayNote(p_Engine, p_Player, l_Track, p_Channel, l_Event[0]);
+            }
+            return true;
+        }
+        else if (l_Event[0] < GABLE_SEQ_WAIT)
+        {
+            if (l_Owner == true && l_Track->m_NoteOn == true)
+            {
+                GABLE_SilenceChannel(GABLE_GetAPU(p_Engine), p_Channel);
+            }
+            l_Track->m_NoteOn = false;
+            return true;
+        }
+        else if (l_Event[0] < GABLE_SEQ_INSTRUMENT)
+        {
+            l_Track->m_Wait = l_Event[0] & 0x3F;
+            return true;
+        }
+        else if (l_Event[0] < GABLE_SEQ_VOLUME)
+        {
+            if (GABLE_SelectInstrument(p_Engine, p_Player, l_Track, l_Event[0] & 0x1F) == false)
+            {
+                return false;
+            }
+            continue;
+        }
+        else if (l_Event[0] == GABLE_SEQ_END)
+        {
+            l_Track->m_Position = 0;
+            return true;
+        }
+
+        // The remaining events change a setting, and are followed by a parameter.
+        if (GABLE_ReadSongBytes(p_Engine, p_Player, l_Track->m_Position, &l_Event[1], 1) == false)
+        {
+            return false;
+        }
+
+        l_Track->m_Position++;
+        switch (l_Event[0])
+        {
+            case GABLE_SEQ_VOLUME:
+                l_Track->m_Volume = l_Event[1] & 0x0F;
+                break;
+            case GABLE_SEQ_VIBRATO:
+                l_Track->m_VibratoDepth = l_Event[1] >> 4;
+                l_Track->m_VibratoSpeed = l_Event[1] & 0x0F;
+                break;
+            case GABLE_SEQ_TEMPO:
+                p_Player->m_Tempo = l_Event[1];
+                break;
+            case GABLE_SEQ_SPEED:
+                p_Player->m_Speed = (l_Event[1] != 0) ? l_Event[1] : 1;
+                break;
+            case GABLE_SEQ_MARKER:
+                p_Sequencer->m_Marker = l_Event[1];
+                break;
+            case GABLE_SEQ_PANNING:
+                l_Track->m_Panning = l_Event[1] & 0b11;
+                break;
+            default:
+                GABLE_error("Unknown sequencer event $%02X.", l_Event[0]);
+                return false;
+        }
+    }
+
+    GABLE_error("Sequencer track runs through too many events in one row.");
+    return false;
+
+}
+
+void GABLE_RunTrackTick (GABLE_Sequencer* p_Sequencer, GABLE_Engine* p_Engine,
+    GABLE_SequencerPlayer* p_Player, GABLE_AudioChannel p_Channel)
+{
+
+    // Only notes being played on a channel the player holds have vibrato to apply; the noise
+    // channel has no pitch to bend.
+    GABLE_SequencerTrack* l_Track = &p_Player->m_Tracks[p_Channel];
+    if (
+        l_Track->m_NoteOn == false ||
+        l_Track->m_VibratoDepth == 0 ||
+        p_Channel == GABLE_AC_NC ||
+        p_Sequencer->m_Owners[p_Channel] != p_Player
+    )
+    {
+        return;
+    }
+    else if (l_Track->m_VibratoDelay > 0)
+    {
+        l_Track->m_VibratoDelay--;
+        return;
+    }
+
+    // The vibrato follows a triangle wave, from `-depth` to `+depth` and back, over 64 steps. The
+    // triangle is read a quarter of a cycle on from the phase, so that it starts out from the note's
+    // own pitch, rather than from `-depth`.
+    l_Track->m_VibratoPhase = (l_Track->m_VibratoPhase + l_Track->m_VibratoSpeed) & 63;
+    Uint8 l_Step = (l_Track->m_VibratoPhase + 16) & 63;
+    Int32 l_Triangle = (l_Step < 32) ? ((Int32) l_Step - 16) : (48 - (Int32) l_Step);
+    Int32 l_Period = (Int32) l_Track->m_Period + ((Int32) l_Track->m_VibratoDepth * l_Triangle) / 16;
+    if (l_Period < 0) { l_Period = 0; }
+    if (l_Period > 2047) { l_Period = 2047; }
+
+    GABLE_WritePeriod(GABLE_GetAPU(p_Engine), p_Channel, l_Track, (Uint16) l_Period, false);
+
+}
+
+Bool GABLE_StartPattern (GABLE_Engine* p_Engine, GABLE_SequencerPlayer* p_Player)
+{
+
+    // Look up the patterns each channel plays in the current entry of the order list, and start
+    // each channel's stream from the top of its pattern.
+    Uint8 l_Patterns[4];
+    if (GABLE_ReadSongBytes(p_Engine, p_Player, p_Player->m_OrderOffset + (p_Player->m_Order * 4),
+        l_Patterns, 4) == false)
+    {
+        return false;
+    }
+
+    for (Index i = 0; i < 4; ++i)
+    {
+        GABLE_SequencerTrack* l_Track = &p_Player->m_Tracks[i];
+        l_Track->m_Position = 0;
+        l_Track->m_Wait = 0;
+        if (l_Patterns[i] == 0xFF)
+        {
+            continue;
+        }
+        else if (l_Patterns[i] >= p_Player->m_PatternCount)
+        {
+            GABLE_error("Sequencer pattern %u is out of bounds.", l_Patterns[i]);
+            return false;
+        }
+
+        Uint8 l_Offset[2];
+        if (GABLE_ReadSongBytes(p_Engine, p_Player, p_Player->m_PatternTableOffset +
+            (l_Patterns[i] * 2), l_Offset, 2) == false)
+        {
+            return false;
+        }
+
+        l_Track->m_Position = l_Offset[0] | (l_Offset[1] << 8);
+    }
+
+    return true;
+
+}
+
+void GABLE_TickPlayer (GABLE_Sequencer* p_Sequencer, GABLE_Engine* p_Engine,
+    GABLE_SequencerPlayer* p_Player)
+{
+
+    // On the first tick of each row, run each channel's events for the row, starting the next entry
+    // in the order list first, if need be.
+    if (p_Player->m_Tick == 0)
+    {
+        if (p_Player->m_Row == 0)
+        {
+            if (p_Player->m_Order >= p_Player->m_OrderCount)
+            {
+                GABLE_StopPlayer(p_Sequencer, p_Engine, p_Player);
+                return;
+            }
+            else if (GABLE_StartPattern(p_Engine, p_Player) == false)
+            {
+                GABLE_StopPlayer(p_Sequencer, p_Engine, p_Player);
+                return;
+            }
+        }
+
+        for (Index i = 0; i < 4; ++i)
+        {
+            if (GABLE_RunTrackRow(p_Sequencer, p_Engine, p_Player, i) == false)
+            {
+                GABLE_StopPlayer(p_Sequencer, p_Engine, p_Player);
+                return;
+            }
+        }
+
+        // Move on to the next row. At the end of the order list, go back to the loop entry, if
+        // there is one; otherwise, the player stops once the last row is over.
+        if (++p_Player->m_Row >= p_Player->m_RowCount)
+        {
+            p_Player->m_Row = 0;
+            if (++p_Player->m_Order >= p_Player->m_OrderCount &&
+                p_Player->m_LoopOrder < p_Player->m_OrderCount)
+            {
+                p_Player->m_Order = p_Player->m_LoopOrder;
+            }
+        }
+    }
+    else
+    {
+        for (Index i = 0; i < 4; ++i)
+        {
+            GABLE_RunTrackTick(p_Sequencer, p_Engine, p_Player, i);
+        }
+    }
+
+    if (++p_Player->m_Tick >= p_Player->m_Speed)
+    {
+        p_Player->m_Tick = 0;
+    }
+
+}
+
+void GABLE_PlayEffect (GABLE_Sequencer* p_Sequencer, GABLE_Engine* p_Engine, Uint8 p_Priority)
+{
+
+    // Load the sound effect into a scratch player first, to find out which channels it plays on.
+    GABLE_SequencerPlayer l_Effect;
+    memset(&l_Effect, 0, sizeof(GABLE_SequencerPlayer));
+    if (GABLE_LoadSong(p_Sequencer, p_Engine, &l_Effect) == false ||
+        GABLE_StartPattern(p_Engine, &l_Effect) == false)
+    {
+        return;
+    }
+
+    // Work out which of those channels it may take: those held by the music, or by a sound effect
+    // of the same or a lower priority. If it can't take any, it is dropped.
+    Uint8 l_Channels = 0;
+    for (Index i = 0; i < 4; ++i)
+    {
+        GABLE_SequencerPlayer* l_Owner = p_Sequencer->m_Owners[i];
+        if (
+            l_Effect.m_Tracks[i].m_Position != 0 &&
+            (l_Owner == &p_Sequencer->m_Music || l_Owner->m_Priority <= p_Priority)
+        )
+        {
+            l_Channels |= (1 << i);
+        }
+    }
+
+    if (l_Channels == 0)
+    {
+        return;
+    }
+
+    // Take the channels. A sound effect which loses all of its channels stops, freeing its slot,
+    // so there is always a free slot once the channels are taken.
+    GABLE_APU* l_APU = GABLE_GetAPU(p_Engine);
+    for (Index i = 0; i < 4; ++i)
+    {
+        if ((l_Channels & (1 << i)) == 0)
+        {
+            continue;
+        }
+
+        GABLE_SequencerPlayer* l_Owner = p_Sequencer->m_Owners[i];
+        if (l_Owner != &p_Sequencer->m_Music)
+        {
+            GABLE_ReleaseChannel(p_Sequencer, l_APU, i);
+
+            Bool l_Holds = false;
+            for (Index j = 0; j < 4; ++j)
+            {
+                if (p_Sequencer->m_Owners[j] == l_Owner) { l_Holds = true; }
+            }
+
+            if (l_Holds == false)
+            {
+                l_Owner->m_Playing = false;
+            }
+        }
+    }
+
+    GABLE_SequencerPlayer* l_Slot = NULL;
+    for (Index i = 0; i < GABLE_SEQ_EFFECT_SLOTS && l_Slot == NULL; ++i)
+    {
+        if (p_Sequencer->m_Effects[i].m_Playing == false)
+        {
+            l_Slot = &p_Sequencer->m_Effects[i];
+        }
+    }
+
+    GABLE_expect(l_Slot != NULL, "No free sound effect slot!");
+    *l_Slot = l_Effect;
+    l_Slot->m_Priority = p_Priority;
+    l_Slot->m_Playing = true;
+    for (Index i = 0; i < 4; ++i)
+    {
+        if (l_Channels & (1 << i))
+        {
+            p_Sequencer->m_Owners[i] = l_Slot;
+        }
+    }
+
+    // Play the first row straight away.
+    GABLE_TickPlayer(p_Sequencer, p_Engine, l_Slot);
+
+}
+
+// Public Functions ////////////////////////////////////////////////////////////////////////////////
+
+GABLE_Sequencer* GABLE_CreateSequencer ()
+{
+    // Allocate the GABLE Engine music sequencer instance.
+    GABLE_Sequencer* l_Sequencer = GABLE_calloc(1, GABLE_Sequencer);
+    GABLE_pexpect(l_Sequencer != NULL, "Failed to allocate GABLE Engine music sequencer");
+    GABLE_ResetSequencer(l_Sequencer);
+
+    // Return the new music sequencer instance.
+    return l_Sequencer;
+}
+
+void GABLE_ResetSequencer (GABLE_Sequencer* p_Sequencer)
+{
+    GABLE_expect(p_Sequencer != NULL, "Sequencer context is NULL!");
+
+    memset(p_Sequencer, 0, sizeof(GABLE_Sequencer));
+    for (Index i = 0; i < 4; ++i)
+    {
+        p_Sequencer->m_Owners[i] = &p_Sequencer->m_Music;
+    }
+}
+
+void GABLE_DestroySequencer (GABLE_Sequencer* p_Sequencer)
+{
+    if (p_Sequencer != NULL)
+    {
+        GABLE_free(p_Sequencer);
+    }
+}
+
+void GABLE_TickSequencer (GABLE_Sequencer* p_Sequencer, GABLE_Engine* p_Engine)
+{
+    GABLE_expect(p_Sequencer != NULL, "Sequencer context is NULL!");
+    GABLE_expect(p_Engine != NULL, "Engine context is NULL!");
+
+    // Each song advances by one tick each time its tempo counter passes 256.
+    GABLE_SequencerPlayer* l_Players[1 + GABLE_SEQ_EFFECT_SLOTS] = { &p_Sequencer->m_Music };
+    for (Index i = 0; i < GABLE_SEQ_EFFECT_SLOTS; ++i)
+    {
+        l_Players[1 + i] = &p_Sequencer->m_Effects[i];
+    }
+
+    for (Index i = 0; i < 1 + GABLE_SEQ_EFFECT_SLOTS; ++i)
+    {
+        GABLE_SequencerPlayer* l_Player = l_Players[i];
+        if (l_Player->m_Playing == false || l_Player->m_Paused == true)
+        {
+            continue;
+        }
+
+        l_Player->m_TempoCounter += l_Player->m_Tempo;
+        if (l_Player->m_TempoCounter >= 256)
+        {
+            l_Player->m_TempoCounter -= 256;
+            GABLE_TickPlayer(p_Sequencer, p_Engine, l_Player);
+        }
+    }
+}
+
+Bool GABLE_IsSequencerPlaying (const GABLE_Sequencer* p_Sequencer)
+{
+    GABLE_expect(p_Sequencer != NULL, "Sequencer context is NULL!");
+
+    if (p_Sequencer->m_Music.m_Playing == true && p_Sequencer->m_Music.m_Paused == false)
+    {
+        return true;
+    }
+
+    for (Index i = 0; i < GABLE_SEQ_EFFECT_SLOTS; ++i)
+    {
+        if (p_Sequencer->m_Effects[i].m_Playing == true)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Public Functions - Hardware Register Getters ////////////////////////////////////////////////////
+
+Uint8 GABLE_ReadSQAH (const GABLE_Sequencer* p_Sequencer)
+{
+    GABLE_expect(p_Sequencer != NULL, "Sequencer context is NULL!");
+    return (p_Sequencer->m_Address >> 8) & 0xFF;
+}
+
+Uint8 GABLE_ReadSQAL (const GABLE_Sequencer* p_Sequencer)
+{
+    GABLE_expect(p_Sequencer != NULL, "Sequencer context is NULL!");
+    return p_Sequencer->m_Address & 0xFF;
+}
+
+Uint8 GABLE_ReadSQC (const GABLE_Sequencer* p_Sequencer)
+{
+    GABLE_expect(p_Sequencer != NULL, "Sequencer context is NULL!");
+
+    Uint8 l_Status = 0;
+    if (p_Sequencer->m_Music.m_Playing == true) { l_Status |= G_SQCF_PLAYING; }
+    if (p_Sequencer->m_Music.m_Paused == true) { l_Status |= G_SQCF_PAUSED; }
+    for (Index i = 0; i < 4; ++i)
+    {
+        if (p_Sequencer->m_Owners[i] != &p_Sequencer->m_Music) { l_Status |= (1 << i); }
+    }
+
+    return l_Status;
+}
+
+Uint8 GABLE_ReadSQT (const GABLE_Sequencer* p_Sequencer)
+{
+    GABLE_expect(p_Sequencer != NULL, "Sequencer context is NULL!");
+    return p_Sequencer->m_Music.m_Tempo;
+}
+
+Uint8 GABLE_ReadSQM (const GABLE_Sequencer* p_Sequencer)
+{
+    GABLE_expect(p_Sequencer != NULL, "Sequencer context is NULL!");
+    return p_Sequencer->m_Marker;
+}
+
+// Public Functions - Hardware Register Setters ////////////////////////////////////////////////////
+
+void GABLE_WriteSQAH (GABLE_Sequencer* p_Sequencer, Uint8 p_Value)
+{
+    GABLE_expect(p_Sequencer != NULL, "Sequencer context is NULL!");
+    p_Sequencer->m_Address = (p_Sequencer->m_Address & 0x00FF) | (p_Value << 8);
+}
+
+void GABLE_WriteSQAL (GABLE_Sequencer* p_Sequencer, Uint8 p_Value)
+{
+    GABLE_expect(p_Sequencer != NULL, "Sequencer context is NULL!");
+    p_Sequencer->m_Address = (p_Sequencer->m_Address & 0xFF00) | p_Value;
+}
+
+void GABLE_WriteSQC (GABLE_Sequencer* p_Sequencer, GABLE_Engine* p_Engine, Uint8 p_Value)
+{
+    GABLE_expect(p_Sequencer != NULL, "Sequencer context is NULL!");
+    GABLE_expect(p_Engine != NULL, "Engine context is NULL!");
+
+    GABLE_SequencerPlayer* l_Music = &p_Sequencer->m_Music;
+    if ((p_Value & 0xF0) == G_SQCF_PLAY_SFX)
+    {
+        GABLE_PlayEffect(p_Sequencer, p_Engine, p_Value & 0x0F);
+        return;
+    }
+
+    switch (p_Value)
+    {
+        case G_SQCF_PLAY_MUSIC:
+
+            // Stop the song which is playing, then start the new one, playing its first row
+            // straight away.
+            if (l_Music->m_Playing == true)
+            {
+                GABLE_StopPlayer(p_Sequencer, p_Engine, l_Music);
+            }
+
+            if (GABLE_LoadSong(p_Sequencer, p_Engine, l_Music) == true)
+            {
+                l_Music->m_Playing = true;
+                GABLE_TickPlayer(p_Sequencer, p_Engine, l_Music);
+            }
+            break;
+
+        case G_SQCF_STOP_MUSIC:
+            if (l_Music->m_Playing == true)
+            {
+                GABLE_StopPlayer(p_Sequencer, p_Engine, l_Music);
+            }
+            break;
+
+        case G_SQCF_PAUSE_MUSIC:
+
+            // Silence the notes the music was playing, so that they don't hang on while it's
+            // paused. They pick up again from the next notes played once it is resumed.
+            if (l_Music->m_Playing == true && l_Music->m_Paused == false)
+            {
+                for (Index i = 0; i < 4; ++i)
+                {
+                    if (p_Sequencer->m_Owners[i] == l_Music && l_Music->m_Tracks[i].m_NoteOn == true)
+                    {
+                        GABLE_SilenceChannel(GABLE_GetAPU(p_Engine), i);
+                    }
+                    l_Music->m_Tracks[i].m_NoteOn = false;
+                }
+                l_Music->m_Paused = true;
+            }
+            break;
+
+        case G_SQCF_RESUME_MUSIC:
+            l_Music->m_Paused = false;
+            break;
+
+        case G_SQCF_STOP_SFX:
+            for (Index i = 0; i < GABLE_SEQ_EFFECT_SLOTS; ++i)
+            {
+                if (p_Sequencer->m_Effects[i].m_Playing == true)
+                {
+                    GABLE_StopPlayer(p_Sequencer, p_Engine, &p_Sequencer->m_Effects[i]);
+                }
+            }
+            break;
+
+        default:
+            GABLE_error("Unknown sequencer command $%02X.", p_Value);
+            break;
+    }
+}
+
+void GABLE_WriteSQT (GABLE_Sequencer* p_Sequencer, Uint8 p_Value)
+{
+    GABLE_expect(p_Sequencer != NULL, "Sequencer context is NULL!");
+    p_Sequencer->m_Music.m_Tempo = p_Value;
+}
+
+void GABLE_WriteSQM (GABLE_Sequencer* p_Sequencer, Uint8 p_Value)
+{
+    GABLE_expect(p_Sequencer != NULL, "Sequencer context is NULL!");
+    p_Sequencer->m_Marker = p_Value;
+}
@@ -119,6 +119,15 @@ Bool GABLE_CheckTimerDividerBit (GABLE_Timer* p_Timer, Uint8 p_Bit)
     return (l_OldBit == true && l_NewBit == false);
 }
 
+Uint16 GABLE_GetTimerDivider (const GABLE_Timer* p_Timer)
+{
+    // Validate the timer instance.
+    GABLE_expect(p_Timer != NULL, "Timer context is NULL!");
+
+    // Return the full divider value.
+    return p_Timer->m_DIV;
+}
+
 // Public Functions - Hardware Register Getters ////////////////////////////////////////////////////
 
 Uint8 GABLE_ReadDIV (const GABLE_Timer* p_Timer)
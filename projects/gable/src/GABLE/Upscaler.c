@@ -0,0 +1,448 @@
+/**
+ * @file GABLE/Upscaler.c
+ */
+
+#include <GABLE/Engine.h>
+#include <GABLE/PPU.h>
+#include <GABLE/Upscaler.h>
+
+// Platform-Specific ///////////////////////////////////////////////////////////////////////////////
+
+#if defined(GABLE_LINUX)
+    #include <pthread.h>
+#else
+    #error "The GABLE Engine's upscaler worker pool is not yet implemented for this platform."
+#endif
+
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+
+// GABLE Upscaler Job Structure ////////////////////////////////////////////////////////////////////
+
+typedef struct GABLE_UpscaleJob
+{
+    GABLE_UpscaleFilter     m_Filter;           ///< @brief The filter to upscale the frame with.
+    Uint8                   m_Scale;            ///< @brief The integer scale factor.
+    const Uint32*           m_Source;           ///< @brief The source frame.
+    Uint32*                 m_Destination;      ///< @brief The destination buffer.
+    Size                    m_Pitch;            ///< @brief The destination buffer's row pitch, in bytes.
+    Count                   m_BandCount;        ///< @brief The number of bands the frame is split into.
+} GABLE_UpscaleJob;
+
+// GABLE Upscaler Worker Structure /////////////////////////////////////////////////////////////////
+
+typedef struct GABLE_UpscalerWorker
+{
+    pthread_t               m_Thread;           ///< @brief The worker's thread handle.
+    GABLE_Upscaler*         m_Upscaler;         ///< @brief The upscaler which owns this worker.
+    Index                   m_Band;             ///< @brief The index of the band this worker processes.
+} GABLE_UpscalerWorker;
+
+// GABLE Upscaler Structure ////////////////////////////////////////////////////////////////////////
+
+typedef struct GABLE_Upscaler
+{
+    GABLE_UpscalerWorker    m_Workers[GABLE_UPSCALER_MAX_WORKERS];  ///< @brief The worker threads.
+    Count                   m_WorkerCount;      ///< @brief The number of worker threads.
+    pthread_mutex_t         m_Mutex;            ///< @brief Guards the job and the fields below.
+    pthread_cond_t          m_JobPosted;        ///< @brief Signalled when a new job is posted.
+    pthread_cond_t          m_JobDone;          ///< @brief Signalled when the last worker finishes.
+    GABLE_UpscaleJob        m_Job;              ///< @brief The job currently being processed.
+    Uint64                  m_Generation;       ///< @brief Incremented every time a job is posted.
+    Count                   m_PendingWorkers;   ///< @brief The number of workers yet to finish the job.
+    Bool                    m_ShuttingDown;     ///< @brief Set when the upscaler is being destroyed.
+} GABLE_Upscaler;
+
+// Static Function Prototypes - Kernels ////////////////////////////////////////////////////////////
+
+static void GABLE_ExpandNearestRow (const Uint32* p_Source, Uint32* p_Destination, Uint8 p_Scale);
+static void GABLE_UpscaleNearestBand (const GABLE_UpscaleJob* p_Job, Index p_FirstRow, Index p_EndRow);
+static void GABLE_PadScale2xRow (const Uint32* p_Source, Uint32* p_Padded);
+static void GABLE_UpscaleScale2xBand (const GABLE_UpscaleJob* p_Job, Index p_FirstRow, Index p_EndRow);
+static void GABLE_ProcessUpscaleBand (const GABLE_UpscaleJob* p_Job, Index p_Band);
+
+// Static Function Prototypes - Worker Pool ////////////////////////////////////////////////////////
+
+static void* GABLE_UpscalerWorkerMain (void* p_Argument);
+
+// Static Functions - Kernels //////////////////////////////////////////////////////////////////////
+
+void GABLE_ExpandNearestRow (const Uint32* p_Source, Uint32* p_Destination, Uint8 p_Scale)
+{
+
+#if defined(__SSE2__)
+
+    // The 2x and 4x cases are by far the most common, so they get dedicated shuffles which load
+    // four source pixels at a time.
+    if (p_Scale == 2)
+    {
+        for (Index i = 0; i < GABLE_PPU_SCREEN_WIDTH; i += 4)
+        {
+            __m128i l_Pixels = _mm_loadu_si128((const __m128i*) &p_Source[i]);
+            _mm_storeu_si128((__m128i*) &p_Destination[i * 2],     _mm_unpacklo_epi32(l_Pixels, l_Pixels));
+            _mm_storeu_si128((__m128i*) &p_Destination[i * 2 + 4], _mm_unpackhi_epi32(l_Pixels, l_Pixels));
+        }
+
+        return;
+    }
+    else if (p_Scale == 4)
+    {
+        for (Index i = 0; i < GABLE_PPU_SCREEN_WIDTH; i += 4)
+        {
+            __m128i l_Pixels = _mm_loadu_si128((const __m128i*) &p_Source[i]);
+            _mm_storeu_si128((__m128i*) &p_Destination[i * 4],      _mm_shuffle_epi32(l_Pixels, 0x00));
+            _mm_storeu_si128((__m128i*) &p_Destination[i * 4 + 4],  _mm_shuffle_epi32(l_Pixels, 0x55));
+            _mm_storeu_si128((__m128i*) &p_Destination[i * 4 + 8],  _mm_shuffle_epi32(l_Pixels, 0xAA));
+            _mm_storeu_si128((__m128i*) &p_Destination[i * 4 + 12], _mm_shuffle_epi32(l_Pixels, 0xFF));
+        }
+
+        return;
+    }
+
+    // Any other scale broadcasts each source pixel and stores it in groups of four, finishing off
+    // whatever is left of the group with scalar stores.
+    for (Index i = 0; i < GABLE_PPU_SCREEN_WIDTH; ++i)
+    {
+        __m128i l_Pixel = _mm_set1_epi32((int) p_Source[i]);
+        Uint32* l_Output = &p_Destination[i * p_Scale];
+        Index j = 0;
+        for (; j + 4 <= p_Scale; j += 4)
+        {
+            _mm_storeu_si128((__m128i*) &l_Output[j], l_Pixel);
+        }
+        for (; j < p_Scale; ++j)
+        {
+            l_Output[j] = p_Source[i];
+        }
+    }
+
+#else
+
+    // Replicate each source pixel `p_Scale` times.
+    for (Index i = 0; i < GABLE_PPU_SCREEN_WIDTH; ++i)
+    {
+        Uint32* l_Output = &p_Destination[i * p_Scale];
+        for (Index j = 0; j < p_Scale; ++j)
+        {
+            l_Output[j] = p_Source[i];
+        }
+    }
+
+#endif
+
+}
+
+void GABLE_UpscaleNearestBand (const GABLE_UpscaleJob* p_Job, Index p_FirstRow, Index p_EndRow)
+{
+
+    Size l_RowBytes = GABLE_PPU_SCREEN_WIDTH * p_Job->m_Scale * sizeof(Uint32);
+
+    for (Index y = p_FirstRow; y < p_EndRow; ++y)
+    {
+        // Expand the source row into the first of its destination rows...
+        Uint8* l_First = (Uint8*) p_Job->m_Destination + (y * p_Job->m_Scale) * p_Job->m_Pitch;
+        GABLE_ExpandNearestRow(&p_Job->m_Source[y * GABLE_PPU_SCREEN_WIDTH], (Uint32*) l_First,
+            p_Job->m_Scale);
+
+        // ...then copy that row into the rest of them.
+        for (Index i = 1; i < p_Job->m_Scale; ++i)
+        {
+            memcpy(l_First + i * p_Job->m_Pitch, l_First, l_RowBytes);
+        }
+    }
+
+}
+
+void GABLE_PadScale2xRow (const Uint32* p_Source, Uint32* p_Padded)
+{
+
+    // The padded row holds one extra pixel on either side, duplicating the edge pixels, so that
+    // the left and right neighbours of every pixel in the row can be loaded without bounds checks.
+    p_Padded[0] = p_Source[0];
+    memcpy(&p_Padded[1], p_Source, GABLE_PPU_SCREEN_WIDTH * sizeof(Uint32));
+    p_Padded[GABLE_PPU_SCREEN_WIDTH + 1] = p_Source[GABLE_PPU_SCREEN_WIDTH - 1];
+
+}
+
+void GABLE_UpscaleScale2xBand (const GABLE_UpscaleJob* p_Job, Index p_FirstRow, Index p_EndRow)
+{
+
+    // For each source pixel `E`, with the neighbours `B` (above), `D` (left), `F` (right) and
+    // `H` (below), the 2x2 output block is:
+    //
+    //     E0 = (D == B && B != F && D != H) ? D : E
+    //     E1 = (B == F && B != D && F != H) ? F : E
+    //     E2 = (D == H && D != B && H != F) ? D : E
+    //     E3 = (H == F && D != H && B != F) ? F : E
+    Uint32 l_Current[GABLE_PPU_SCREEN_WIDTH + 2];
+    for (Index y = p_FirstRow; y < p_EndRow; ++y)
+    {
+        // Rows above the top and below the bottom of the frame are clamped to the edge rows.
+        const Uint32* l_Above = &p_Job->m_Source[((y > 0) ? y - 1 : y) * GABLE_PPU_SCREEN_WIDTH];
+        const Uint32* l_Below = &p_Job->m_Source[
+            ((y + 1 < GABLE_PPU_SCREEN_HEIGHT) ? y + 1 : y) * GABLE_PPU_SCREEN_WIDTH];
+        GABLE_PadScale2xRow(&p_Job->m_Source[y * GABLE_PPU_SCREEN_WIDTH], l_Current);
+
+        Uint32* l_Top    = (Uint32*) ((Uint8*) p_Job->m_Destination + (y * 2) * p_Job->m_Pitch);
+        Uint32* l_Bottom = (Uint32*) ((Uint8*) l_Top + p_Job->m_Pitch);
+
+    #if defined(__SSE2__)
+
+        for (Index x = 0; x < GABLE_PPU_SCREEN_WIDTH; x += 4)
+        {
+            __m128i B = _mm_loadu_si128((const __m128i*) &l_Above[x]);
+            __m128i H = _mm_loadu_si128((const __m128i*) &l_Below[x]);
+            __m128i D = _mm_loadu_si128((const __m128i*) &l_Current[x]);
+            __m128i E = _mm_loadu_si128((const __m128i*) &l_Current[x + 1]);
+            __m128i F = _mm_loadu_si128((const __m128i*) &l_Current[x + 2]);
+
+            __m128i l_DB = _mm_cmpeq_epi32(D, B);
+            __m128i l_BF = _mm_cmpeq_epi32(B, F);
+            __m128i l_DH = _mm_cmpeq_epi32(D, H);
+            __m128i l_HF = _mm_cmpeq_epi32(H, F);
+
+            // `_mm_andnot_si128(a, b)` computes `~a & b`.
+            __m128i l_C0 = _mm_andnot_si128(_mm_or_si128(l_BF, l_DH), l_DB);
+            __m128i l_C1 = _mm_andnot_si128(_mm_or_si128(l_DB, l_HF), l_BF);
+            __m128i l_C2 = _mm_andnot_si128(_mm_or_si128(l_DB, l_HF), l_DH);
+            __m128i l_C3 = _mm_andnot_si128(_mm_or_si128(l_DH, l_BF), l_HF);
+
+            __m128i l_E0 = _mm_or_si128(_mm_and_si128(l_C0, D), _mm_andnot_si128(l_C0, E));
+            __m128i l_E1 = _mm_or_si128(_mm_and_si128(l_C1, F), _mm_andnot_si128(l_C1, E));
+            __m128i l_E2 = _mm_or_si128(_mm_and_si128(l_C2, D), _mm_andnot_si128(l_C2, E));
+            __m128i l_E3 = _mm_or_si128(_mm_and_si128(l_C3, F), _mm_andnot_si128(l_C3, E));
+
+            // Interleave the left and right output pixels of each block.
+            _mm_storeu_si128((__m128i*) &l_Top[x * 2],        _mm_unpacklo_epi32(l_E0, l_E1));
+            _mm_storeu_si128((__m128i*) &l_Top[x * 2 + 4],    _mm_unpackhi_epi32(l_E0, l_E1));
+            _mm_storeu_si128((__m128i*) &l_Bottom[x * 2],     _mm_unpacklo_epi32(l_E2, l_E3));
+            _mm_storeu_si128((__m128i*) &l_Bottom[x * 2 + 4], _mm_unpackhi_epi32(l_E2, l_E3));
+        }
+
+    #else
+
+        for (Index x = 0; x < GABLE_PPU_SCREEN_WIDTH; ++x)
+        {
+            Uint32 B = l_Above[x], H = l_Below[x];
+            Uint32 D = l_Current[x], E = l_Current[x + 1], F = l_Current[x + 2];
+
+            l_Top[x * 2]        = (D == B && B != F && D != H) ? D : E;
+            l_Top[x * 2 + 1]    = (B == F && B != D && F != H) ? F : E;
+            l_Bottom[x * 2]     = (D == H && D != B && H != F) ? D : E;
+            l_Bottom[x * 2 + 1] = (H == F && D != H && B != F) ? F : E;
+        }
+
+    #endif
+    }
+
+}
+
+void GABLE_ProcessUpscaleBand (const GABLE_UpscaleJob* p_Job, Index p_Band)
+{
+
+    // Split the frame's source rows evenly between the bands.
+    Index l_FirstRow = (p_Band * GABLE_PPU_SCREEN_HEIGHT) / p_Job->m_BandCount;
+    Index l_EndRow = ((p_Band + 1) * GABLE_PPU_SCREEN_HEIGHT) / p_Job->m_BandCount;
+
+    switch (p_Job->m_Filter)
+    {
+        case GABLE_UF_NEAREST:
+            GABLE_UpscaleNearestBand(p_Job, l_FirstRow, l_EndRow);
+            break;
+        case GABLE_UF_SCALE2X:
+            GABLE_UpscaleScale2xBand(p_Job, l_FirstRow, l_EndRow);
+            break;
+    }
+
+}
+
+// Static Functions - Worker Pool //////////////////////////////////////////////////////////////////
+
+void* GABLE_UpscalerWorkerMain (void* p_Argument)
+{
+
+    GABLE_UpscalerWorker* l_Worker = (GABLE_UpscalerWorker*) p_Argument;
+    GABLE_Upscaler* l_Upscaler = l_Worker->m_Upscaler;
+    Uint64 l_SeenGeneration = 0;
+
+    pthread_mutex_lock(&l_Upscaler->m_Mutex);
+    while (true)
+    {
+        // Sleep until a new job is posted, or until the upscaler is destroyed.
+        while (l_Upscaler->m_Generation == l_SeenGeneration && l_Upscaler->m_ShuttingDown == false)
+        {
+            pthread_cond_wait(&l_Upscaler->m_JobPosted, &l_Upscaler->m_Mutex);
+        }
+
+        if (l_Upscaler->m_ShuttingDown == true)
+        {
+            break;
+        }
+
+        // Take a copy of the job, then process this worker's band outside of the lock.
+        l_SeenGeneration = l_Upscaler->m_Generation;
+        GABLE_UpscaleJob l_Job = l_Upscaler->m_Job;
+        pthread_mutex_unlock(&l_Upscaler->m_Mutex);
+
+        GABLE_ProcessUpscaleBand(&l_Job, l_Worker->m_Band);
+
+        // Let the posting thread know once every worker has finished.
+        pthread_mutex_lock(&l_Upscaler->m_Mutex);
+        if (--l_Upscaler->m_PendingWorkers == 0)
+        {
+            pthread_cond_signal(&l_Upscaler->m_JobDone);
+        }
+    }
+    pthread_mutex_unlock(&l_Upscaler->m_Mutex);
+
+    return NULL;
+
+}
+
+// Public Functions ////////////////////////////////////////////////////////////////////////////////
+
+GABLE_Upscaler* GABLE_CreateUpscaler (Count p_WorkerCount)
+{
+
+    // Allocate the upscaler.
+    GABLE_Upscaler* l_Upscaler = GABLE_calloc(1, GABLE_Upscaler);
+    GABLE_pexpect(l_Upscaler != NULL, "Failed to allocate upscaler");
+
+    // Initialize the worker pool's synchronization primitives.
+    pthread_mutex_init(&l_Upscaler->m_Mutex, NULL);
+    pthread_cond_init(&l_Upscaler->m_JobPosted, NULL);
+    pthread_cond_init(&l_Upscaler->m_JobDone, NULL);
+
+    // Spawn the worker threads. The calling thread processes band zero, so each worker is given
+    // the band after it.
+    if (p_WorkerCount > GABLE_UPSCALER_MAX_WORKERS)
+    {
+        p_WorkerCount = GABLE_UPSCALER_MAX_WORKERS;
+    }
+
+    for (Index i = 0; i < p_WorkerCount; ++i)
+    {
+        GABLE_UpscalerWorker* l_Worker = &l_Upscaler->m_Workers[i];
+        l_Worker->m_Upscaler = l_Upscaler;
+        l_Worker->m_Band = i + 1;
+
+        errno = pthread_create(&l_Worker->m_Thread, NULL, GABLE_UpscalerWorkerMain, l_Worker);
+        if (errno != 0)
+        {
+            GABLE_perror("Failed to spawn upscaler worker thread #%zu", i);
+            break;
+        }
+
+        l_Upscaler->m_WorkerCount++;
+    }
+
+    // Return the upscaler.
+    return l_Upscaler;
+
+}
+
+void GABLE_DestroyUpscaler (GABLE_Upscaler* p_Upscaler)
+{
+
+    if (p_Upscaler != NULL)
+    {
+        // Wake the worker threads up and wait for them to exit.
+        pthread_mutex_lock(&p_Upscaler->m_Mutex);
+        p_Upscaler->m_ShuttingDown = true;
+        pthread_cond_broadcast(&p_Upscaler->m_JobPosted);
+        pthread_mutex_unlock(&p_Upscaler->m_Mutex);
+
+        for (Index i = 0; i < p_Upscaler->m_WorkerCount; ++i)
+        {
+            pthread_join(p_Upscaler->m_Workers[i].m_Thread, NULL);
+        }
+
+        pthread_cond_destroy(&p_Upscaler->m_JobDone);
+        pthread_cond_destroy(&p_Upscaler->m_JobPosted);
+        pthread_mutex_destroy(&p_Upscaler->m_Mutex);
+        GABLE_free(p_Upscaler);
+    }
+
+}
+
+Count GABLE_GetUpscalerWorkerCount (const GABLE_Upscaler* p_Upscaler)
+{
+    GABLE_expect(p_Upscaler != NULL, "Upscaler is NULL!");
+    return p_Upscaler->m_WorkerCount;
+}
+
+Bool GABLE_UpscaleFrame (GABLE_Upscaler* p_Upscaler, GABLE_UpscaleFilter p_Filter, Uint8 p_Scale,
+    const Uint32* p_Source, Uint32* p_Destination, Size p_Pitch)
+{
+
+    GABLE_expect(p_Upscaler != NULL, "Upscaler is NULL!");
+    GABLE_vcheck(p_Source != NULL && p_Destination != NULL, false,
+        "Source or destination buffer is NULL!");
+
+    // Validate the filter and scale factor.
+    switch (p_Filter)
+    {
+        case GABLE_UF_NEAREST:
+            GABLE_vcheck(p_Scale >= GABLE_UPSCALER_MIN_SCALE && p_Scale <= GABLE_UPSCALER_MAX_SCALE,
+                false, "Nearest-neighbour scale factor %u is out of range!", p_Scale);
+            break;
+        case GABLE_UF_SCALE2X:
+            GABLE_vcheck(p_Scale == 2, false, "The Scale2x filter only supports a scale factor of 2!");
+            break;
+        default:
+            GABLE_error("Unknown upscale filter %d!", p_Filter);
+            return false;
+    }
+
+    GABLE_vcheck(p_Pitch >= GABLE_PPU_SCREEN_WIDTH * p_Scale * sizeof(Uint32), false,
+        "Destination pitch %zu is too small for a %ux upscale!", p_Pitch, p_Scale);
+
+    GABLE_UpscaleJob l_Job = {
+        .m_Filter       = p_Filter,
+        .m_Scale        = p_Scale,
+        .m_Source       = p_Source,
+        .m_Destination  = p_Destination,
+        .m_Pitch        = p_Pitch,
+        .m_BandCount    = p_Upscaler->m_WorkerCount + 1
+    };
+
+    // If there are no workers, just process the whole frame here.
+    if (p_Upscaler->m_WorkerCount == 0)
+    {
+        GABLE_ProcessUpscaleBand(&l_Job, 0);
+        return true;
+    }
+
+    // Post the job to the workers...
+    pthread_mutex_lock(&p_Upscaler->m_Mutex);
+    p_Upscaler->m_Job = l_Job;
+    p_Upscaler->m_PendingWorkers = p_Upscaler->m_WorkerCount;
+    p_Upscaler->m_Generation++;
+    pthread_cond_broadcast(&p_Upscaler->m_JobPosted);
+    pthread_mutex_unlock(&p_Upscaler->m_Mutex);
+
+    // ...process the first band on this thread...
+    GABLE_ProcessUpscaleBand(&l_Job, 0);
+
+    // ...then wait for the workers to finish theirs.
+    pthread_mutex_lock(&p_Upscaler->m_Mutex);
+    while (p_Upscaler->m_PendingWorkers > 0)
+    {
+        pthread_cond_wait(&p_Upscaler->m_JobDone, &p_Upscaler->m_Mutex);
+    }
+    pthread_mutex_unlock(&p_Upscaler->m_Mutex);
+
+    return true;
+
+}
+
+// Public Functions - High-Level Functions /////////////////////////////////////////////////////////
+
+Bool GABLE_UpscaleScreenBuffer (GABLE_Engine* p_Engine, GABLE_Upscaler* p_Upscaler,
+    GABLE_UpscaleFilter p_Filter, Uint8 p_Scale, Uint32* p_Destination, Size p_Pitch)
+{
+    GABLE_expect(p_Engine != NULL, "Engine context is NULL!");
+    return GABLE_UpscaleFrame(p_Upscaler, p_Filter, p_Scale, GABLE_GetScreenBuffer(p_Engine),
+        p_Destination, p_Pitch);
+}